@@ -2,7 +2,7 @@
   \file     Account.cpp
   \author   Keith Adkins
   \created  2/12/2017
-  \modified 2/14/2017
+  \modified 10/19/2026
   \course   CS467, Winter 2017
  
   \details Implementation file for the Account class.
@@ -10,14 +10,79 @@
 
 
 #include <string>
+#include <vector>
 #include <fstream>
+#include <sstream>
 #include <iostream>
+#include <iterator>
+#include <cerrno>
+#include <cstdio>       // rename
 #include <stdlib.h>     // atoi
+#include <fcntl.h>
+#include <unistd.h>
 #include "Account.hpp"
 
 
 namespace legacymud { namespace account {
 
+namespace {
+    const std::string LOG_HEADER = "LEGACYMUD_ACCOUNTS 2";     // first line of a log format account file
+    const size_t COMPACT_MIN_RECORDS = 1024;                    // smallest log worth compacting
+
+    /* Escapes the characters that separate fields and records. */
+    std::string escapeField(const std::string &field) {
+        std::string escaped;
+        escaped.reserve(field.size());
+        for (char c : field) {
+            if (c == '\\')
+                escaped += "\\\\";
+            else if (c == '\t')
+                escaped += "\\t";
+            else if (c == '\n')
+                escaped += "\\n";
+            else
+                escaped += c;
+        }
+        return escaped;
+    }
+
+    /* Splits a record into its unescaped fields. */
+    std::vector<std::string> splitRecord(const std::string &record) {
+        std::vector<std::string> fields(1);
+        for (size_t i = 0; i < record.size(); i++) {
+            if (record[i] == '\t')
+                fields.emplace_back();
+            else if ((record[i] == '\\') && (i + 1 < record.size())) {
+                i++;
+                if (record[i] == 't')
+                    fields.back() += '\t';
+                else if (record[i] == 'n')
+                    fields.back() += '\n';
+                else
+                    fields.back() += record[i];
+            }
+            else
+                fields.back() += record[i];
+        }
+        return fields;
+    }
+
+    /* Writes all of data to a file descriptor. */
+    bool writeAll(int fd, const std::string &data) {
+        size_t written = 0;
+        while (written < data.size()) {
+            ssize_t result = ::write(fd, data.data() + written, data.size() - written);
+            if (result == -1) {
+                if (errno == EINTR)
+                    continue;
+                return false;
+            }
+            written += static_cast<size_t>(result);
+        }
+        return true;
+    }
+}
+
 
 /******************************************************************************
 * Constructor: Account                        
@@ -25,6 +90,16 @@ namespace legacymud { namespace account {
 Account::Account(std::string fileName) { 
     /* Sets default private member variables. */
     _fileName = fileName;      
+    _logFd = -1;
+    _logRecords = 0;
+}
+
+
+/******************************************************************************
+* Destructor: ~Account                        
+*****************************************************************************/
+Account::~Account() { 
+    closeLog();
 }
 
 
@@ -33,7 +108,7 @@ Account::Account(std::string fileName) {
 *****************************************************************************/
 bool Account::initialize() {
     
-    std::ifstream inFile(_fileName);    // input stream for account file 
+    std::ifstream inFile(_fileName, std::ios::binary);    // input stream for account file 
     std::string username;               // username string to be read in
     std::string isAdminStr;             // isAdmin string to be read in
     std::string userIdStr;              // userId string to be read in
@@ -42,50 +117,80 @@ bool Account::initialize() {
     /* Set lock. Lock is released when it goes out of scope. */
     std::lock_guard<std::mutex> lock(_mu_userMap);  
     
+    closeLog();             // changes are appended only once the file is loaded
     _userMap.clear();       // initialize the user map
     
-    /* Load the account data from the file into the user map. */
-    if (inFile.is_open() ) {
-        
-        /* Read the username. */
-        while (getline(inFile, username) ){           
-        
-            /* Read the password. */
-            if (!getline(inFile, user.password) ) {       
-                inFile.close();
-                return false;     // error: data corrupt
-            }
+    if (!inFile.is_open() ) 
+        return false;       // error opening file  
 
-            /* Read isAdmin. */
-            if (!getline(inFile, isAdminStr) ) {        
-                inFile.close();
-                return false;     // error: data corrupt
+    std::string contents((std::istreambuf_iterator<char>(inFile)), std::istreambuf_iterator<char>());
+    inFile.close();     // close the file
+
+    /* Load a log format file by applying its records in order. */
+    if (contents.compare(0, LOG_HEADER.size() + 1, LOG_HEADER + '\n') == 0) {
+        size_t start = LOG_HEADER.size() + 1;
+        size_t end = contents.find('\n', start);
+        size_t records = 0;
+
+        /* Only newline-terminated records are complete.  A torn last record is dropped. */
+        while (end != std::string::npos) {
+            std::vector<std::string> fields = splitRecord(contents.substr(start, end - start));
+            if ((fields[0] == "P") && (fields.size() == 5)) {
+                user.password = fields[2];
+                user.isAdmin = (fields[3] == "1");
+                user.userId = atoi(fields[4].c_str());
+                _userMap[fields[1]] = user;
             }
-            /* Convert isAdmin to a boolean. */
-            if (isAdminStr == "true")
-                user.isAdmin = true;
-            else
-                user.isAdmin = false;
-
-            /* Read the userId. */
-            if (!getline(inFile, userIdStr) ) {         
-                inFile.close();
+            else if ((fields[0] == "D") && (fields.size() == 2)) 
+                _userMap.erase(fields[1]);
+            else 
                 return false;     // error: data corrupt
-            }
-            
-            /* Convert userIdStr to an integer. */
-            user.userId = atoi(userIdStr.c_str());      
-            
-            /* Put the user in the map. */
-            _userMap[username] = user;         
+            records++;
+            start = end + 1;
+            end = contents.find('\n', start);
         }
- 
-        inFile.close();     // close the file
-        
+
+        /* Reopen the file for appending, cutting off any torn record first. */
+        _logFd = ::open(_fileName.c_str(), O_WRONLY | O_APPEND);
+        if ((_logFd != -1) && (start < contents.size()) && (::ftruncate(_logFd, start) != 0))
+            closeLog();
+        _logFileName = _fileName;
+        _logRecords = records;
+
         return true;
     }
-    else 
-        return false;       // error opening file  
+
+    /* Load an older format file of four lines per user. */
+    std::istringstream inStream(contents);
+        
+    /* Read the username. */
+    while (getline(inStream, username) ){           
+    
+        /* Read the password. */
+        if (!getline(inStream, user.password) ) 
+            return false;     // error: data corrupt
+
+        /* Read isAdmin. */
+        if (!getline(inStream, isAdminStr) ) 
+            return false;     // error: data corrupt
+        /* Convert isAdmin to a boolean. */
+        if (isAdminStr == "true")
+            user.isAdmin = true;
+        else
+            user.isAdmin = false;
+
+        /* Read the userId. */
+        if (!getline(inStream, userIdStr) ) 
+            return false;     // error: data corrupt
+        
+        /* Convert userIdStr to an integer. */
+        user.userId = atoi(userIdStr.c_str());      
+        
+        /* Put the user in the map. */
+        _userMap[username] = user;         
+    }
+    
+    return true;
 }   
 
 
@@ -94,38 +199,102 @@ bool Account::initialize() {
 *****************************************************************************/
 bool Account::saveToDisk() {
     
-    std::ofstream outFile(_fileName);     // output stream for saving account data 
-    
     /* Set lock. Lock is released when it goes out of scope. */
     std::lock_guard<std::mutex> lock(_mu_userMap);    
     
-    /* Open the file and save the account data. */
-    if (outFile.is_open() ) {
-        
-        /* Iterate through the user map writing all the data to disk. */
-        for (auto user = _userMap.begin(); user != _userMap.end(); user++ ) {
-            
-            /* Store the username. */
-            outFile << user->first << '\n';                    
-            
-            /* Store the password. */
-            outFile << user->second.password << '\n';           
-            
-            /* Store the isAdmin setting. */
-            if (user->second.isAdmin == true)                   
-                outFile << "true\n";
-            else
-                outFile << "false\n"; 
-            
-            /* Store the userId. */
-            outFile << user->second.userId << '\n';            
-        }
+    /* If changes are already being appended to this file, make them durable
+       and compact the log once most of it is out of date. */
+    if ((_logFd != -1) && (_logFileName == _fileName)) {
+        if ((_logRecords > COMPACT_MIN_RECORDS) && (_logRecords > 2 * _userMap.size()))
+            return writeCompacted();
+        return ::fsync(_logFd) == 0;
+    }
+
+    return writeCompacted();
+}
+
+
+/******************************************************************************
+* Function:    writeCompacted                 
+*****************************************************************************/
+bool Account::writeCompacted() {
+    std::string tempFileName = _fileName + ".tmp";
+    std::string contents = LOG_HEADER + '\n';
+
+    /* One record per user. */
+    for (auto user = _userMap.begin(); user != _userMap.end(); user++ ) 
+        contents += putRecord(user->first, user->second);
+
+    /* Write a temporary file and move it over the account file, so a crash
+       never leaves the account file half written. */
+    int tempFd = ::open(tempFileName.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (tempFd == -1)
+        return false;       // error opening file
 
-        outFile.close();    // close file
+    bool success = writeAll(tempFd, contents) && (::fsync(tempFd) == 0);
+    ::close(tempFd);
+    if (!success || (std::rename(tempFileName.c_str(), _fileName.c_str()) != 0)) {
+        std::remove(tempFileName.c_str());
+        return false;
+    }
+
+    /* Append later changes to the new file. */
+    closeLog();
+    _logFd = ::open(_fileName.c_str(), O_WRONLY | O_APPEND);
+    _logFileName = _fileName;
+    _logRecords = _userMap.size();
+
+    return true;
+}
+
+
+/******************************************************************************
+* Function:    appendRecord                 
+*****************************************************************************/
+bool Account::appendRecord(const std::string &record) {
+    
+    /* Changes made before the file is loaded or saved are written by the next save. */
+    if (_logFd == -1)
         return true;
+
+    /* On failure, stop appending so the next save writes a complete file. */
+    if (!writeAll(_logFd, record)) {
+        std::cerr << "Failed to append to account file " << _logFileName << std::endl;
+        closeLog();
+        return false;
     }
-    else 
-        return false;       // error opening file
+    _logRecords++;
+
+    return true;
+}
+
+
+/******************************************************************************
+* Function:    closeLog                 
+*****************************************************************************/
+void Account::closeLog() {
+    if (_logFd != -1) {
+        ::close(_logFd);
+        _logFd = -1;
+    }
+    _logRecords = 0;
+}
+
+
+/******************************************************************************
+* Function:    putRecord                 
+*****************************************************************************/
+std::string Account::putRecord(const std::string &username, const _UserInfo &user) {
+    return "P\t" + escapeField(username) + '\t' + escapeField(user.password) + '\t' +
+           (user.isAdmin ? "1" : "0") + '\t' + std::to_string(user.userId) + '\n';
+}
+
+
+/******************************************************************************
+* Function:    deleteRecord                 
+*****************************************************************************/
+std::string Account::deleteRecord(const std::string &username) {
+    return "D\t" + escapeField(username) + '\n';
 }
 
 
@@ -174,6 +343,7 @@ bool Account::createAccount(std::string username, std::string password, bool isA
         newUser.isAdmin = isAdmin;
         newUser.userId = userId;
         _userMap[username] = newUser;   // add the user           
+        appendRecord(putRecord(username, newUser));
         return true;        
     }   
 }
@@ -193,6 +363,7 @@ bool Account::changePassword(std::string username, std::string password ) {
     /* If the user is in the map, change the password. */
     if(user != _userMap.end()) { 
         user->second.password = password;
+        appendRecord(putRecord(username, user->second));
         return true;
     }
     else
@@ -233,6 +404,7 @@ bool Account::setAdmin(std::string username, bool isAdmin ) {
     /* If the user is in the map, set the admin. */
     if(user != _userMap.end()) { 
         user->second.isAdmin = isAdmin;
+        appendRecord(putRecord(username, user->second));
         return true;
     }
     else
@@ -273,6 +445,7 @@ bool Account::deleteAccount(std::string username ) {
     /* If the user is in the map, delete account and return true. */
     if(user != _userMap.end()) {
         _userMap.erase(username);
+        appendRecord(deleteRecord(username));
         return true;
     } 
     else
@@ -2,7 +2,7 @@
   \file     Account.hpp
   \author   Keith Adkins
   \created  2/12/2017
-  \modified 2/14/2017
+  \modified 10/19/2026
   \course   CS467, Winter 2017
  
   \details  Declaration file for the Account class.
@@ -12,7 +12,8 @@
 #ifndef LEGACYMUD_ACCOUNT_HPP
 #define LEGACYMUD_ACCOUNT_HPP
 
-#include <map>
+#include <string>
+#include <unordered_map>
 #include <mutex>
 
 
@@ -23,6 +24,11 @@ namespace legacymud { namespace account {
   \brief Provides a set of functions to maintain and validate a player's LegacyMUD account.
   
   This class provides a set of functions to maintain and validate a player's LegacyMUD account.
+  
+  Accounts are kept in memory in a hash table keyed by username.  On disk they are stored as a log
+  of records, one per line.  Once the account file has been loaded or saved, every change is appended
+  to the log as it is made, so the cost of a change does not depend on the number of accounts.  The
+  log is compacted to one record per account when saveToDisk finds that most of it is out of date.
 */
 class Account {
     public:
@@ -36,10 +42,18 @@ class Account {
           \post An account class object is created and it's data file name is set.
         */
         Account(std::string fileName);
+
+        /*!
+          \brief Account class destructor.  Closes the account file.
+        */
+        ~Account();
         
         /*!
           \brief Initialize the account sytem loading the data from disk into memory.
           
+          Account files in the older format of four lines per account are also read.  They are
+          converted to the log format the next time saveToDisk is called.
+          
           \pre none
           \post Returns true if successful.  Otherwise false.
         */
@@ -50,7 +64,9 @@ class Account {
           
           This function saves all account sytem data to disk.  It is suggested to do this at the same
           time game data is saved so that data between the account system and the game stay
-          aligned.
+          aligned.  If changes are already being appended to the file, this flushes them to disk and
+          compacts the file when most of its records are out of date.  Otherwise, it writes a new
+          file holding every account and appends later changes to it.
           
           \pre none
           \post Returns true if successful.  Otherwise false.
@@ -158,14 +174,24 @@ class Account {
         int getNumberOfAccounts();
         
     private:     
-        std::string _fileName;                      // name of file where account data is stored 
         struct _UserInfo {                          // struct user info struct
             std::string password;                       // password of user
             bool isAdmin;                               // flag that indicates if this user is an admin            
             int userId;                                 // user id that links to user's game data
         };  
-        std::map<std::string, _UserInfo> _userMap;  // map of users and account info, key is the username
-        std::mutex _mu_userMap;                     // mutex used for the player echo map       
+
+        bool appendRecord(const std::string &record);      // appends a record to the open log
+        bool writeCompacted();                              // rewrites the log with one record per account
+        void closeLog();                                    // closes the open log
+        static std::string putRecord(const std::string &username, const _UserInfo &user);
+        static std::string deleteRecord(const std::string &username);
+
+        std::string _fileName;                      // name of file where account data is stored 
+        std::unordered_map<std::string, _UserInfo> _userMap;  // hash table of users and account info, key is the username
+        std::mutex _mu_userMap;                     // mutex used for the user map and the log
+        int _logFd;                                 // descriptor of the log changes are appended to, or -1
+        std::string _logFileName;                   // name of the file _logFd refers to
+        size_t _logRecords;                         // number of records in the log
 };
 
 }}
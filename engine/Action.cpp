@@ -11,6 +11,7 @@
 #include "Action.hpp"
 #include "Grammar.hpp"
 #include "EnumToString.hpp"
+#include "SlabAllocator.hpp"
 
 namespace legacymud { namespace engine {
 
@@ -39,7 +40,7 @@ Action::Action(CommandEnum command, bool valid, std::string flavorText, EffectTy
 
 
 Action::Action(const Action &otherAction)
-: flavorText(otherAction.getFlavorText()){
+: flavorText(otherAction.flavorText){
     command.store(otherAction.command.load());
     valid.store(otherAction.valid.load());
     effect.store(otherAction.effect.load());
@@ -101,6 +102,16 @@ Action::~Action(){
 }
 
 
+void* Action::operator new(std::size_t size){
+    return SlabAllocator::allocate(size);
+}
+
+
+void Action::operator delete(void *ptr, std::size_t size){
+    SlabAllocator::deallocate(ptr, size);
+}
+
+
 CommandEnum Action::getCommand() const{
     return command.load();
 }
@@ -112,8 +123,7 @@ bool Action::getValid() const{
 
 
 std::string Action::getFlavorText() const{
-    std::lock_guard<std::mutex> flavorTextLock(flavorTextMutex);
-    return flavorText;
+    return flavorText.get();
 }
 
 
@@ -198,8 +208,7 @@ bool Action::setValid(bool validCommand){
 
 
 bool Action::setFlavorText(std::string flavorText){
-    std::lock_guard<std::mutex> flavorTextLock(flavorTextMutex);
-    this->flavorText = flavorText;
+    this->flavorText.set(flavorText);
     return true;
 }
 
@@ -21,6 +21,7 @@
 #include <vector>
 #include <atomic>
 #include <mutex>
+#include "SharedString.hpp"
 #include "CommandEnum.hpp"
 #include "EffectType.hpp"
 #include "DataType.hpp"
@@ -48,6 +49,13 @@ class Action {
         bool operator==(const Action &otherAction) const;
         virtual ~Action();
 
+        /*!
+         * \brief   Allocates actions from the shared slabs of the SlabAllocator
+         *          instead of making a separate heap allocation.
+         */
+        static void* operator new(std::size_t size);
+        static void operator delete(void *ptr, std::size_t size);
+
         /*!
          * \brief   Gets the command that is associated with this action.
          *
@@ -205,8 +213,7 @@ class Action {
     private:
         std::atomic<CommandEnum> command;
         std::atomic<bool> valid;
-        std::string flavorText;
-        mutable std::mutex flavorTextMutex;
+        SharedString flavorText;
         std::atomic<EffectType> effect;
         std::map<std::string, parser::Grammar*> aliases;
         mutable std::mutex aliasesMutex;
@@ -65,19 +65,13 @@ Area::Area(std::string name, std::string shortDescription, std::string longDescr
 
 
 Area::Area(const Area &otherArea) : InteractiveNoun(otherArea) {
-    otherArea.nameMutex.lock();
     name = otherArea.name;
-    otherArea.nameMutex.unlock();
-    otherArea.shortDescMutex.lock();
     shortDescription = otherArea.shortDescription;
-    otherArea.shortDescMutex.unlock();
-    otherArea.longDescMutex.lock();
     longDescription = otherArea.longDescription;
-    otherArea.longDescMutex.unlock();
     size.store(otherArea.getSize());
     std::string idAlias = "area " + std::to_string(getID());
     addNounAlias(idAlias);
-    addNounAlias(name);
+    addNounAlias(name.get());
 }
 
 
@@ -86,19 +80,13 @@ Area & Area::operator=(const Area &otherArea){
         return *this;
 
     InteractiveNoun::operator=(otherArea);
-    otherArea.nameMutex.lock();
     name = otherArea.name;
-    otherArea.nameMutex.unlock();
-    otherArea.shortDescMutex.lock();
     shortDescription = otherArea.shortDescription;
-    otherArea.shortDescMutex.unlock();
-    otherArea.longDescMutex.lock();
     longDescription = otherArea.longDescription;
-    otherArea.longDescMutex.unlock();
     size.store(otherArea.getSize());
     std::string idAlias = "area " + std::to_string(getID());
     addNounAlias(idAlias);
-    addNounAlias(name);
+    addNounAlias(name.get());
 
     return *this;
 }
@@ -110,20 +98,17 @@ Area::~Area(){
 
 
 std::string Area::getName() const{
-    std::lock_guard<std::mutex> nameLock(nameMutex);
-    return name;
+    return name.get();
 } 
 
 
 std::string Area::getShortDesc() const{
-    std::lock_guard<std::mutex> shortDescLock(shortDescMutex);
-    return shortDescription;
+    return shortDescription.get();
 }
 
 
 std::string Area::getLongDesc() const{
-    std::lock_guard<std::mutex> longDescLock(longDescMutex);
-    return longDescription;
+    return longDescription.get();
 }
 
 
@@ -286,24 +271,19 @@ bool Area::isBiggerThanOrEqual(AreaSize aSize) const{
 
 
 bool Area::setName(std::string name){
-    std::lock_guard<std::mutex> nameLock(nameMutex);
-    removeNounAlias(this->name);
-    addNounAlias(name);
-    this->name = name;
+    replaceName(this->name, name);
     return true;
 }
 
 
 bool Area::setShortDesc(std::string shortDescription){
-    std::lock_guard<std::mutex> shortDescLock(shortDescMutex);
-    this->shortDescription = shortDescription;
+    this->shortDescription.set(shortDescription);
     return true;
 }
 
 
 bool Area::setLongDesc(std::string longDescription){
-    std::lock_guard<std::mutex> longDescLock(longDescMutex);
-    this->longDescription = longDescription;
+    this->longDescription.set(longDescription);
     return true;
 }
 
@@ -317,21 +297,23 @@ bool Area::setSize(AreaSize size){
 bool Area::addItem(Item *anItem){
     Container *aContainer = nullptr;
     std::vector<Item*> contents;
+    parser::LexicalBatch batch;
 
     if (anItem != nullptr){
         std::lock_guard<std::mutex> itemContentLock(itemContentMutex);
         itemContents.push_back(anItem);
-        addAllLexicalData(anItem);
+        batch.addObject(anItem);
 
         if (anItem->getObjectType() == ObjectType::CONTAINER){
             aContainer = dynamic_cast<Container*>(anItem);
             if (aContainer != nullptr){
                 contents = aContainer->getAllContents();
                 for (auto content : contents){
-                    addAllLexicalData(content);
+                    batch.addObject(content);
                 }
             }
         }
+        applyLexicalBatch(batch);
 
         return true;
     }
@@ -341,18 +323,20 @@ bool Area::addItem(Item *anItem){
 
 bool Area::addCharacter(Character *aCharacter){
     std::vector<std::pair<EquipmentSlot, Item*>> inventory;
+    parser::LexicalBatch batch;
 
     if (aCharacter != nullptr){
         std::lock_guard<std::mutex> charContentLock(charContentMutex);
         characterContents.push_back(aCharacter);
-        addAllLexicalData(aCharacter);
+        batch.addObject(aCharacter);
 
         if (aCharacter->getObjectType() != ObjectType::PLAYER){
             inventory = aCharacter->getInventory();
             for (auto item : inventory){
-                addAllLexicalData(item.second);
+                batch.addObject(item.second);
             }
         }
+        applyLexicalBatch(batch);
 
         return true;
     }
@@ -383,38 +367,21 @@ bool Area::addExit(Exit *anExit){
 
 
 void Area::addAllLexicalData(InteractiveNoun *anObject){
-    std::vector<std::string> nounAliases, verbAliases;
+    parser::LexicalBatch batch;
 
     if (anObject != nullptr){
-        std::lock_guard<std::mutex> lexicalLock(lexicalMutex);
-        nounAliases = anObject->getNounAliases();
-        verbAliases = anObject->getVerbAliases();
-
-        for (auto noun : nounAliases){
-            contentsLexicalData.addNoun(noun, anObject);
-        }
-        for (auto verb : verbAliases){
-            contentsLexicalData.addVerb(verb, anObject);
-        }
+        batch.addObject(anObject);
+        applyLexicalBatch(batch);
     }
-    
 }
 
 
 void Area::removeAllLexicalData(InteractiveNoun *anObject){
-    std::vector<std::string> nounAliases, verbAliases;
+    parser::LexicalBatch batch;
 
     if (anObject != nullptr){
-        std::lock_guard<std::mutex> lexicalLock(lexicalMutex);
-        nounAliases = anObject->getNounAliases();
-        verbAliases = anObject->getVerbAliases();
-
-        for (auto noun : nounAliases){
-            contentsLexicalData.removeNoun(noun, anObject);
-        }
-        for (auto verb : verbAliases){
-            contentsLexicalData.removeVerb(verb, anObject);
-        }
+        batch.removeObject(anObject);
+        applyLexicalBatch(batch);
     }
 }
 
@@ -422,21 +389,23 @@ void Area::removeAllLexicalData(InteractiveNoun *anObject){
 bool Area::removeItem(Item *anItem){
     Container *aContainer = nullptr;
     std::vector<Item*> contents;
+    parser::LexicalBatch batch;
 
     if (anItem != nullptr){
         std::lock_guard<std::mutex> itemContentLock(itemContentMutex);
         itemContents.erase(std::remove(itemContents.begin(), itemContents.end(), anItem), itemContents.end());
-        removeAllLexicalData(anItem);
+        batch.removeObject(anItem);
 
         if (anItem->getObjectType() == ObjectType::CONTAINER){
             aContainer = dynamic_cast<Container*>(anItem);
             if (aContainer != nullptr){
                 contents = aContainer->getAllContents();
                 for (auto content : contents){
-                    removeAllLexicalData(content);
+                    batch.removeObject(content);
                 }
             }
         }
+        applyLexicalBatch(batch);
         
         return true;
     }
@@ -446,18 +415,20 @@ bool Area::removeItem(Item *anItem){
 
 bool Area::removeCharacter(Character *aCharacter){
     std::vector<std::pair<EquipmentSlot, Item*>> inventory;
+    parser::LexicalBatch batch;
 
     if (aCharacter != nullptr){
         std::lock_guard<std::mutex> charContentLock(charContentMutex);
         characterContents.erase(std::remove(characterContents.begin(), characterContents.end(), aCharacter), characterContents.end());
-        removeAllLexicalData(aCharacter);
+        batch.removeObject(aCharacter);
 
         if (aCharacter->getObjectType() != ObjectType::PLAYER){
             inventory = aCharacter->getInventory();
             for (auto item : inventory){
-                removeAllLexicalData(item.second);
+                batch.removeObject(item.second);
             }
         }
+        applyLexicalBatch(batch);
 
         return true;
     }
@@ -573,6 +544,13 @@ bool Area::unregisterAlias(bool isVerb, std::string alias, InteractiveNoun *anOb
 }
 
 
+bool Area::applyLexicalBatch(const parser::LexicalBatch &batch){
+    std::lock_guard<std::mutex> lexicalLock(lexicalMutex);
+    contentsLexicalData.apply(batch);
+    return true;
+}
+
+
 ObjectType Area::getObjectType() const{
     return ObjectType::AREA;
 }
@@ -21,6 +21,7 @@
 #include <atomic>
 #include <mutex>
 #include <LexicalData.hpp>
+#include "SharedString.hpp"
 #include "parser.hpp"
 #include "InteractiveNoun.hpp"
 #include "AreaSize.hpp"
@@ -360,6 +361,16 @@ class Area: public InteractiveNoun {
          */
         virtual bool unregisterAlias(bool isVerb, std::string alias, InteractiveNoun *anObject);
 
+        /*!
+         * \brief   Applies a batch of alias changes to this area's lexical data.
+         * 
+         * \param[in] batch     Specifies the alias changes to apply.
+         *
+         * \return  Returns a bool indicating whether or not applying the
+         *          batch succeeded.
+         */
+        virtual bool applyLexicalBatch(const parser::LexicalBatch &batch);
+
         /*!
          * \brief   Gets the object type.
          *
@@ -489,12 +500,9 @@ class Area: public InteractiveNoun {
         void addAllLexicalData(InteractiveNoun *anObject);
         void removeAllLexicalData(InteractiveNoun *anObject);
 
-        std::string name;
-        mutable std::mutex nameMutex;
-        std::string shortDescription;
-        mutable std::mutex shortDescMutex;
-        std::string longDescription;
-        mutable std::mutex longDescMutex;
+        SharedString name;
+        SharedString shortDescription;
+        SharedString longDescription;
         std::atomic<AreaSize> size;
         std::vector<Item*> itemContents;
         mutable std::mutex itemContentMutex;
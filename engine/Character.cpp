@@ -56,11 +56,11 @@ Character::Character(const Character &otherCharacter) : InteractiveNoun(otherCha
     name = otherCharacter.name;
     description = otherCharacter.description;
     money.store(otherCharacter.money.load());
-    location = otherCharacter.location;
+    location.store(otherCharacter.location.load());
     maxInventoryWeight.store(otherCharacter.maxInventoryWeight.load());
     std::string idAlias = "character " + std::to_string(getID());
     InteractiveNoun::addNounAlias(idAlias);
-    InteractiveNoun::addNounAlias(name);
+    InteractiveNoun::addNounAlias(name.get());
 }
 
 
@@ -69,11 +69,11 @@ Character & Character::operator=(const Character &otherCharacter){
     name = otherCharacter.name;
     description = otherCharacter.description;
     money.store(otherCharacter.money.load());
-    location = otherCharacter.location;
+    location.store(otherCharacter.location.load());
     maxInventoryWeight.store(otherCharacter.maxInventoryWeight.load());
     std::string idAlias = "character " + std::to_string(getID());
     InteractiveNoun::addNounAlias(idAlias);
-    InteractiveNoun::addNounAlias(name);
+    InteractiveNoun::addNounAlias(name.get());
 
     return *this;
 }
@@ -85,14 +85,12 @@ Character::~Character(){
 
 
 std::string Character::getName() const{
-    std::lock_guard<std::mutex> nameLock(nameMutex);
-    return name;
+    return name.get();
 }
 
 
 std::string Character::getDescription() const{
-    std::lock_guard<std::mutex> descriptionLock(descriptionMutex);
-    return description;
+    return description.get();
 }
 
 
@@ -102,8 +100,7 @@ int Character::getMoney() const{
 
 
 Area* Character::getLocation() const{
-    std::lock_guard<std::mutex> locationLock(locationMutex);
-    return location;
+    return location.load();
 }
 
 
@@ -172,17 +169,13 @@ bool Character::hasItem(ItemType *anItemType) const{
 
 
 bool Character::setName(std::string name){
-    std::lock_guard<std::mutex> nameLock(nameMutex);
-    removeNounAlias(this->name);
-    addNounAlias(name);
-    this->name = name;
+    replaceName(this->name, name);
     return true;
 }
 
 
 bool Character::setDescription(std::string description){
-    std::lock_guard<std::mutex> descriptionLock(descriptionMutex);
-    this->description = description;
+    this->description.set(description);
     return true;
 }
 
@@ -229,8 +222,7 @@ bool Character::subtractMoney(int money){
 
 bool Character::setLocation(Area *aLocation){
     if (aLocation != nullptr){
-        std::lock_guard<std::mutex> locationLock(locationMutex);
-        location = aLocation;
+        location.store(aLocation);
         return true;
     }
     return false;
@@ -18,6 +18,7 @@
 #include <utility>
 #include <mutex>
 #include <atomic>
+#include "SharedString.hpp"
 #include "InteractiveNoun.hpp"
 #include "EquipmentSlot.hpp"
 #include "ItemType.hpp"
@@ -290,13 +291,10 @@ class Character: public InteractiveNoun {
          */
         virtual Item* removeRandomFromInventory();
     private:
-        std::string name;
-        mutable std::mutex nameMutex;
-        std::string description;
-        mutable std::mutex descriptionMutex;
+        SharedString name;
+        SharedString description;
         std::atomic<int> money;
-        Area *location;
-        mutable std::mutex locationMutex;
+        std::atomic<Area*> location;
         std::vector<std::pair<EquipmentSlot, Item*>> inventory;
         mutable std::mutex inventoryMutex;
         std::atomic<int> maxInventoryWeight;
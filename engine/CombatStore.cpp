@@ -0,0 +1,230 @@
+/*********************************************************************//**
+ * \author      agent
+ * \created     10/19/2026
+ * \modified    10/19/2026
+ * \file        CombatStore.cpp
+ *
+ * \details     Implementation file for CombatStore class.
+ ************************************************************************/
+
+#include "CombatStore.hpp"
+
+namespace legacymud { namespace engine {
+
+namespace {
+
+// Adds to a current value and limits it to the maximum.
+int addCapped(std::atomic<int> &current, int amount, const std::atomic<int> &maximum){
+    int value = current.load();
+    int newValue;
+
+    do {
+        newValue = value + amount;
+        if (newValue > maximum.load()){
+            newValue = maximum.load();
+        }
+    } while (!current.compare_exchange_weak(value, newValue));
+    return newValue;
+}
+
+// Subtracts from a current value and limits it to 0.
+int subtractCapped(std::atomic<int> &current, int amount){
+    int value = current.load();
+    int newValue;
+
+    do {
+        newValue = value - amount;
+        if (newValue < 0){
+            newValue = 0;
+        }
+    } while (!current.compare_exchange_weak(value, newValue));
+    return newValue;
+}
+
+}
+
+const int CombatStore::REGEN_INTERVAL;
+const int CombatStore::SEGMENT_SIZE;
+const int CombatStore::MAX_SEGMENTS;
+
+CombatStore::Table::Table() : numSlots(0){
+    for (int i = 0; i < MAX_SEGMENTS; i++){
+        segments[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+
+int CombatStore::addCombatant(int maxHealth, int maxSpecialPts){
+    Table &aTable = getTable();
+    std::lock_guard<std::mutex> tableLock(aTable.lock);
+    int slot;
+
+    if (!aTable.freeSlots.empty()){
+        slot = aTable.freeSlots.back();
+        aTable.freeSlots.pop_back();
+    } else {
+        slot = aTable.numSlots++;
+        if (aTable.segments[slot / SEGMENT_SIZE].load() == nullptr){
+            aTable.segments[slot / SEGMENT_SIZE].store(new Segment);
+        }
+    }
+
+    Segment &aSegment = getSegment(slot);
+    int index = slot % SEGMENT_SIZE;
+    aSegment.currentHealth[index].store(maxHealth);
+    aSegment.maxHealth[index].store(maxHealth);
+    aSegment.currentSpecialPts[index].store(maxSpecialPts);
+    aSegment.maxSpecialPts[index].store(maxSpecialPts);
+    aSegment.cooldownEnd[index].store(0);
+    aSegment.regenTime[index].store(0);
+
+    return slot;
+}
+
+
+void CombatStore::removeCombatant(int slot){
+    Table &aTable = getTable();
+    std::lock_guard<std::mutex> tableLock(aTable.lock);
+    aTable.freeSlots.push_back(slot);
+}
+
+
+void CombatStore::copyCombatant(int toSlot, int fromSlot){
+    Segment &toSegment = getSegment(toSlot);
+    Segment &fromSegment = getSegment(fromSlot);
+    int to = toSlot % SEGMENT_SIZE;
+    int from = fromSlot % SEGMENT_SIZE;
+    toSegment.currentHealth[to].store(fromSegment.currentHealth[from].load());
+    toSegment.maxHealth[to].store(fromSegment.maxHealth[from].load());
+    toSegment.currentSpecialPts[to].store(fromSegment.currentSpecialPts[from].load());
+    toSegment.maxSpecialPts[to].store(fromSegment.maxSpecialPts[from].load());
+    toSegment.cooldownEnd[to].store(0);
+    toSegment.regenTime[to].store(0);
+}
+
+
+int CombatStore::getCurrentHealth(int slot){
+    return getSegment(slot).currentHealth[slot % SEGMENT_SIZE].load();
+}
+
+
+int CombatStore::getMaxHealth(int slot){
+    return getSegment(slot).maxHealth[slot % SEGMENT_SIZE].load();
+}
+
+
+int CombatStore::getCurrentSpecialPts(int slot){
+    return getSegment(slot).currentSpecialPts[slot % SEGMENT_SIZE].load();
+}
+
+
+int CombatStore::getMaxSpecialPts(int slot){
+    return getSegment(slot).maxSpecialPts[slot % SEGMENT_SIZE].load();
+}
+
+
+void CombatStore::setMaxHealth(int slot, int maxHealth){
+    getSegment(slot).maxHealth[slot % SEGMENT_SIZE].store(maxHealth);
+}
+
+
+void CombatStore::addToMaxHealth(int slot, int healthPts){
+    getSegment(slot).maxHealth[slot % SEGMENT_SIZE].fetch_add(healthPts);
+}
+
+
+int CombatStore::addToCurrentHealth(int slot, int healing){
+    Segment &aSegment = getSegment(slot);
+    int index = slot % SEGMENT_SIZE;
+    return addCapped(aSegment.currentHealth[index], healing, aSegment.maxHealth[index]);
+}
+
+
+int CombatStore::subtractFromCurrentHealth(int slot, int damage){
+    return subtractCapped(getSegment(slot).currentHealth[slot % SEGMENT_SIZE], damage);
+}
+
+
+void CombatStore::setMaxSpecialPts(int slot, int maxSpecialPts){
+    getSegment(slot).maxSpecialPts[slot % SEGMENT_SIZE].store(maxSpecialPts);
+}
+
+
+void CombatStore::addToMaxSpecialPts(int slot, int specialPts){
+    getSegment(slot).maxSpecialPts[slot % SEGMENT_SIZE].fetch_add(specialPts);
+}
+
+
+int CombatStore::addToCurrentSpecialPts(int slot, int gainedPoints){
+    Segment &aSegment = getSegment(slot);
+    int index = slot % SEGMENT_SIZE;
+    return addCapped(aSegment.currentSpecialPts[index], gainedPoints, aSegment.maxSpecialPts[index]);
+}
+
+
+int CombatStore::subtractFromCurrSpecialPts(int slot, int usedPoints){
+    return subtractCapped(getSegment(slot).currentSpecialPts[slot % SEGMENT_SIZE], usedPoints);
+}
+
+
+void CombatStore::setCooldownEnd(int slot, time_t endTime){
+    getSegment(slot).cooldownEnd[slot % SEGMENT_SIZE].store(endTime);
+}
+
+
+bool CombatStore::cooldownIsZero(int slot, time_t now){
+    return getSegment(slot).cooldownEnd[slot % SEGMENT_SIZE].load() <= now;
+}
+
+
+bool CombatStore::regen(int slot, time_t now){
+    return regenSlot(slot, now);
+}
+
+
+int CombatStore::regen(const std::vector<int> &slots, time_t now, bool skipDead){
+    int numRegenerated = 0;
+
+    for (auto slot : slots){
+        if ((!skipDead || (getCurrentHealth(slot) > 0)) && regenSlot(slot, now)){
+            numRegenerated++;
+        }
+    }
+    return numRegenerated;
+}
+
+
+int CombatStore::getNumCombatants(){
+    Table &aTable = getTable();
+    std::lock_guard<std::mutex> tableLock(aTable.lock);
+    return aTable.numSlots - aTable.freeSlots.size();
+}
+
+
+CombatStore::Table& CombatStore::getTable(){
+    static Table *aTable = new Table;
+    return *aTable;
+}
+
+
+CombatStore::Segment& CombatStore::getSegment(int slot){
+    return *getTable().segments[slot / SEGMENT_SIZE].load();
+}
+
+
+bool CombatStore::regenSlot(int slot, time_t now){
+    Segment &aSegment = getSegment(slot);
+    int index = slot % SEGMENT_SIZE;
+    time_t regenTime = aSegment.regenTime[index].load();
+
+    // only one thread regenerates the slot for each interval
+    if ((regenTime > now) || !aSegment.regenTime[index].compare_exchange_strong(regenTime, now + REGEN_INTERVAL)){
+        return false;
+    }
+
+    addCapped(aSegment.currentHealth[index], 1, aSegment.maxHealth[index]);
+    addCapped(aSegment.currentSpecialPts[index], 1, aSegment.maxSpecialPts[index]);
+    return true;
+}
+
+}}
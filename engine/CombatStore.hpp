@@ -0,0 +1,241 @@
+/*********************************************************************//**
+ * \author      agent
+ * \created     10/19/2026
+ * \modified    10/19/2026
+ * \file        CombatStore.hpp
+ *
+ * \details     Header file for CombatStore class. Defines the members
+ *              and functions needed to store the health, special points,
+ *              cooldown and regeneration time of all combatants in
+ *              parallel arrays.
+ ************************************************************************/
+
+#ifndef COMBAT_STORE_HPP
+#define COMBAT_STORE_HPP
+
+#include <atomic>
+#include <ctime>
+#include <mutex>
+#include <vector>
+
+namespace legacymud { namespace engine {
+
+/*!
+ * \details     This class stores the combat state that the game loop reads
+ *              for every combatant on every pass, as one array per field
+ *              indexed by combatant slot. Each Combatant gets a slot when
+ *              it is constructed and releases it when it is destroyed.
+ *
+ *              The update functions in GameLogic regenerate all combatants
+ *              with one call to regen(), which is a single sweep over the
+ *              arrays.
+ *
+ *              The arrays are split into segments of SEGMENT_SIZE slots
+ *              that are allocated as needed and never moved or freed, and
+ *              every field is atomic. Reading and changing a combatant
+ *              does not lock, so combatants in different fights do not
+ *              wait for each other. Only adding and removing a combatant
+ *              locks the store. All functions are O(1) except the sweeps.
+ */
+class CombatStore {
+    public:
+        static const int REGEN_INTERVAL = 5;
+        static const int SEGMENT_SIZE = 1024;
+        static const int MAX_SEGMENTS = 16384;
+
+        /*!
+         * \brief   Adds a combatant to the store.
+         *
+         * \param[in] maxHealth     Specifies the maximum and current health.
+         * \param[in] maxSpecialPts Specifies the maximum and current special points.
+         *
+         * \return  Returns the slot of the new combatant.
+         *
+         * \note    At most SEGMENT_SIZE * MAX_SEGMENTS combatants can exist
+         *          at once.
+         */
+        static int addCombatant(int maxHealth, int maxSpecialPts);
+
+        /*!
+         * \brief   Removes the combatant in the specified slot. The slot can
+         *          be reused by the next combatant that is added.
+         *
+         * \param[in] slot  Specifies the slot of the combatant.
+         */
+        static void removeCombatant(int slot);
+
+        /*!
+         * \brief   Copies the health and special points of one combatant to
+         *          another. The cooldown and regeneration time are reset.
+         *
+         * \param[in] toSlot    Specifies the slot to copy to.
+         * \param[in] fromSlot  Specifies the slot to copy from.
+         */
+        static void copyCombatant(int toSlot, int fromSlot);
+
+        static int getCurrentHealth(int slot);
+        static int getMaxHealth(int slot);
+        static int getCurrentSpecialPts(int slot);
+        static int getMaxSpecialPts(int slot);
+
+        /*!
+         * \brief   Sets the maximum health of a combatant.
+         *
+         * \param[in] slot      Specifies the slot of the combatant.
+         * \param[in] maxHealth Specifies the new maximum health.
+         */
+        static void setMaxHealth(int slot, int maxHealth);
+
+        /*!
+         * \brief   Adds to the maximum health of a combatant.
+         *
+         * \param[in] slot      Specifies the slot of the combatant.
+         * \param[in] healthPts Specifies the amount to add.
+         */
+        static void addToMaxHealth(int slot, int healthPts);
+
+        /*!
+         * \brief   Adds to the current health of a combatant, up to the
+         *          maximum health.
+         *
+         * \param[in] slot      Specifies the slot of the combatant.
+         * \param[in] healing   Specifies the amount to add.
+         *
+         * \return  Returns the updated current health.
+         */
+        static int addToCurrentHealth(int slot, int healing);
+
+        /*!
+         * \brief   Subtracts from the current health of a combatant, down
+         *          to 0.
+         *
+         * \param[in] slot      Specifies the slot of the combatant.
+         * \param[in] damage    Specifies the amount to subtract.
+         *
+         * \return  Returns the updated current health.
+         */
+        static int subtractFromCurrentHealth(int slot, int damage);
+
+        /*!
+         * \brief   Sets the maximum special points of a combatant.
+         *
+         * \param[in] slot          Specifies the slot of the combatant.
+         * \param[in] maxSpecialPts Specifies the new maximum special points.
+         */
+        static void setMaxSpecialPts(int slot, int maxSpecialPts);
+
+        /*!
+         * \brief   Adds to the maximum special points of a combatant.
+         *
+         * \param[in] slot          Specifies the slot of the combatant.
+         * \param[in] specialPts    Specifies the amount to add.
+         */
+        static void addToMaxSpecialPts(int slot, int specialPts);
+
+        /*!
+         * \brief   Adds to the current special points of a combatant, up to
+         *          the maximum special points.
+         *
+         * \param[in] slot          Specifies the slot of the combatant.
+         * \param[in] gainedPoints  Specifies the amount to add.
+         *
+         * \return  Returns the updated current special points.
+         */
+        static int addToCurrentSpecialPts(int slot, int gainedPoints);
+
+        /*!
+         * \brief   Subtracts from the current special points of a combatant,
+         *          down to 0.
+         *
+         * \param[in] slot          Specifies the slot of the combatant.
+         * \param[in] usedPoints    Specifies the amount to subtract.
+         *
+         * \return  Returns the updated current special points.
+         */
+        static int subtractFromCurrSpecialPts(int slot, int usedPoints);
+
+        /*!
+         * \brief   Sets the time when the cooldown of a combatant ends.
+         *
+         * \param[in] slot      Specifies the slot of the combatant.
+         * \param[in] endTime   Specifies the time the cooldown ends.
+         */
+        static void setCooldownEnd(int slot, time_t endTime);
+
+        /*!
+         * \brief   Gets whether the cooldown of a combatant is over.
+         *
+         * \param[in] slot  Specifies the slot of the combatant.
+         * \param[in] now   Specifies the current time.
+         *
+         * \return  Returns a bool indicating if the cooldown period is over.
+         */
+        static bool cooldownIsZero(int slot, time_t now);
+
+        /*!
+         * \brief   Regenerates one health and special point for a combatant
+         *          if its regeneration time has passed.
+         *
+         * \param[in] slot  Specifies the slot of the combatant.
+         * \param[in] now   Specifies the current time.
+         *
+         * \return  Returns a bool indicating whether the combatant regenerated.
+         */
+        static bool regen(int slot, time_t now);
+
+        /*!
+         * \brief   Regenerates every combatant in the list whose
+         *          regeneration time has passed.
+         *
+         * \param[in] slots     Specifies the slots of the combatants.
+         * \param[in] now       Specifies the current time.
+         * \param[in] skipDead  Specifies whether to skip combatants with no
+         *                      health, so a creature that dies after it was
+         *                      added to the list is not brought back.
+         *
+         * \return  Returns the number of combatants that regenerated.
+         */
+        static int regen(const std::vector<int> &slots, time_t now, bool skipDead = true);
+
+        /*!
+         * \brief   Gets the number of combatants in the store.
+         *
+         * \return  Returns the number of slots in use.
+         */
+        static int getNumCombatants();
+
+    private:
+        CombatStore();
+
+        struct Segment {
+            std::atomic<int> currentHealth[SEGMENT_SIZE];
+            std::atomic<int> maxHealth[SEGMENT_SIZE];
+            std::atomic<int> currentSpecialPts[SEGMENT_SIZE];
+            std::atomic<int> maxSpecialPts[SEGMENT_SIZE];
+            std::atomic<time_t> cooldownEnd[SEGMENT_SIZE];
+            std::atomic<time_t> regenTime[SEGMENT_SIZE];
+        };
+
+        struct Table {
+            std::atomic<Segment*> segments[MAX_SEGMENTS];
+            int numSlots;
+            std::vector<int> freeSlots;
+            std::mutex lock;
+
+            Table();
+        };
+
+        // Gets the table, which is never destroyed so combatants can be
+        // destroyed during static destruction.
+        static Table& getTable();
+
+        // Gets the segment that holds a slot that has been added.
+        static Segment& getSegment(int slot);
+
+        // Regenerates a slot if its regeneration time has passed.
+        static bool regenSlot(int slot, time_t now);
+};
+
+}}
+
+#endif
@@ -1,7 +1,7 @@
 /*********************************************************************//**
  * \author      Rachel Weissman-Hohler
  * \created     02/09/2017
- * \modified    03/10/2017
+ * \modified    10/19/2026
  * \course      CS467, Winter 2017
  * \file        Combatant.cpp
  *
@@ -11,6 +11,7 @@
 #include <iostream>
 #include <cstdlib>
 #include "Combatant.hpp"
+#include "CombatStore.hpp"
 #include "Area.hpp"
 #include "Item.hpp"
 #include "EquipmentSlot.hpp"
@@ -50,12 +51,9 @@ std::map<int, int> Combatant::skillModMap = {
 
 Combatant::Combatant()
 : Character()
-, cooldownClock(0)
-, health(std::make_pair(BEGIN_MAX_HEALTH, BEGIN_MAX_HEALTH))
+, combatSlot(CombatStore::addCombatant(BEGIN_MAX_HEALTH, BEGIN_MAX_SPECIAL))
 , spawnLocation(nullptr)
-, specialPoints(std::make_pair(BEGIN_MAX_SPECIAL, BEGIN_MAX_SPECIAL))
 , inCombat(nullptr) 
-, regenTime(0)
 {
     rollStats();
 }
@@ -63,12 +61,9 @@ Combatant::Combatant()
 
 Combatant::Combatant(int maxHealth, Area *spawnLocation, int maxSpecialPts, std::string name, std::string description, int money, Area *aLocation, int maxInventoryWeight)
 : Character(name, description, money, aLocation, maxInventoryWeight)
-, cooldownClock(0)
-, health(std::make_pair(maxHealth, maxHealth))
+, combatSlot(CombatStore::addCombatant(maxHealth, maxSpecialPts))
 , spawnLocation(spawnLocation)
-, specialPoints(std::make_pair(maxSpecialPts, maxSpecialPts))
 , inCombat(nullptr) 
-, regenTime(0)
 {
     rollStats();
 }
@@ -76,33 +71,23 @@ Combatant::Combatant(int maxHealth, Area *spawnLocation, int maxSpecialPts, std:
 
 Combatant::Combatant(int maxHealth, Area *spawnLocation, int maxSpecialPts, int dexterity, int strength, int intelligence, std::string name, std::string description, int money, Area *aLocation, int maxInventoryWeight, int anID)
 : Character(name, description, money, aLocation, maxInventoryWeight, anID)
-, cooldownClock(0)
-, health(std::make_pair(maxHealth, maxHealth))
+, combatSlot(CombatStore::addCombatant(maxHealth, maxSpecialPts))
 , spawnLocation(spawnLocation)
-, specialPoints(std::make_pair(maxSpecialPts, maxSpecialPts))
 , dexterity(dexterity)
 , strength(strength)
 , intelligence(intelligence)
 , inCombat(nullptr) 
-, regenTime(0)
 { }
 
-Combatant::Combatant(const Combatant &otherCombatant) : Character(otherCombatant) {
-    cooldownClock.store(0);
-    otherCombatant.healthMutex.lock();
-    health = otherCombatant.health;
-    otherCombatant.healthMutex.unlock();
+Combatant::Combatant(const Combatant &otherCombatant) : Character(otherCombatant), combatSlot(CombatStore::addCombatant(0, 0)) {
+    CombatStore::copyCombatant(combatSlot, otherCombatant.combatSlot);
     otherCombatant.spawnLocationMutex.lock();
     spawnLocation = otherCombatant.spawnLocation;
     otherCombatant.spawnLocationMutex.unlock();
-    otherCombatant.specialPointsMutex.lock();
-    specialPoints = otherCombatant.specialPoints;
-    otherCombatant.specialPointsMutex.unlock();
     dexterity.store(otherCombatant.dexterity.load());
     strength.store(otherCombatant.strength.load());
     intelligence.store(otherCombatant.intelligence.load());
     inCombat = nullptr;
-    regenTime.store(0);
 }
 
 
@@ -110,45 +95,40 @@ Combatant & Combatant::operator=(const Combatant &otherCombatant){
     if (this == &otherCombatant)
         return *this;
     
-    cooldownClock.store(0);
-    otherCombatant.healthMutex.lock();
-    health = otherCombatant.health;
-    otherCombatant.healthMutex.unlock();
+    CombatStore::copyCombatant(combatSlot, otherCombatant.combatSlot);
     otherCombatant.spawnLocationMutex.lock();
     spawnLocation = otherCombatant.spawnLocation;
     otherCombatant.spawnLocationMutex.unlock();
-    otherCombatant.specialPointsMutex.lock();
-    specialPoints = otherCombatant.specialPoints;
-    otherCombatant.specialPointsMutex.unlock();
     dexterity.store(otherCombatant.dexterity.load());
     strength.store(otherCombatant.strength.load());
     intelligence.store(otherCombatant.intelligence.load());
     inCombat = nullptr;
-    regenTime.store(0);
 
     return *this;
 }
 
-/*
 Combatant::~Combatant(){
-
-}*/
+    CombatStore::removeCombatant(combatSlot);
+}
 
 
 bool Combatant::cooldownIsZero() const{
-    return cooldownClock.load() <= std::time(nullptr);
+    return CombatStore::cooldownIsZero(combatSlot, std::time(nullptr));
+}
+
+
+int Combatant::getCombatSlot() const{
+    return combatSlot;
 }
 
 
 int Combatant::getCurrentHealth() const{
-    std::lock_guard<std::mutex> healthLock(healthMutex);
-    return health.first;
+    return CombatStore::getCurrentHealth(combatSlot);
 }
 
 
 int Combatant::getMaxHealth() const{
-    std::lock_guard<std::mutex> healthLock(healthMutex);
-    return health.second;
+    return CombatStore::getMaxHealth(combatSlot);
 }
 
 
@@ -159,14 +139,12 @@ Area* Combatant::getSpawnLocation() const{
 
 
 int Combatant::getCurrentSpecialPts() const{
-    std::lock_guard<std::mutex> specialPointsLock(specialPointsMutex);
-    return specialPoints.first;
+    return CombatStore::getCurrentSpecialPts(combatSlot);
 }
 
 
 int Combatant::getMaxSpecialPts() const{
-    std::lock_guard<std::mutex> specialPointsLock(specialPointsMutex);
-    return specialPoints.second;
+    return CombatStore::getMaxSpecialPts(combatSlot);
 }
 
 
@@ -227,7 +205,7 @@ std::vector<Item*> Combatant::getWeapons() const{
 
 
 bool Combatant::setCooldown(time_t cooldown){
-    cooldownClock.store(std::time(nullptr) + cooldown);
+    CombatStore::setCooldownEnd(combatSlot, std::time(nullptr) + cooldown);
     return true;
 }
 
@@ -246,46 +224,29 @@ bool Combatant::setInCombat(Combatant *aCombatant){
 
 
 bool Combatant::setMaxHealth(int maxHealth){
-    std::lock_guard<std::mutex> healthLock(healthMutex);
-    health.second = maxHealth;
+    CombatStore::setMaxHealth(combatSlot, maxHealth);
     return true;
 }
 
 
 bool Combatant::addToMaxHealth(int healthPts){
-    std::lock_guard<std::mutex> healthLock(healthMutex);
-    health.second += healthPts;
+    CombatStore::addToMaxHealth(combatSlot, healthPts);
     return true;
 }
 
 
 int Combatant::addToCurrentHealth(int healing){
-    std::lock_guard<std::mutex> healthLock(healthMutex);
-
-    health.first += healing;
-    if (health.first > health.second){
-        health.first = health.second;
-    }
-    return health.first;
+    return CombatStore::addToCurrentHealth(combatSlot, healing);
 }
 
 
 void Combatant::regen(){
-    if (regenTime.load() <= std::time(nullptr)){
-        addToCurrentHealth(1);
-        addToCurrentSpecialPts(1);
-        regenTime.store(std::time(nullptr) + 5);
-    }
+    CombatStore::regen(combatSlot, std::time(nullptr));
 }
 
 
 int Combatant::subtractFromCurrentHealth(int damage){
-    std::lock_guard<std::mutex> healthLock(healthMutex);
-    health.first -= damage;
-    if (health.first < 0){
-        health.first = 0;
-    }
-    return health.first;
+    return CombatStore::subtractFromCurrentHealth(combatSlot, damage);
 }
 
 
@@ -300,37 +261,24 @@ bool Combatant::setSpawnLocation(Area *spawnLocation){
 
 
 bool Combatant::setMaxSpecialPts(int maxSpecialPts){
-    std::lock_guard<std::mutex> specialPointsLock(specialPointsMutex);
-    specialPoints.second = maxSpecialPts;
+    CombatStore::setMaxSpecialPts(combatSlot, maxSpecialPts);
     return true;
 }
 
 
 bool Combatant::addToMaxSpecialPts(int specialPts){
-    std::lock_guard<std::mutex> specialPointsLock(specialPointsMutex);
-    specialPoints.second += specialPts;
+    CombatStore::addToMaxSpecialPts(combatSlot, specialPts);
     return true;
 }
 
 
 int Combatant::addToCurrentSpecialPts(int gainedPoints){
-    std::lock_guard<std::mutex> specialPointsLock(specialPointsMutex);
-
-    specialPoints.first += gainedPoints;
-    if (specialPoints.first > specialPoints.second){
-        specialPoints.first = specialPoints.second;
-    }
-    return specialPoints.first;
+    return CombatStore::addToCurrentSpecialPts(combatSlot, gainedPoints);
 }
 
 
 int Combatant::subtractFromCurrSpecialPts(int usedPoints){
-    std::lock_guard<std::mutex> specialPointsLock(specialPointsMutex);
-    specialPoints.first -= usedPoints;
-    if (specialPoints.first < 0){
-        specialPoints.first = 0;
-    }
-    return specialPoints.first;
+    return CombatStore::subtractFromCurrSpecialPts(combatSlot, usedPoints);
 }
 
 
@@ -1,7 +1,7 @@
 /*********************************************************************//**
  * \author      Rachel Weissman-Hohler
  * \created     02/01/2017
- * \modified    03/12/2017
+ * \modified    10/19/2026
  * \course      CS467, Winter 2017
  * \file        Combatant.hpp
  *
@@ -36,7 +36,7 @@ class Combatant: public Character {
         Combatant(int maxHealth, Area *spawnLocation, int maxSpecialPts, int dexterity, int strength, int intelligence, std::string name, std::string description, int money, Area *aLocation, int maxInventoryWeight, int anID);
         Combatant(const Combatant &otherCombatant);
         Combatant & operator=(const Combatant &otherCombatant);
-        //virtual ~Combatant();
+        virtual ~Combatant();
 
         /*!
          * \brief   Gets whether the cooldown period for this combatant is over.
@@ -45,6 +45,13 @@ class Combatant: public Character {
          */
         bool cooldownIsZero() const;
 
+        /*!
+         * \brief   Gets the slot of this combatant in the CombatStore.
+         *
+         * \return  Returns an int with the slot of this combatant.
+         */
+        int getCombatSlot() const;
+
         /*!
          * \brief   Gets the current health of this combatant.
          *
@@ -294,20 +301,16 @@ class Combatant: public Character {
          */
         int increaseIntelligence(int intPoints);
     private:
-        std::atomic<time_t> cooldownClock;
-        std::pair<int, int> health;
-        mutable std::mutex healthMutex;
+        // health, special points, cooldown and regen time are in the CombatStore
+        int combatSlot;
         Area* spawnLocation;
         mutable std::mutex spawnLocationMutex;
-        std::pair<int, int> specialPoints;
-        mutable std::mutex specialPointsMutex;
         std::atomic<int> dexterity;
         std::atomic<int> strength;
         std::atomic<int> intelligence;
         Combatant* inCombat;
         mutable std::mutex inCombatMutex;
         static std::map<int, int> skillModMap;
-        std::atomic<time_t> regenTime; 
 };
 
 }}
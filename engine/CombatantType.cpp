@@ -71,14 +71,12 @@ CombatantType::~CombatantType(){
 
 
 std::string CombatantType::getName() const{
-    std::lock_guard<std::mutex> nameLock(nameMutex);
-    return name;
+    return name.get();
 }
 
 
 SpecialSkill* CombatantType::getSpecialSkill() const{
-    std::lock_guard<std::mutex> specialSkillLock(specialSkillMutex);
-    return specialSkill;
+    return specialSkill.load();
 }
 
 
@@ -116,18 +114,14 @@ float CombatantType::getHealPoints() const{
 
 
 bool CombatantType::setName(std::string name){
-    std::lock_guard<std::mutex> nameLock(nameMutex);
-    removeNounAlias(this->name);
-    addNounAlias(name);
-    this->name = name;
+    replaceName(this->name, name);
     return true;
 }
 
 
 bool CombatantType::setSpecialSkill(SpecialSkill* skill){
     if (skill != nullptr){
-        std::lock_guard<std::mutex> specialSkillLock(specialSkillMutex);
-        specialSkill = skill;
+        specialSkill.store(skill);
         return true;
     }
     return false;
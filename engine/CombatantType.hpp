@@ -16,6 +16,7 @@
 #include <string>
 #include <mutex>
 #include <atomic>
+#include "SharedString.hpp"
 #include "InteractiveNoun.hpp"
 #include "DamageType.hpp"
 
@@ -174,10 +175,8 @@ class CombatantType: public InteractiveNoun {
          */
         virtual std::string serialize();
     private:
-        std::string name;
-        mutable std::mutex nameMutex;
-        SpecialSkill* specialSkill;
-        mutable std::mutex specialSkillMutex;
+        SharedString name;
+        std::atomic<SpecialSkill*> specialSkill;
         std::atomic<int> attackBonus;
         std::atomic<int> armorBonus;
         std::atomic<DamageType> resistantTo;
@@ -62,20 +62,17 @@ bool ConditionalElement::isConditional() const{
 
 
 ItemType* ConditionalElement::getConditionItem() const{
-    std::lock_guard<std::mutex> conditionItemLock(conditionItemMutex);
-    return conditionItem;
+    return conditionItem.load();
 }
 
 
 std::string ConditionalElement::getDescription() const{
-    std::lock_guard<std::mutex> descriptionLock(descriptionMutex);
-    return description;
+    return description.get();
 }
 
 
 std::string ConditionalElement::getAltDescription() const{
-    std::lock_guard<std::mutex> altDescriptionLock(altDescriptionMutex);
-    return altDescription;
+    return altDescription.get();
 }
 
 
@@ -87,8 +84,7 @@ bool ConditionalElement::setConditional(bool isConditional){
 
 bool ConditionalElement::setConditionItem(ItemType *anItemType){
     if (anItemType != nullptr){
-        std::lock_guard<std::mutex> conditionItemLock(conditionItemMutex);
-        conditionItem = anItemType;
+        conditionItem.store(anItemType);
         return true;
     }
     return false; 
@@ -96,15 +92,13 @@ bool ConditionalElement::setConditionItem(ItemType *anItemType){
 
 
 bool ConditionalElement::setDescription(std::string description){
-    std::lock_guard<std::mutex> descriptionLock(descriptionMutex);
-    this->description = description;
+    this->description.set(description);
     return true;
 }
 
 
 bool ConditionalElement::setAltDescription(std::string altDescription){
-    std::lock_guard<std::mutex> altDescriptionLock(altDescriptionMutex);
-    this->altDescription = altDescription;
+    this->altDescription.set(altDescription);
     return true;
 }
 
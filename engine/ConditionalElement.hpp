@@ -16,6 +16,7 @@
 #include <string>
 #include <mutex>
 #include <atomic>
+#include "SharedString.hpp"
 #include "InteractiveNoun.hpp"
 
 namespace legacymud { namespace engine {
@@ -222,12 +223,9 @@ class ConditionalElement: public InteractiveNoun {
         virtual std::string serialize();
     private:
         std::atomic<bool> conditionSet;
-        ItemType *conditionItem;
-        mutable std::mutex conditionItemMutex;
-        std::string description;
-        mutable std::mutex descriptionMutex;
-        std::string altDescription;
-        mutable std::mutex altDescriptionMutex;
+        std::atomic<ItemType*> conditionItem;
+        SharedString description;
+        SharedString altDescription;
 };
 
 }}
@@ -126,7 +126,7 @@ bool Container::remove(Item *anItem){
     bool success = false; 
     Container *aContainer;
     InteractiveNoun *location = getLocation();
-    std::vector<std::string> nounAliases, verbAliases;
+    parser::LexicalBatch batch;
     ItemPosition position;
 
     if (anItem != nullptr){
@@ -156,15 +156,8 @@ bool Container::remove(Item *anItem){
             }
         }
 
-        nounAliases = anItem->getNounAliases();
-        verbAliases = anItem->getVerbAliases();
-
-        for (auto noun : nounAliases){
-            location->unregisterAlias(false, noun, anItem);
-        }
-        for (auto verb : verbAliases){
-            location->unregisterAlias(true, verb, anItem);
-        }
+        batch.removeObject(anItem);
+        location->applyLexicalBatch(batch);
     }
 
     return success;
@@ -221,7 +214,7 @@ bool Container::place(Item *anItem, ItemPosition position){
     bool success = false; 
     Container *aContainer;
     InteractiveNoun *location = getLocation();
-    std::vector<std::string> nounAliases, verbAliases;
+    parser::LexicalBatch batch;
 
     if (anItem != nullptr){
         if (position == ItemPosition::IN){
@@ -249,15 +242,8 @@ bool Container::place(Item *anItem, ItemPosition position){
             }
         }
 
-        nounAliases = anItem->getNounAliases();
-        verbAliases = anItem->getVerbAliases();
-
-        for (auto noun : nounAliases){
-            location->registerAlias(false, noun, anItem);
-        }
-        for (auto verb : verbAliases){
-            location->registerAlias(true, verb, anItem);
-        }
+        batch.addObject(anItem);
+        location->applyLexicalBatch(batch);
     }
 
     return success;
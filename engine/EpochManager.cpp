@@ -0,0 +1,190 @@
+/*********************************************************************//**
+ * \author      agent
+ * \created     10/19/2026
+ * \modified    10/19/2026
+ * \file        EpochManager.cpp
+ *
+ * \details     Implementation file for EpochManager class.
+ ************************************************************************/
+
+#include "EpochManager.hpp"
+#include "InteractiveNoun.hpp"
+
+namespace legacymud { namespace engine {
+
+// a slot holding this value is not in use; epochs start at 1
+static const unsigned long long INACTIVE_EPOCH = 0;
+
+const int EpochManager::GUARDS_PER_BLOCK;
+
+EpochManager::Guard::Guard() : manager(nullptr), slot(nullptr) { }
+
+
+EpochManager::Guard::Guard(EpochManager &aManager) : manager(&aManager), slot(aManager.enter()) { }
+
+
+EpochManager::Guard::Guard(Guard &&otherGuard) : manager(otherGuard.manager), slot(otherGuard.slot){
+    otherGuard.manager = nullptr;
+    otherGuard.slot = nullptr;
+}
+
+
+EpochManager::Guard & EpochManager::Guard::operator=(Guard &&otherGuard){
+    if (this != &otherGuard){
+        release();
+        manager = otherGuard.manager;
+        slot = otherGuard.slot;
+        otherGuard.manager = nullptr;
+        otherGuard.slot = nullptr;
+    }
+    return *this;
+}
+
+
+EpochManager::Guard::~Guard(){
+    release();
+}
+
+
+bool EpochManager::Guard::isActive() const{
+    return manager != nullptr;
+}
+
+
+void EpochManager::Guard::release(){
+    if (manager != nullptr){
+        manager->exit(slot);
+        manager = nullptr;
+        slot = nullptr;
+    }
+}
+
+
+EpochManager::GuardBlock::GuardBlock() : next(nullptr){
+    for (int i = 0; i < GUARDS_PER_BLOCK; i++){
+        epochs[i].store(INACTIVE_EPOCH, std::memory_order_relaxed);
+    }
+}
+
+
+EpochManager::EpochManager() : globalEpoch(1){
+
+}
+
+
+EpochManager::~EpochManager(){
+    // no guards can be active once the manager is destroyed
+    for (auto object : retired){
+        delete object.second;
+    }
+    retired.clear();
+
+    GuardBlock *block = firstBlock.next.load();
+    while (block != nullptr){
+        GuardBlock *next = block->next.load();
+        delete block;
+        block = next;
+    }
+}
+
+
+void EpochManager::retire(InteractiveNoun *anObject){
+    if (anObject == nullptr){
+        return;
+    }
+
+    // guards created after the epoch advances cannot have seen the object
+    unsigned long long epoch = globalEpoch.fetch_add(1);
+    std::lock_guard<std::mutex> retiredLock(retiredMutex);
+    retired.push_back(std::make_pair(epoch, anObject));
+}
+
+
+int EpochManager::reclaim(){
+    std::vector<InteractiveNoun*> toDelete;
+    unsigned long long oldestEpoch = globalEpoch.load();
+
+    for (const GuardBlock *block = &firstBlock; block != nullptr; block = block->next.load()){
+        for (int i = 0; i < GUARDS_PER_BLOCK; i++){
+            unsigned long long epoch = block->epochs[i].load();
+            if ((epoch != INACTIVE_EPOCH) && (epoch < oldestEpoch)){
+                oldestEpoch = epoch;
+            }
+        }
+    }
+
+    std::unique_lock<std::mutex> retiredLock(retiredMutex);
+    auto it = retired.begin();
+    while (it != retired.end()){
+        if (it->first < oldestEpoch){
+            toDelete.push_back(it->second);
+            it = retired.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    retiredLock.unlock();
+
+    for (auto object : toDelete){
+        delete object;
+    }
+    return toDelete.size();
+}
+
+
+int EpochManager::getNumRetired() const{
+    std::lock_guard<std::mutex> retiredLock(retiredMutex);
+    return retired.size();
+}
+
+
+int EpochManager::getNumSlots() const{
+    int numSlots = 0;
+
+    for (const GuardBlock *block = &firstBlock; block != nullptr; block = block->next.load()){
+        numSlots += GUARDS_PER_BLOCK;
+    }
+    return numSlots;
+}
+
+
+std::atomic<unsigned long long>* EpochManager::enter(){
+    GuardBlock *block = &firstBlock;
+
+    while (true){
+        unsigned long long epoch = globalEpoch.load();
+        for (int i = 0; i < GUARDS_PER_BLOCK; i++){
+            unsigned long long expected = INACTIVE_EPOCH;
+            if (block->epochs[i].compare_exchange_strong(expected, epoch)){
+                // if an object was retired before the slot was visible, use the newer epoch
+                unsigned long long current = globalEpoch.load();
+                while (current != epoch){
+                    block->epochs[i].store(current);
+                    epoch = current;
+                    current = globalEpoch.load();
+                }
+                return &block->epochs[i];
+            }
+        }
+
+        // every slot in this block is in use, so try the next one, adding it if needed
+        GuardBlock *next = block->next.load();
+        if (next == nullptr){
+            GuardBlock *newBlock = new GuardBlock();
+            if (block->next.compare_exchange_strong(next, newBlock)){
+                next = newBlock;
+            } else {
+                // another thread added a block first, and next now points to it
+                delete newBlock;
+            }
+        }
+        block = next;
+    }
+}
+
+
+void EpochManager::exit(std::atomic<unsigned long long> *slot){
+    slot->store(INACTIVE_EPOCH);
+}
+
+}}
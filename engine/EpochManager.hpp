@@ -0,0 +1,138 @@
+/*********************************************************************//**
+ * \author      agent
+ * \created     10/19/2026
+ * \modified    10/19/2026
+ * \file        EpochManager.hpp
+ *
+ * \details     Header file for EpochManager class. Defines the members
+ *              and functions needed to free removed game objects once no
+ *              thread can still be using them.
+ ************************************************************************/
+
+#ifndef EPOCH_MANAGER_HPP
+#define EPOCH_MANAGER_HPP
+
+#include <atomic>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace legacymud { namespace engine {
+
+class InteractiveNoun;
+
+/*!
+ * \details     This class implements epoch-based reclamation for game
+ *              objects. A thread that uses raw object pointers, such as the
+ *              results of a parse, holds a Guard while it uses them. An
+ *              object that is removed from the game is retired instead of
+ *              deleted, and is tagged with the epoch it was retired in. It
+ *              is deleted by reclaim() once every Guard that existed when it
+ *              was retired has been released.
+ *
+ *              Creating and releasing a Guard does not lock; it claims a
+ *              slot with an atomic compare-and-swap. Slots are kept in
+ *              blocks of GUARDS_PER_BLOCK. When every slot is in use, a new
+ *              block is added instead of waiting for a guard to be released,
+ *              so any number of guards can be active at once.
+ */
+class EpochManager {
+    public:
+        static const int GUARDS_PER_BLOCK = 256;
+
+        /*!
+         * \details     This class marks the current thread as using game
+         *              objects until it is released or destroyed. Guards
+         *              can be moved, so a guard created when a message is
+         *              parsed can be handed to the thread that executes it.
+         */
+        class Guard {
+            public:
+                Guard();
+                explicit Guard(EpochManager &aManager);
+                Guard(const Guard &otherGuard) = delete;
+                Guard(Guard &&otherGuard);
+                Guard & operator=(const Guard &otherGuard) = delete;
+                Guard & operator=(Guard &&otherGuard);
+                ~Guard();
+
+                /*!
+                 * \brief   Gets whether this guard is protecting objects.
+                 *
+                 * \return  Returns a bool indicating whether the guard is active.
+                 */
+                bool isActive() const;
+
+                /*!
+                 * \brief   Releases the guard. Objects retired while it was
+                 *          active can be reclaimed after this call.
+                 */
+                void release();
+
+            private:
+                EpochManager *manager;
+                std::atomic<unsigned long long> *slot;
+        };
+
+        EpochManager();
+        EpochManager(const EpochManager &otherManager) = delete;
+        EpochManager & operator=(const EpochManager &otherManager) = delete;
+        ~EpochManager();
+
+        /*!
+         * \brief   Retires the specified object.
+         *
+         * The object must already be unreachable from the game, so no
+         * thread that creates a Guard after this call can find it.
+         *
+         * \param[in] anObject  Specifies the object to delete when it is safe.
+         */
+        void retire(InteractiveNoun *anObject);
+
+        /*!
+         * \brief   Deletes the retired objects that no active Guard can see.
+         *
+         * \return  Returns the number of objects that were deleted.
+         */
+        int reclaim();
+
+        /*!
+         * \brief   Gets the number of objects waiting to be deleted.
+         *
+         * \return  Returns the number of retired objects.
+         */
+        int getNumRetired() const;
+
+        /*!
+         * \brief   Gets the number of guard slots, in use or not.
+         *
+         * \return  Returns the number of slots.
+         */
+        int getNumSlots() const;
+
+    private:
+        // A block of guard slots. Blocks are only added, and are deleted
+        // with the manager, so a slot pointer stays valid.
+        struct GuardBlock {
+            std::atomic<unsigned long long> epochs[GUARDS_PER_BLOCK];
+            std::atomic<GuardBlock*> next;
+
+            GuardBlock();
+        };
+
+        // Claims a slot, adding a block if all are in use, and stores the
+        // current epoch in it.
+        std::atomic<unsigned long long>* enter();
+
+        // Releases the specified slot.
+        void exit(std::atomic<unsigned long long> *slot);
+
+        std::atomic<unsigned long long> globalEpoch;
+        GuardBlock firstBlock;
+        std::vector<std::pair<unsigned long long, InteractiveNoun*>> retired;
+        mutable std::mutex retiredMutex;
+};
+
+}}
+
+#endif
@@ -324,8 +324,7 @@ std::string Exit::getDirectionString() const{
 
 
 Area* Exit::getLocation() const{
-    std::lock_guard<std::mutex> locationLock(locationMutex);
-    return location;
+    return location.load();
 }
 
 
@@ -335,8 +334,7 @@ InteractiveNoun* Exit::getObjectLocation() const{
 
 
 Area* Exit::getConnectArea() const{
-    std::lock_guard<std::mutex> connectAreaLock(connectAreaMutex);
-    return connectArea;
+    return connectArea.load();
 }
 
 
@@ -351,8 +349,7 @@ bool Exit::setDirection(ExitDirection aDirection){
 
 bool Exit::setLocation(Area *anArea){
     if (anArea != nullptr){
-        std::lock_guard<std::mutex> locationLock(locationMutex);
-        location = anArea;
+        location.store(anArea);
         return true;
     }
 
@@ -362,8 +359,7 @@ bool Exit::setLocation(Area *anArea){
 
 bool Exit::setConnectArea(Area *anArea){
     if (anArea != nullptr){
-        std::lock_guard<std::mutex> connectAreaLock(connectAreaMutex);
-        connectArea = anArea;
+        connectArea.store(anArea);
         return true;
     }
 
@@ -307,10 +307,8 @@ class Exit: public ConditionalElement {
         void removeDirectionalAliases(ExitDirection direction);
         
         std::atomic<ExitDirection> direction;
-        Area *location;
-        mutable std::mutex locationMutex;
-        Area *connectArea;
-        mutable std::mutex connectAreaMutex;
+        std::atomic<Area*> location;
+        std::atomic<Area*> connectArea;
 };
 
 }}
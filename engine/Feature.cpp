@@ -54,20 +54,17 @@ Feature::Feature(std::string name, std::string placement, Area *location, bool i
 
 
 std::string Feature::getName() const{
-    std::lock_guard<std::mutex> nameLock(nameMutex);
-    return name;
+    return name.get();
 }
 
 
 std::string Feature::getPlacement() const{
-    std::lock_guard<std::mutex> placementLock(placementMutex);
-    return placement;
+    return placement.get();
 }
 
 
 Area* Feature::getLocation() const{
-    std::lock_guard<std::mutex> locationLock(locationMutex);
-    return location;
+    return location.load();
 }
 
 
@@ -77,18 +74,14 @@ InteractiveNoun* Feature::getObjectLocation() const{
 
 
 bool Feature::setName(std::string name){
-    std::lock_guard<std::mutex> nameLock(nameMutex);
-    removeNounAlias(this->name);
-    addNounAlias(name);
-    this->name = name;
+    replaceName(this->name, name);
 
     return true;
 }
 
 
 bool Feature::setPlacement(std::string placement){
-    std::lock_guard<std::mutex> placementLock(placementMutex);
-    this->placement = placement;
+    this->placement.set(placement);
 
     return true;
 }
@@ -96,8 +89,7 @@ bool Feature::setPlacement(std::string placement){
 
 bool Feature::setLocation(Area *anArea){
     if (anArea != nullptr){
-        std::lock_guard<std::mutex> locationLock(locationMutex);
-        location = anArea;
+        location.store(anArea);
         return true;
     }
 
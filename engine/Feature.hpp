@@ -14,8 +14,10 @@
 #define FEATURE_HPP
 
 #include <string>
+#include <atomic>
 #include <mutex>
 #include <vector>
+#include "SharedString.hpp"
 #include "parser.hpp"
 #include "ConditionalElement.hpp"
 #include "DataType.hpp"
@@ -238,12 +240,9 @@ class Feature: public ConditionalElement {
          */
         static std::map<std::string, DataType> getAttributeSignature();
     private:
-        std::string name;
-        mutable std::mutex nameMutex;
-        std::string placement;
-        mutable std::mutex placementMutex;
-        Area *location;
-        mutable std::mutex locationMutex;
+        SharedString name;
+        SharedString placement;
+        std::atomic<Area*> location;
 };
 
 }}
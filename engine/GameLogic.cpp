@@ -20,11 +20,14 @@
 #undef HUGE
 #include <parser.hpp>
 #include <DataManager.hpp>
+#include <Journal.hpp>
 #include <Account.hpp>
 #include <Server.hpp>
 #include <Display.hpp>
 #include "GameLogic.hpp"
 #include "GameObjectManager.hpp"
+#include "SlabAllocator.hpp"
+#include "CombatStore.hpp"
 #include "InteractiveNoun.hpp"
 #include "Player.hpp"
 #include "Creature.hpp"
@@ -51,6 +54,7 @@ namespace legacymud { namespace engine {
 
 const std::string ADMIN_PASSWORD = "default";
 const int SAVE_TIMEOUT = 60;
+const size_t ZONE_SIZE = 16;
 display::Display displayModule;
 const display::Display::Color CREATURE_ATTACK_COLOR = display::Display::Color::RED;
 const display::Display::Color PLAYER_ATTACK_COLOR = display::Display::Color::MAGENTA;
@@ -73,9 +77,12 @@ bool waitForSaveOrTimeout() {
 GameLogic::GameLogic() 
 : accountManager(nullptr)
 , theServer(nullptr)
+, playerEvictionTimeout(-1)
+, zoneEvictionTimeout(-1)
 {
     saving.store(false);
     manager = new GameObjectManager;
+    journal = new gamedata::Journal;
     startArea = nullptr;
 }
 
@@ -83,9 +90,12 @@ GameLogic::GameLogic()
 GameLogic::GameLogic(const GameLogic &otherGameLogic)
 : accountManager(nullptr)
 , theServer(nullptr)
+, playerEvictionTimeout(-1)
+, zoneEvictionTimeout(-1)
 {
     saving.store(false);
     manager = new GameObjectManager(*otherGameLogic.manager);
+    journal = new gamedata::Journal;
     startArea = nullptr;
 }
 
@@ -108,6 +118,9 @@ GameLogic::~GameLogic(){
         removePlayerMessageQueue(player);
     }
 
+    gamedata::DataManager::waitForPlayerSaves();
+
+    delete journal;
     delete manager;
 }
 
@@ -133,6 +146,20 @@ bool GameLogic::startGame(bool newGame, const std::string &fileName, telnet::Ser
 
             // Set starting area
             startArea = static_cast<Area*>(manager->getPointer(startAreaId));
+
+            // Zones that were paged out stay out until a player enters them
+            pagedZones = gamedata::DataManager::getSavedZones(fileName);
+            for (auto zone : pagedZones){
+                for (auto areaId : zone.second){
+                    pagedAreaZones[areaId] = zone.first;
+                }
+            }
+
+            // Fold any journaled changes that were just replayed into a new save
+            if (journal->open(gamedata::DataManager::getJournalFilename(fileName)) && (journal->checkpoint() > 0)) {
+                std::cout << "Compacting journal for " << fileName << std::endl;
+                saveAndCompact(fileName);
+            }
         }
         else {
             std::cerr << "Failed to load " << fileName << std::endl;
@@ -172,7 +199,7 @@ bool GameLogic::startGame(bool newGame, const std::string &fileName, telnet::Ser
         // Add NonCombatant to start area
         startArea->addCharacter(nonCombatant);
 
-        success = dm.saveGame(fileName, manager, startArea->getID());
+        success = saveAndCompact(fileName);
         // save account data file as well
         if (success) {
             accountManager->setFileName(fileName + ".accounts");
@@ -187,11 +214,10 @@ bool GameLogic::startGame(bool newGame, const std::string &fileName, telnet::Ser
 
 
 void GameLogic::registerQuestsGOM(){
-    std::vector<Quest*> allQuests = manager->getGameQuests();
-
-    for (auto quest : allQuests){
-        quest->registerObjectManager(manager);
-    }
+    manager->visit<Quest>([this](Quest *aQuest){
+        aQuest->registerObjectManager(manager);
+        return true;
+    });
 }
 
 
@@ -354,6 +380,7 @@ bool GameLogic::newPlayerHandler(int fileDescriptor){
             // move player to start area
             startArea->addCharacter(newPlayer);
             newPlayer->setLocation(startArea);
+            journalObject(newPlayer);
             messagePlayer(newPlayer, startArea->getFullDescription(newPlayer));
             message = "You see a player named " + playerName + " enter the area.";
             messageAreaPlayers(newPlayer, message, startArea);
@@ -371,7 +398,16 @@ bool GameLogic::newPlayerHandler(int fileDescriptor){
             success = accountManager->verifyAccount(username, password);
             if (success){
                 // check if user is already logged in
+                std::unique_lock<std::mutex> residencyLock(playerResidencyMutex);
                 aPlayer = manager->getPlayerByUsername(username);
+                if (aPlayer == nullptr){
+                    // evicted players are loaded back from their own files
+                    int playerId = accountManager->getUserId(username);
+                    if ((playerId > 0) && (manager->getPointer(playerId) == nullptr) && !currentFilename.empty()){
+                        gamedata::DataManager dm;
+                        aPlayer = dm.loadPlayer(currentFilename, playerId, manager);
+                    }
+                }
                 if (aPlayer != nullptr){
                     // load player into game
                     manager->loadPlayer(username, fileDescriptor);
@@ -380,7 +416,11 @@ bool GameLogic::newPlayerHandler(int fileDescriptor){
 
                     // move player to current location
                     anArea = aPlayer->getLocation();
+                    std::unique_lock<std::mutex> zoneLock(zoneMutex);
+                    pageInZone(anArea);
                     anArea->addCharacter(aPlayer);
+                    zoneLock.unlock();
+                    residencyLock.unlock();
                     messagePlayer(aPlayer, anArea->getFullDescription(aPlayer));
                     message = "You see a player named " + aPlayer->getName() + " enter the area.";
                     messageAreaPlayers(aPlayer, message, anArea);
@@ -443,7 +483,7 @@ void GameLogic::processInput(int numToProcess){
     Player *aPlayer = nullptr;
     Area *anArea = nullptr;
     bool isAdmin = false;
-    std::pair<std::string, int> aMessage;
+    ParsedMessage aMessage;
     std::vector<parser::ParseResult> resultVector;
 
     // lock for thread-safety
@@ -452,12 +492,15 @@ void GameLogic::processInput(int numToProcess){
     for(int i = 0; i < numToProcess; i++){
         if (!messageQueue.empty()){
             // get the next message
-            aMessage = messageQueue.front();
+            aMessage = std::move(messageQueue.front());
             messageQueue.pop();
             lockQueue.unlock();
 
+            // protect the objects found by the parser until the command is done
+            EpochManager::Guard objectGuard = manager->protectObjects();
+
             // get pointer to player the message is from
-            aPlayer = manager->getPlayerByFD(aMessage.second);
+            aPlayer = manager->getPlayerByFD(aMessage.fileDescriptor);
             if (aPlayer != nullptr){
                 // get pointer to area player is currently in
                 anArea = aPlayer->getLocation();
@@ -465,13 +508,19 @@ void GameLogic::processInput(int numToProcess){
                 // check if player is admin
                 isAdmin = accountManager->verifyAdmin(aPlayer->getUser());
 
-                // send message to parser
-                resultVector = parser::TextParser::parse(aMessage.first, aPlayer->getLexicalData(), anArea->getLexicalData(), isAdmin, aPlayer->isEditMode());
+                // use the results from the receiving thread if nothing in scope has changed
+                parser::ParseCache::Key currentKey(std::string(), aPlayer->getLexicalData(), anArea->getLexicalData(), isAdmin, aPlayer->isEditMode());
+                if (aMessage.parsed && (aMessage.key == currentKey)){
+                    resultVector = std::move(aMessage.results);
+                } else {
+                    // send message to parser
+                    resultVector = parser::TextParser::parse(aMessage.message, aPlayer->getLexicalData(), anArea->getLexicalData(), isAdmin, aPlayer->isEditMode(), aPlayer->getParseCache());
+                }
 
                 // check results
                 if (resultVector.size() == 1){
                     if (resultVector.front().status == parser::ParseStatus::VALID){
-                        std::thread aThread(&GameLogic::executeCommand, this, aPlayer, resultVector.front());
+                        std::thread aThread(&GameLogic::executeGuardedCommand, this, aPlayer, resultVector.front(), std::move(objectGuard));
                         aThread.detach();
                     } else {
                         handleParseError(aPlayer, resultVector.front());
@@ -479,13 +528,21 @@ void GameLogic::processInput(int numToProcess){
                 } else if (resultVector.size() == 0){
                     std::cout << "DEBUG:: parser returned empty result vector\n";
                 } else {
-                    std::thread aThread(&GameLogic::handleParseErrorMult, this, aPlayer, resultVector);
+                    std::thread aThread(&GameLogic::handleGuardedParseErrorMult, this, aPlayer, resultVector, std::move(objectGuard));
                     aThread.detach();
                 }
             }
+            objectGuard.release();
             lockQueue.lock();
         }
     }
+    lockQueue.unlock();
+
+    // free removed objects once no command can still be using them, and
+    // return the slabs of paged-out zones to the heap
+    if (manager->reclaimObjects() > 0){
+        SlabAllocator::trim();
+    }
 }
 
 
@@ -502,18 +559,50 @@ bool GameLogic::receivedMessageHandler(std::string message, int fileDescriptor){
         playerQueue->second->push(message);
     } else {
         playerMsgQLock.unlock();
+
+        // parse on this thread so the main loop only runs the results
+        ParsedMessage aMessage;
+        aMessage.message = std::move(message);
+        aMessage.fileDescriptor = fileDescriptor;
+        {
+            // only protect the objects while parsing; processInput checks the
+            // versions again before it uses the results
+            EpochManager::Guard parseGuard = manager->protectObjects();
+            parseMessage(aMessage);
+        }
+
         std::lock_guard<std::mutex> lockGuard(queueMutex);
-        messageQueue.push(std::make_pair(message, fileDescriptor));
+        messageQueue.push(std::move(aMessage));
     }
 
     return true;
 }
 
+
+void GameLogic::parseMessage(ParsedMessage &aMessage){
+    Player *aPlayer = manager->getPlayerByFD(aMessage.fileDescriptor);
+    if (aPlayer == nullptr)
+        return;
+
+    Area *anArea = aPlayer->getLocation();
+    if (anArea == nullptr)
+        return;
+
+    bool isAdmin = accountManager->verifyAdmin(aPlayer->getUser());
+    bool editMode = aPlayer->isEditMode();
+
+    // read the versions before parsing, so a change during the parse is detected later
+    aMessage.key = parser::ParseCache::Key(std::string(), aPlayer->getLexicalData(), anArea->getLexicalData(), isAdmin, editMode);
+    aMessage.results = parser::TextParser::parse(aMessage.message, aPlayer->getLexicalData(), anArea->getLexicalData(), isAdmin, editMode, aPlayer->getParseCache());
+    aMessage.parsed = true;
+}
+
 // check cooldown, move creatures, attack players (randomly), update health and special points
 bool GameLogic::updateCreatures(){
     bool inCombat = false;
     Player *aPlayer = nullptr;
-    std::vector<Creature*> allCreatures = manager->getCreatures();
+    EpochManager::Guard objectGuard = manager->protectObjects();
+    std::shared_ptr<const std::vector<Creature*>> allCreatures = manager->getCreaturesView();
     Area *location = nullptr;
     Area *playerLocation = nullptr;
     std::vector<Character*> characters;
@@ -527,8 +616,9 @@ bool GameLogic::updateCreatures(){
     Exit *anExit = nullptr;
     int cooldown = 0;
     bool moved = false;
+    std::vector<int> regenSlots;
 
-    for (auto creature : allCreatures){
+    for (auto creature : *allCreatures){
         players.clear();
         characters.clear();
         exits.clear();
@@ -602,6 +692,7 @@ bool GameLogic::updateCreatures(){
                                 // move creature
                                 moved = true;
                                 exits[exitChoice - 1]->go(nullptr, nullptr, creature, &effects);
+                                journalObject(creature);
                                 messageAreaPlayers(nullptr, "A creature named " + creature->getName() + " leaves the area.", location);
                                 messageAreaPlayers(nullptr, "A creature named " + creature->getName() + " enters the area.", exits[exitChoice - 1]->getConnectArea());
                             } else {
@@ -644,6 +735,7 @@ bool GameLogic::updateCreatures(){
                         if (anExit != nullptr){
                             // move creature
                             anExit->go(nullptr, nullptr, creature, &effects);
+                            journalObject(creature);
                             messageAreaPlayers(nullptr, "A creature named " + creature->getName() + " leaves the area.", location);
                             messageAreaPlayers(nullptr, "A creature named " + creature->getName() + " enters the area.", anExit->getConnectArea());
 
@@ -667,11 +759,13 @@ bool GameLogic::updateCreatures(){
         }
 
         if (creature->getCurrentHealth() != 0){
-            // update health and special points
-            creature->regen();
+            regenSlots.push_back(creature->getCombatSlot());
         }
     }
 
+    // update health and special points of all living creatures in one pass
+    CombatStore::regen(regenSlots, std::time(nullptr));
+
     return true;
 }
 
@@ -706,7 +800,8 @@ void GameLogic::creatureAttack(Creature *aCreature, Player *aPlayer){
 
 // check cooldown, check command queue, otherwise default attack, update health and special points
 bool GameLogic::updatePlayersInCombat(){
-    std::vector<Player*> allPlayers = manager->getPlayersPtrs();
+    EpochManager::Guard objectGuard = manager->protectObjects();
+    std::shared_ptr<const std::vector<Player*>> allPlayers = manager->getPlayersView();
     Creature *aCreature = nullptr;
     std::vector<EffectType> effects;
     bool inCombat;
@@ -715,8 +810,9 @@ bool GameLogic::updatePlayersInCombat(){
     std::vector<Item*> weapons;
     SpecialSkill *aSkill = nullptr;
     size_t weaponChoice;
+    std::vector<int> regenSlots;
 
-    for (auto player : allPlayers){
+    for (auto player : *allPlayers){
         aCreature = nullptr;
         weapons.clear();
 
@@ -760,10 +856,13 @@ bool GameLogic::updatePlayersInCombat(){
                 }
             }
         } 
-        // update health and special points
-        player->regen();
+        regenSlots.push_back(player->getCombatSlot());
     }
 
+    // update health and special points of all players in one pass, including
+    // players with no health
+    CombatStore::regen(regenSlots, std::time(nullptr), false);
+
     return true;
 }
 
@@ -779,7 +878,15 @@ bool GameLogic::loadPlayer(Player *aPlayer, int fileDescriptor){
 
 
 bool GameLogic::hibernatePlayer(Player *aPlayer){
+    gamedata::DataManager dm;
+
     if (aPlayer != nullptr){
+        // write just this player's progress to its own file, and to the journal
+        // so that the journal replays it after any older records of the player
+        if (!currentFilename.empty()){
+            dm.savePlayer(currentFilename, aPlayer);
+            journalPlayer(aPlayer);
+        }
         aPlayer->setActive(false);
         aPlayer->getLocation()->removeCharacter(aPlayer);
         manager->hibernatePlayer(aPlayer->getFileDescriptor());
@@ -791,6 +898,440 @@ bool GameLogic::hibernatePlayer(Player *aPlayer){
 }
 
 
+bool GameLogic::saveAndCompact(const std::string &fileName){
+    std::lock_guard<std::mutex> residencyLock(playerResidencyMutex);
+    gamedata::DataManager dm;
+
+    // zone files belong to the current file, so a new file needs every zone
+    if (fileName != currentFilename){
+        pageInAllZones();
+    }
+    std::string journalName = gamedata::DataManager::getJournalFilename(fileName);
+    bool sameJournal = journal->isOpen() && (journal->getFilename() == journalName);
+    long mark = -1;
+
+    if (sameJournal){
+        mark = journal->checkpoint();
+    }
+
+    bool success = dm.saveGame(fileName, manager, startArea->getID());
+    if (success){
+        // saving under a new name starts that file's journal from scratch
+        if (!sameJournal && journal->open(journalName)){
+            mark = journal->checkpoint();
+        }
+        // player files written before the save must not outlive it
+        gamedata::DataManager::waitForPlayerSaves();
+        journal->compact(mark);
+    }
+
+    return success;
+}
+
+
+void GameLogic::setPlayerEvictionTimeout(int seconds){
+    playerEvictionTimeout = seconds;
+}
+
+
+int GameLogic::evictIdlePlayers(){
+    gamedata::DataManager dm;
+    std::vector<Item*> inventory;
+    std::vector<Item*> contents;
+    bool isReward;
+    int numEvicted = 0;
+
+    // without a game file there is nowhere to load evicted players from
+    if ((playerEvictionTimeout < 0) || currentFilename.empty()){
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> residencyLock(playerResidencyMutex);
+
+    for (auto player : manager->getIdlePlayers(playerEvictionTimeout)){
+        // collect the inventory, including the contents of containers
+        inventory.clear();
+        for (auto item : player->getInventory()){
+            inventory.push_back(item.second);
+        }
+        for (size_t i = 0; i < inventory.size(); i++){
+            if (inventory[i]->getObjectType() == ObjectType::CONTAINER){
+                contents = static_cast<Container*>(inventory[i])->getAllContents();
+                inventory.insert(inventory.end(), contents.begin(), contents.end());
+            }
+        }
+
+        // quests hold pointers to their reward items, so those players stay
+        isReward = false;
+        for (auto item : inventory){
+            if (!manager->getQuestsByRewardItem(item).empty()){
+                isReward = true;
+            }
+        }
+        if (isReward){
+            continue;
+        }
+
+        if (dm.savePlayer(currentFilename, player)){
+            journalPlayer(player);
+
+            // nothing may keep pointing at the player once it is freed
+            player->setInConversation(nullptr);
+            player->setInCombat(nullptr);
+            for (auto creature : *manager->getCreaturesView()){
+                if (creature->getInCombat() == player){
+                    creature->setInCombat(nullptr);
+                }
+            }
+
+            // the inventory aliases are registered once for each item and once
+            // for the player's lexical data, so drop the player's copy first
+            player->clearLexicalData();
+
+            // remove contained items before the items that contain them
+            for (auto it = inventory.rbegin(); it != inventory.rend(); ++it){
+                manager->removeObject(*it, -1);
+            }
+            manager->removeObject(player, -1);
+            numEvicted++;
+        }
+    }
+
+    return numEvicted;
+}
+
+
+void GameLogic::setZoneEvictionTimeout(int seconds){
+    zoneEvictionTimeout = seconds;
+}
+
+
+int GameLogic::evictIdleZones(){
+    gamedata::DataManager dm;
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    std::map<int, Area*> candidates;
+    std::vector<InteractiveNoun*> contents;
+    std::vector<Area*> zone;
+    std::vector<int> zoneAreaIds;
+    Area *anArea = nullptr;
+    Area *nextArea = nullptr;
+    bool canEvict;
+    int numEvicted = 0;
+
+    // without a game file there is nowhere to page zones out to
+    if ((zoneEvictionTimeout < 0) || currentFilename.empty()){
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> zoneLock(zoneMutex);
+
+    // find the loaded areas that have been empty long enough
+    for (auto area : *manager->getView<Area>()){
+        if ((pagedAreaZones.count(area->getID()) == 1) || (area == startArea)){
+            continue;
+        }
+
+        canEvict = true;
+        for (auto character : area->getCharacters()){
+            if ((character->getObjectType() == ObjectType::PLAYER) || (character->getInCombat() != nullptr)){
+                canEvict = false;
+            }
+        }
+        if ((!canEvict) || (areaLastOccupied.count(area->getID()) == 0)){
+            areaLastOccupied[area->getID()] = now;
+            continue;
+        }
+        if ((now - areaLastOccupied[area->getID()]) < std::chrono::seconds(zoneEvictionTimeout)){
+            continue;
+        }
+
+        // quests hold pointers to their reward items, so those items stay
+        contents.clear();
+        getZoneContents(area, contents);
+        for (auto object : contents){
+            if (((object->getObjectType() == ObjectType::ITEM) || (object->getObjectType() == ObjectType::CONTAINER)) && !manager->getQuestsByRewardItem(static_cast<Item*>(object)).empty()){
+                canEvict = false;
+            }
+        }
+        if (canEvict){
+            candidates[area->getID()] = area;
+        }
+    }
+
+    // group connected candidate areas into zones and page each one out
+    while (!candidates.empty()){
+        zone.clear();
+        zone.push_back(candidates.begin()->second);
+        candidates.erase(candidates.begin());
+        for (size_t i = 0; (i < zone.size()) && (zone.size() < ZONE_SIZE); i++){
+            for (auto exit : zone[i]->getExits()){
+                nextArea = exit->getConnectArea();
+                if ((zone.size() < ZONE_SIZE) && (nextArea != nullptr) && (candidates.erase(nextArea->getID()) == 1)){
+                    zone.push_back(nextArea);
+                }
+            }
+        }
+
+        // nobody can enter while zoneMutex is held, but check again that
+        // the zone is still empty right before anything is removed
+        canEvict = true;
+        for (auto area : zone){
+            for (auto character : area->getCharacters()){
+                if ((character->getObjectType() == ObjectType::PLAYER) || (character->getInCombat() != nullptr)){
+                    canEvict = false;
+                }
+            }
+        }
+        if (!canEvict){
+            for (auto area : zone){
+                areaLastOccupied[area->getID()] = now;
+            }
+            continue;
+        }
+
+        contents.clear();
+        zoneAreaIds.clear();
+        for (auto area : zone){
+            getZoneContents(area, contents);
+            zoneAreaIds.push_back(area->getID());
+        }
+
+        // the zone is named after its first area
+        if (!dm.saveZone(currentFilename, zoneAreaIds[0], zone, contents)){
+            std::cerr << "Failed to page out zone " << zoneAreaIds[0] << std::endl;
+            continue;
+        }
+        for (auto object : contents){
+            journalRemoval(object);
+        }
+
+        // detach everything from the areas before anything is deleted
+        for (auto object : contents){
+            switch (object->getObjectType()){
+                case ObjectType::EXIT:
+                    anArea = static_cast<Exit*>(object)->getLocation();
+                    anArea->removeExit(static_cast<Exit*>(object));
+                    break;
+                case ObjectType::FEATURE:
+                    anArea = static_cast<Feature*>(object)->getLocation();
+                    anArea->removeFeature(static_cast<Feature*>(object));
+                    break;
+                case ObjectType::CREATURE:
+                    anArea = static_cast<Creature*>(object)->getLocation();
+                    anArea->removeCharacter(static_cast<Creature*>(object));
+                    break;
+                case ObjectType::ITEM:
+                case ObjectType::CONTAINER:
+                    if (static_cast<Item*>(object)->getPosition() == ItemPosition::GROUND){
+                        anArea = static_cast<Area*>(static_cast<Item*>(object)->getLocation());
+                        anArea->removeItem(static_cast<Item*>(object));
+                    }
+                    break;
+                default:
+                    break;
+            }
+        }
+        for (auto object : contents){
+            manager->removeObject(object, -1);
+        }
+
+        pagedZones[zoneAreaIds[0]] = zoneAreaIds;
+        for (auto areaId : zoneAreaIds){
+            pagedAreaZones[areaId] = zoneAreaIds[0];
+            areaLastOccupied.erase(areaId);
+        }
+        numEvicted++;
+    }
+
+    return numEvicted;
+}
+
+
+void GameLogic::getZoneContents(Area *anArea, std::vector<InteractiveNoun*> &contents){
+    std::vector<Item*> items = anArea->getItems();
+    std::vector<Item*> containerContents;
+
+    for (auto exit : anArea->getExits()){
+        contents.push_back(exit);
+    }
+    for (auto feature : anArea->getFeatures()){
+        contents.push_back(feature);
+    }
+    for (auto character : anArea->getCharacters()){
+        if (character->getObjectType() == ObjectType::CREATURE){
+            contents.push_back(character);
+            for (auto item : character->getInventory()){
+                items.push_back(item.second);
+            }
+        }
+    }
+
+    // include the contents of containers, however deeply nested
+    for (size_t i = 0; i < items.size(); i++){
+        if (items[i]->getObjectType() == ObjectType::CONTAINER){
+            containerContents = static_cast<Container*>(items[i])->getAllContents();
+            items.insert(items.end(), containerContents.begin(), containerContents.end());
+        }
+    }
+    contents.insert(contents.end(), items.begin(), items.end());
+}
+
+
+bool GameLogic::pageInZone(Area *anArea){
+    gamedata::DataManager dm;
+    std::vector<InteractiveNoun*> loaded;
+
+    if (anArea == nullptr){
+        return false;
+    }
+
+    auto found = pagedAreaZones.find(anArea->getID());
+    if (found == pagedAreaZones.end()){
+        return false;
+    }
+    int zoneId = found->second;
+
+    bool success = dm.loadZone(currentFilename, zoneId, manager, loaded);
+    if (success){
+        // the journal takes over from the zone file once the records are durable
+        for (auto object : loaded){
+            journalObject(object);
+        }
+        if (journal->isOpen()){
+            journal->sync();
+        }
+        dm.deleteZone(currentFilename, zoneId);
+    } else {
+        std::cerr << "Failed to page in zone " << zoneId << std::endl;
+    }
+
+    // don't retry a zone that can't be loaded on every move
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    for (auto areaId : pagedZones[zoneId]){
+        pagedAreaZones.erase(areaId);
+        areaLastOccupied[areaId] = now;
+    }
+    pagedZones.erase(zoneId);
+
+    return success;
+}
+
+
+void GameLogic::pageInAllZones(){
+    std::vector<int> zoneIds;
+
+    std::lock_guard<std::mutex> zoneLock(zoneMutex);
+    for (auto zone : pagedZones){
+        zoneIds.push_back(zone.first);
+    }
+
+    // every zone contains the area it is named after
+    for (auto zoneId : zoneIds){
+        pageInZone(static_cast<Area*>(manager->getPointer(zoneId)));
+    }
+}
+
+
+void GameLogic::journalObject(InteractiveNoun *anObject){
+    if ((anObject != nullptr) && journal->isOpen()){
+        journal->recordObject(anObject);
+    }
+}
+
+
+void GameLogic::journalRemoval(InteractiveNoun *anObject){
+    if ((anObject != nullptr) && journal->isOpen()){
+        journal->recordRemoval(anObject);
+    }
+}
+
+
+void GameLogic::journalInventory(Character *aCharacter){
+    if (aCharacter != nullptr){
+        for (auto item : aCharacter->getInventory()){
+            journalObject(item.second);
+        }
+    }
+}
+
+
+void GameLogic::journalPlayer(Player *aPlayer){
+    std::vector<Item*> items;
+    std::vector<Item*> contents;
+
+    if (aPlayer != nullptr){
+        journalObject(aPlayer);
+        for (auto item : aPlayer->getInventory()){
+            items.push_back(item.second);
+        }
+        for (size_t i = 0; i < items.size(); i++){
+            if (items[i]->getObjectType() == ObjectType::CONTAINER){
+                contents = static_cast<Container*>(items[i])->getAllContents();
+                items.insert(items.end(), contents.begin(), contents.end());
+            }
+        }
+        for (auto item : items){
+            journalObject(item);
+        }
+    }
+}
+
+
+void GameLogic::journalCommand(Player *aPlayer, CommandEnum aCommand, InteractiveNoun *firstParam, InteractiveNoun *secondParam){
+    switch (aCommand){
+        case CommandEnum::TAKE:
+        case CommandEnum::PUT:
+        case CommandEnum::DROP:
+        case CommandEnum::EQUIP:
+        case CommandEnum::UNEQUIP:
+        case CommandEnum::QUIT:
+        case CommandEnum::GO:
+        case CommandEnum::MOVE:
+        case CommandEnum::USE_SKILL:
+        case CommandEnum::READ:
+        case CommandEnum::BREAK:
+        case CommandEnum::CLIMB:
+        case CommandEnum::TURN:
+        case CommandEnum::PUSH:
+        case CommandEnum::PULL:
+        case CommandEnum::EAT:
+        case CommandEnum::DRINK:
+        case CommandEnum::WARP:
+        case CommandEnum::EDIT_WIZARD:
+            journalObject(aPlayer);
+            journalObject(firstParam);
+            journalObject(secondParam);
+            break;
+        case CommandEnum::TRANSFER:
+        case CommandEnum::TALK:
+            // completing a quest step can change the quest list and add a reward item
+            journalObject(aPlayer);
+            journalObject(firstParam);
+            journalObject(secondParam);
+            journalInventory(aPlayer);
+            break;
+        case CommandEnum::BUY:
+        case CommandEnum::SELL:
+            journalObject(aPlayer);
+            journalObject(firstParam);
+            journalObject(aPlayer->getInConversation());
+            break;
+        case CommandEnum::EDIT_ATTRIBUTE:
+            // no object means the current area was edited
+            if (firstParam == nullptr){
+                journalObject(aPlayer->getLocation());
+            } else {
+                journalObject(firstParam);
+            }
+            break;
+        default:
+            // the remaining commands either change nothing that is saved or
+            // journal their own changes
+            break;
+    }
+}
+
+
 int GameLogic::rollDice(int numSides, int numDice){
     int diceTotal = 0;
 
@@ -887,6 +1428,7 @@ bool GameLogic::createArea(Player *aPlayer){
     }
     manager->addObject(newArea, -1);
 
+    journalObject(newArea);
     messagePlayer(aPlayer, "You have created a new area. The ID of the new area is " + std::to_string(newArea->getID()) + ".");
 
     return true;
@@ -926,6 +1468,7 @@ bool GameLogic::createArmorType(Player *aPlayer){
     }
     manager->addObject(newArmorType, -1);
 
+    journalObject(newArmorType);
     messagePlayer(aPlayer, "You have created a new armor type. The ID of the new armor type is " + std::to_string(newArmorType->getID()) + ".");
 
     return true;
@@ -1002,6 +1545,7 @@ bool GameLogic::createContainer(Player *aPlayer){
         }
     }
     
+    journalObject(newContainer);
     messagePlayer(aPlayer, "You have created a new container. The ID of the new container is " + std::to_string(newContainer->getID()) + ".");
 
     return true;
@@ -1047,6 +1591,7 @@ bool GameLogic::createCreature(Player *aPlayer){
     aLocation->addCharacter(newCreature);
     messageAreaPlayers(nullptr, "A creature named " + name + " appears out of nowhere.", aLocation);
 
+    journalObject(newCreature);
     messagePlayer(aPlayer, "You have created a new creature. The ID of the new creature is " + std::to_string(newCreature->getID()) + ".");
 
     return true;
@@ -1088,6 +1633,7 @@ bool GameLogic::createCreatureType(Player *aPlayer){
     }
     manager->addObject(newCreatureType, -1);
 
+    journalObject(newCreatureType);
     messagePlayer(aPlayer, "You have created a new creature type. The ID of the new creature type is " + std::to_string(newCreatureType->getID()) + ".");
 
     return true;
@@ -1130,6 +1676,7 @@ bool GameLogic::createExit(Player *aPlayer){
     location->addExit(newExit);
     messageAreaPlayers(nullptr, newExit->getDirectionString() + " you see " + description + " appear out of nowhere.", location);
     
+    journalObject(newExit);
     messagePlayer(aPlayer, "You have created a new exit. The ID of the new exit is " + std::to_string(newExit->getID()) + ".");
 
     return true;
@@ -1172,6 +1719,7 @@ bool GameLogic::createFeature(Player *aPlayer){
     location->addFeature(newFeature);
     messageAreaPlayers(nullptr, "You see a " + name + " appear out of nowhere " + placement + ".", location);
 
+    journalObject(newFeature);
     messagePlayer(aPlayer, "You have created a new feature. The ID of the new feature is " + std::to_string(newFeature->getID()) + ".");
 
     return true;
@@ -1246,6 +1794,7 @@ bool GameLogic::createItem(Player *aPlayer){
         }
     }
 
+    journalObject(newItem);
     messagePlayer(aPlayer, "You have created a new item. The ID of the new item is " + std::to_string(newItem->getID()) + ".");
 
     return true;
@@ -1281,6 +1830,7 @@ bool GameLogic::createItemType(Player *aPlayer){
     }
     manager->addObject(newItemType, -1);
 
+    journalObject(newItemType);
     messagePlayer(aPlayer, "You have created a new item type. The ID of the new item type is " + std::to_string(newItemType->getID()) + ".");
 
     return true;
@@ -1318,6 +1868,7 @@ bool GameLogic::createNonCombatant(Player *aPlayer){
     aLocation->addCharacter(newNonCombatant);
     messageAreaPlayers(nullptr, "A person named " + name + " appears out of nowhere.", aLocation);
 
+    journalObject(newNonCombatant);
     messagePlayer(aPlayer, "You have created a new non-combatant. The ID of the new non-combatant is " + std::to_string(newNonCombatant->getID()) + ".");
 
     return true;
@@ -1364,6 +1915,7 @@ bool GameLogic::createPlayerClass(Player *aPlayer){
     }
     manager->addObject(newPlayerClass, -1);
 
+    journalObject(newPlayerClass);
     messagePlayer(aPlayer, "You have created a new player class. The ID of the new player class is " + std::to_string(newPlayerClass->getID()) + ".");
 
     return true;
@@ -1395,6 +1947,7 @@ bool GameLogic::createQuest(Player *aPlayer){
     }
     manager->addObject(newQuest, -1);
 
+    journalObject(newQuest);
     messagePlayer(aPlayer, "You have created a new quest. The ID of the new quest is " + std::to_string(newQuest->getID()) + ".");
 
     return true;
@@ -1420,8 +1973,10 @@ bool GameLogic::createQuestStep(Player *aPlayer){
     anItemType = getItemTypeParameter(aPlayer, "fetch item type");
     giver = getNonCombatantParameter(aPlayer, "giver", aQuest);
     giver->setQuest(aQuest);
+    manager->updateIndexes(giver);
     receiver = getNonCombatantParameter(aPlayer, "receiver", aQuest);
     receiver->setQuest(aQuest);
+    manager->updateIndexes(receiver);
     completionText = getStringParameter(aPlayer, "completion text");
 
     removePlayerMessageQueue(aPlayer);
@@ -1435,6 +1990,10 @@ bool GameLogic::createQuestStep(Player *aPlayer){
     }
     manager->addObject(newQuestStep, -1);
 
+    journalObject(newQuestStep);
+    journalObject(aQuest);
+    journalObject(giver);
+    journalObject(receiver);
     messagePlayer(aPlayer, "You have created a new quest step. The ID of the new quest step is " + std::to_string(newQuestStep->getID()) + ".");
 
     return true;
@@ -1468,6 +2027,7 @@ bool GameLogic::createSpecialSkill(Player *aPlayer){
     }
     manager->addObject(newSpecialSkill, -1);
 
+    journalObject(newSpecialSkill);
     messagePlayer(aPlayer, "You have created a new special skill. The ID of the new special skill is " + std::to_string(newSpecialSkill->getID()) + ".");
 
     return true;
@@ -1511,6 +2071,7 @@ bool GameLogic::createWeaponType(Player *aPlayer){
     }
     manager->addObject(newWeaponType, -1);
 
+    journalObject(newWeaponType);
     messagePlayer(aPlayer, "You have created a new weapon type. The ID of the new weapon type is " + std::to_string(newWeaponType->getID()) + ".");
 
     return true;
@@ -1523,7 +2084,8 @@ std::string GameLogic::editActionAttribute(Player *aPlayer, InteractiveNoun *obj
     int choice = -1;
     int actionChoice = -1;
     int attributeChoice = -1;
-    std::vector<Action*> allActions = objectToEdit->getAllActions();
+    std::vector<Action*> allActions;
+    std::vector<CommandEnum> allCommands;
     Action *anAction = nullptr;
     bool valid;
     std::string flavorText;
@@ -1543,11 +2105,22 @@ std::string GameLogic::editActionAttribute(Player *aPlayer, InteractiveNoun *obj
         case 1:
             // edit 
             messagePlayer(aPlayer, "Starting Edit Action Wizard...");
+            // the actions may be replaced while waiting for input, so only
+            // their commands are used after the choice is made
+            allActions = objectToEdit->getAllActions();
+            for (auto action : allActions){
+                allCommands.push_back(action->getCommand());
+            }
             actionChoice = getPointerParameter<Action*>(aPlayer, "", allActions, true, "Which action would you like to edit?");
             if (actionChoice == 0){
                 messagePlayer(aPlayer, "Aborting Edit Action Wizard...");
             } else if (actionChoice != -1){
-                anAction = allActions[actionChoice - 1];
+                aCommand = allCommands[actionChoice - 1];
+                anAction = objectToEdit->getAction(aCommand);
+                if (anAction == nullptr){
+                    message = "The action was removed before it could be edited.";
+                    break;
+                }
                 messagePlayer(aPlayer, anAction->getToString());
                 messagePlayer(aPlayer, "Which action attribute would you like to edit? Your options are: [1] valid, [2] flavor text, or [3] effect. Please enter the number that corresponds to your choice.");
                 response = blockingGetMsg(aPlayer);
@@ -1559,8 +2132,27 @@ std::string GameLogic::editActionAttribute(Player *aPlayer, InteractiveNoun *obj
                 }
                 switch (attributeChoice){
                     case 1:
-                        // edit valid
                         valid = getBoolParameter(aPlayer, "valid");
+                        break;
+                    case 2:
+                        flavorText = getStringParameter(aPlayer, "flavor text");
+                        break;
+                    case 3:
+                        anEffect = getEffectTypeParameter(aPlayer, "effect");
+                        break;
+                    default:
+                        break;
+                }
+                // the action may be shared with a copy of the object, which
+                // could have been made while waiting for input
+                anAction = objectToEdit->getEditableAction(aCommand);
+                if (anAction == nullptr){
+                    message = "The action was removed before it could be edited.";
+                    break;
+                }
+                switch (attributeChoice){
+                    case 1:
+                        // edit valid
                         anAction->setValid(valid);
                         message = "Valid is now ";
                         if (valid){
@@ -1571,13 +2163,11 @@ std::string GameLogic::editActionAttribute(Player *aPlayer, InteractiveNoun *obj
                         break;
                     case 2:
                         // edit flavor text
-                        flavorText = getStringParameter(aPlayer, "flavor text");
                         anAction->setFlavorText(flavorText);
                         message = "The flavor text is now " + flavorText + ".";
                         break;
                     case 3:
                         // edit effect
-                        anEffect = getEffectTypeParameter(aPlayer, "effect");
                         anAction->setEffect(anEffect);
                         message = "The effect is now " + effectTypeToString(anEffect) + "."; 
                         break;
@@ -1603,12 +2193,15 @@ std::string GameLogic::editActionAttribute(Player *aPlayer, InteractiveNoun *obj
         case 3:
             // remove
             messagePlayer(aPlayer, "Starting Action Removal Wizard...");
+            allActions = objectToEdit->getAllActions();
+            for (auto action : allActions){
+                allCommands.push_back(action->getCommand());
+            }
             actionChoice = getPointerParameter<Action*>(aPlayer, "", allActions, true, "Which action would you like to remove?");
             if (actionChoice == 0){
                 messagePlayer(aPlayer, "Aborting Action Removal Wizard...");
             } else if (actionChoice != -1){
-                anAction = allActions[actionChoice - 1];
-                objectToEdit->removeAction(anAction->getCommand());
+                objectToEdit->removeAction(allCommands[actionChoice - 1]);
                 message = "The action has been successfully removed.";
             }
             break;
@@ -2587,6 +3180,7 @@ bool GameLogic::editAttributeOfNonCombatant(Player *aPlayer, InteractiveNoun *ob
         } else if (attribute.compare("quest") == 0){
             aQuest = getQuestParameter(aPlayer, "quest", true);
             aNonCombatant->setQuest(aQuest);
+            manager->updateIndexes(aNonCombatant);
             message = "The quest of the non-combatant is now ";
             if (aQuest != nullptr){
                 message += aQuest->getName() + ".";
@@ -2842,6 +3436,7 @@ bool GameLogic::editAttributeOfQuest(Player *aPlayer, InteractiveNoun *objectToE
         } else if (attribute.compare("reward item") == 0){
             rewardItem = getItemParameter(aPlayer, "reward item", true); // may want to change this so they can't choose ANY item ANYWHERE in the game
             aQuest->setRewardItem(rewardItem);
+            manager->updateIndexes(aQuest);
             message = "The reward item of the quest is now ";
             if (rewardItem == nullptr){
                 message += "none.";
@@ -2918,6 +3513,8 @@ bool GameLogic::editAttributeOfQuestStep(Player *aPlayer, InteractiveNoun *objec
             aQuest = oldGiver->getQuest();
             oldGiver->setQuest(nullptr);
             giver->setQuest(aQuest);
+            manager->updateIndexes(oldGiver);
+            manager->updateIndexes(giver);
             aQuestStep->setGiver(giver);
             message = "The giver of the quest step is now " + giver->getName() + ".";
             success = true;
@@ -2927,6 +3524,8 @@ bool GameLogic::editAttributeOfQuestStep(Player *aPlayer, InteractiveNoun *objec
             aQuest = oldReceiver->getQuest();
             oldReceiver->setQuest(nullptr);
             receiver->setQuest(aQuest);
+            manager->updateIndexes(oldReceiver);
+            manager->updateIndexes(receiver);
             aQuestStep->setReceiver(receiver);
             message = "The receiver of the quest step is now " + receiver->getName() + ".";
             success = true;
@@ -3133,7 +3732,6 @@ bool GameLogic::editAttributeOfWeaponType(Player *aPlayer, InteractiveNoun *obje
 
 
 void GameLogic::updateLexicalDataPlayer(Quest *aQuest, SpecialSkill *aSkill, PlayerClass *aClass, std::string oldAlias, std::string newAlias){
-    std::vector<Player*> allPlayers = manager->getGamePlayers();
     std::vector<Player*> affectedPlayers;
     InteractiveNoun *anObject = nullptr;
 
@@ -3141,27 +3739,23 @@ void GameLogic::updateLexicalDataPlayer(Quest *aQuest, SpecialSkill *aSkill, Pla
         anObject = aQuest;
 
         // find all players with this quest
-        for (auto player : allPlayers){
-            if (player->getQuestCurrStep(aQuest).first != -1)
-                affectedPlayers.push_back(player);
-        }
+        affectedPlayers = manager->query<Player>([aQuest](Player *player){
+            return player->getQuestCurrStep(aQuest).first != -1;
+        });
     } else if (aSkill != nullptr){
         anObject = aSkill;
 
         // find all players with this skill
-        for (auto player : allPlayers){
-            if (player->getPlayerClass()->getSpecialSkill() == aSkill)
-                affectedPlayers.push_back(player);
-        }
+        affectedPlayers = manager->query<Player>([aSkill](Player *player){
+            return player->getPlayerClass()->getSpecialSkill() == aSkill;
+        });
     } else if (aClass != nullptr){
         anObject = aClass;
 
         // find all players with this class
-        for (auto player : allPlayers){
-            if (player->getPlayerClass() == aClass){
-                affectedPlayers.push_back(player);
-            }
-        }
+        affectedPlayers = manager->query<Player>([aClass](Player *player){
+            return player->getPlayerClass() == aClass;
+        });
     }
 
     for (auto player : affectedPlayers){
@@ -3902,7 +4496,7 @@ XPTier GameLogic::getXPTierParameter(Player *aPlayer, std::string paramName){
 
 
 template <class aType>
-int GameLogic::getPointerParameter(Player *aPlayer, std::string paramName, std::vector<aType> possibleVals, bool canBeNull, std::string question){
+int GameLogic::getPointerParameter(Player *aPlayer, std::string paramName, const std::vector<aType> &possibleVals, bool canBeNull, std::string question){
     std::string response = "";
     int choice = -1;
     int optionsSize = possibleVals.size();
@@ -3953,13 +4547,13 @@ int GameLogic::getPointerParameter(Player *aPlayer, std::string paramName, std::
 
 Area* GameLogic::getAreaParameter(Player *aPlayer, std::string paramName){
     Area *areaParam = nullptr;
-    std::vector<Area*> allAreas;
+    std::shared_ptr<const std::vector<Area*>> allAreas;
     int choice;
     
-    allAreas = manager->getGameAreas();
-    choice = getPointerParameter<Area*>(aPlayer, paramName, allAreas);
+    allAreas = manager->getView<Area>();
+    choice = getPointerParameter<Area*>(aPlayer, paramName, *allAreas);
     if (choice != -1){
-        areaParam = allAreas[choice - 1];
+        areaParam = (*allAreas)[choice - 1];
     } 
 
     return areaParam;
@@ -3968,13 +4562,13 @@ Area* GameLogic::getAreaParameter(Player *aPlayer, std::string paramName){
 
 SpecialSkill* GameLogic::getSpecialSkillParameter(Player *aPlayer, std::string paramName){
     SpecialSkill *specialSkillParam = nullptr;
-    std::vector<SpecialSkill*> allSpecialSkills;
+    std::shared_ptr<const std::vector<SpecialSkill*>> allSpecialSkills;
     int choice;
     
-    allSpecialSkills = manager->getGameSkills();
-    choice = getPointerParameter<SpecialSkill*>(aPlayer, paramName, allSpecialSkills);
+    allSpecialSkills = manager->getView<SpecialSkill>();
+    choice = getPointerParameter<SpecialSkill*>(aPlayer, paramName, *allSpecialSkills);
     if (choice != -1){
-        specialSkillParam = allSpecialSkills[choice - 1];
+        specialSkillParam = (*allSpecialSkills)[choice - 1];
     } 
 
     return specialSkillParam;
@@ -3983,13 +4577,13 @@ SpecialSkill* GameLogic::getSpecialSkillParameter(Player *aPlayer, std::string p
 
 ItemType* GameLogic::getItemTypeParameter(Player *aPlayer, std::string paramName){
     ItemType *itemTypeParam = nullptr;
-    std::vector<ItemType*> allItemTypes;
+    std::shared_ptr<const std::vector<ItemType*>> allItemTypes;
     int choice;
     
-    allItemTypes = manager->getGameItemTypes();
-    choice = getPointerParameter<ItemType*>(aPlayer, paramName, allItemTypes);
+    allItemTypes = manager->getView<ItemType>();
+    choice = getPointerParameter<ItemType*>(aPlayer, paramName, *allItemTypes);
     if (choice != -1){
-        itemTypeParam = allItemTypes[choice - 1];
+        itemTypeParam = (*allItemTypes)[choice - 1];
     } 
 
     return itemTypeParam;
@@ -3998,31 +4592,31 @@ ItemType* GameLogic::getItemTypeParameter(Player *aPlayer, std::string paramName
 
 InteractiveNoun* GameLogic::getInteractiveNounParameter(Player *aPlayer, std::string paramName){
     std::string response = "";
-    std::vector<Creature*> allCreatures;
-    std::vector<Player*> allPlayers;
-    std::vector<Area*> allAreas;
-    std::vector<NonCombatant*> allNPCs;
-    std::vector<Container*> allContainers;
+    std::shared_ptr<const std::vector<Creature*>> allCreatures;
+    std::shared_ptr<const std::vector<Player*>> allPlayers;
+    std::shared_ptr<const std::vector<Area*>> allAreas;
+    std::shared_ptr<const std::vector<NonCombatant*>> allNPCs;
+    std::shared_ptr<const std::vector<Container*>> allContainers;
     size_t totalSize, index, playerOffset, creatureOffset, npcOffset, containerOffset, unsignChoice;
     std::string message = "What would you like the " + paramName + " to be?";
     InteractiveNoun *param = nullptr;
     int choice;
 
-    allAreas = manager->getGameAreas();
-    allPlayers = manager->getGamePlayers();
-    allCreatures = manager->getCreatures();
-    allNPCs = manager->getGameNPCs();
-    allContainers = manager->getGameContainers();
-    totalSize = allAreas.size() + allPlayers.size() + allCreatures.size() + allNPCs.size() + allContainers.size();
-    playerOffset = allAreas.size();
-    creatureOffset = playerOffset + allPlayers.size();
-    npcOffset = creatureOffset + allCreatures.size();
-    containerOffset = npcOffset + allNPCs.size();
+    allAreas = manager->getView<Area>();
+    allPlayers = manager->getView<Player>();
+    allCreatures = manager->getView<Creature>();
+    allNPCs = manager->getView<NonCombatant>();
+    allContainers = manager->getView<Container>();
+    totalSize = allAreas->size() + allPlayers->size() + allCreatures->size() + allNPCs->size() + allContainers->size();
+    playerOffset = allAreas->size();
+    creatureOffset = playerOffset + allPlayers->size();
+    npcOffset = creatureOffset + allCreatures->size();
+    containerOffset = npcOffset + allNPCs->size();
     index = 0;
 
     message += " Your choices are: ";
-    for (size_t i = 0; i < allAreas.size(); i++){
-        message += "[" + std::to_string(index + 1) + "] " + allAreas[i]->getName();
+    for (size_t i = 0; i < allAreas->size(); i++){
+        message += "[" + std::to_string(index + 1) + "] " + (*allAreas)[i]->getName();
         if (i == (totalSize - 1)){
             message += ". Please enter the number that corresponds to your choice.";
         } else {
@@ -4030,8 +4624,8 @@ InteractiveNoun* GameLogic::getInteractiveNounParameter(Player *aPlayer, std::st
         }
         index++;
     }
-    for (size_t i = 0; i < allPlayers.size(); i++){
-        message += "[" + std::to_string(index + 1) + "] " + allPlayers[i]->getName();
+    for (size_t i = 0; i < allPlayers->size(); i++){
+        message += "[" + std::to_string(index + 1) + "] " + (*allPlayers)[i]->getName();
         if (i == (totalSize - 1)){
             message += ". Please enter the number that corresponds to your choice.";
         } else {
@@ -4039,8 +4633,8 @@ InteractiveNoun* GameLogic::getInteractiveNounParameter(Player *aPlayer, std::st
         }
         index++;
     }
-    for (size_t i = 0; i < allCreatures.size(); i++){
-        message += "[" + std::to_string(index + 1) + "] " + allCreatures[i]->getName();
+    for (size_t i = 0; i < allCreatures->size(); i++){
+        message += "[" + std::to_string(index + 1) + "] " + (*allCreatures)[i]->getName();
         if (i == (totalSize - 1)){
             message += ". Please enter the number that corresponds to your choice.";
         } else {
@@ -4048,8 +4642,8 @@ InteractiveNoun* GameLogic::getInteractiveNounParameter(Player *aPlayer, std::st
         }
         index++;
     }
-    for (size_t i = 0; i < allNPCs.size(); i++){
-        message += "[" + std::to_string(index + 1) + "] " + allNPCs[i]->getName();
+    for (size_t i = 0; i < allNPCs->size(); i++){
+        message += "[" + std::to_string(index + 1) + "] " + (*allNPCs)[i]->getName();
         if (i == (totalSize - 1)){
             message += ". Please enter the number that corresponds to your choice.";
         } else {
@@ -4057,8 +4651,8 @@ InteractiveNoun* GameLogic::getInteractiveNounParameter(Player *aPlayer, std::st
         }
         index++;
     }
-    for (size_t i = 0; i < allContainers.size(); i++){
-        message += "[" + std::to_string(index + 1) + "] " + allContainers[i]->getName();
+    for (size_t i = 0; i < allContainers->size(); i++){
+        message += "[" + std::to_string(index + 1) + "] " + (*allContainers)[i]->getName();
         if (i == (totalSize - 1)){
             message += ". Please enter the number that corresponds to your choice.";
         } else {
@@ -4077,16 +4671,16 @@ InteractiveNoun* GameLogic::getInteractiveNounParameter(Player *aPlayer, std::st
     }
     unsignChoice = choice;
 
-    if (unsignChoice <= allAreas.size()){
-        param = allAreas[unsignChoice - 1];
-    } else if (unsignChoice <= (playerOffset + allPlayers.size())){
-        param = allPlayers[unsignChoice - playerOffset - 1];
-    } else if (unsignChoice <= (creatureOffset + allCreatures.size())){
-        param = allCreatures[unsignChoice - creatureOffset - 1];
-    } else if (unsignChoice <= (npcOffset + allNPCs.size())){
-        param = allNPCs[unsignChoice -  npcOffset - 1];
-    } else if (unsignChoice <= (containerOffset + allContainers.size())){
-        param = allContainers[unsignChoice - containerOffset - 1];
+    if (unsignChoice <= allAreas->size()){
+        param = (*allAreas)[unsignChoice - 1];
+    } else if (unsignChoice <= (playerOffset + allPlayers->size())){
+        param = (*allPlayers)[unsignChoice - playerOffset - 1];
+    } else if (unsignChoice <= (creatureOffset + allCreatures->size())){
+        param = (*allCreatures)[unsignChoice - creatureOffset - 1];
+    } else if (unsignChoice <= (npcOffset + allNPCs->size())){
+        param = (*allNPCs)[unsignChoice -  npcOffset - 1];
+    } else if (unsignChoice <= (containerOffset + allContainers->size())){
+        param = (*allContainers)[unsignChoice - containerOffset - 1];
     } else {
         param = nullptr;
     }
@@ -4097,13 +4691,13 @@ InteractiveNoun* GameLogic::getInteractiveNounParameter(Player *aPlayer, std::st
 
 CreatureType* GameLogic::getCreatureTypeParameter(Player *aPlayer, std::string paramName){
     CreatureType *creatureTypeParam = nullptr;
-    std::vector<CreatureType*> allCreatureTypes;
+    std::shared_ptr<const std::vector<CreatureType*>> allCreatureTypes;
     int choice;
     
-    allCreatureTypes = manager->getGameCreatureTypes();
-    choice = getPointerParameter<CreatureType*>(aPlayer, paramName, allCreatureTypes);
+    allCreatureTypes = manager->getView<CreatureType>();
+    choice = getPointerParameter<CreatureType*>(aPlayer, paramName, *allCreatureTypes);
     if (choice != -1){
-        creatureTypeParam = allCreatureTypes[choice - 1];
+        creatureTypeParam = (*allCreatureTypes)[choice - 1];
     } 
 
     return creatureTypeParam;
@@ -4112,15 +4706,15 @@ CreatureType* GameLogic::getCreatureTypeParameter(Player *aPlayer, std::string p
 
 Quest* GameLogic::getQuestParameter(Player *aPlayer, std::string paramName, bool canBeNull){
     Quest *questParam = nullptr;
-    std::vector<Quest*> allQuests;
+    std::shared_ptr<const std::vector<Quest*>> allQuests;
     int choice;
     
-    allQuests = manager->getGameQuests();
-    choice = getPointerParameter<Quest*>(aPlayer, paramName, allQuests, canBeNull);
+    allQuests = manager->getView<Quest>();
+    choice = getPointerParameter<Quest*>(aPlayer, paramName, *allQuests, canBeNull);
     if (choice == 0){
         questParam = nullptr;
     } else if (choice != -1){
-        questParam = allQuests[choice - 1];
+        questParam = (*allQuests)[choice - 1];
     } 
 
     return questParam;
@@ -4129,13 +4723,13 @@ Quest* GameLogic::getQuestParameter(Player *aPlayer, std::string paramName, bool
 
 PlayerClass* GameLogic::getPlayerClassParameter(Player *aPlayer, std::string paramName){
     PlayerClass *playerClassParam = nullptr;
-    std::vector<PlayerClass*> allPlayerClasses;
+    std::shared_ptr<const std::vector<PlayerClass*>> allPlayerClasses;
     int choice;
     
-    allPlayerClasses = manager->getPlayerClasses();
-    choice = getPointerParameter<PlayerClass*>(aPlayer, paramName, allPlayerClasses);
+    allPlayerClasses = manager->getView<PlayerClass>();
+    choice = getPointerParameter<PlayerClass*>(aPlayer, paramName, *allPlayerClasses);
     if (choice != -1){
-        playerClassParam = allPlayerClasses[choice - 1];
+        playerClassParam = (*allPlayerClasses)[choice - 1];
     } 
 
     return playerClassParam;
@@ -4144,15 +4738,15 @@ PlayerClass* GameLogic::getPlayerClassParameter(Player *aPlayer, std::string par
 
 Item* GameLogic::getItemParameter(Player *aPlayer, std::string paramName, bool canBeNull){
     Item *itemParam = nullptr;
-    std::vector<Item*> allItems;
+    std::shared_ptr<const std::vector<Item*>> allItems;
     int choice;
     
-    allItems = manager->getGameItems();
-    choice = getPointerParameter<Item*>(aPlayer, paramName, allItems, canBeNull);
+    allItems = manager->getView<Item>();
+    choice = getPointerParameter<Item*>(aPlayer, paramName, *allItems, canBeNull);
     if (choice == 0){
         itemParam = nullptr;
     } else if (choice != -1){
-        itemParam = allItems[choice - 1];
+        itemParam = (*allItems)[choice - 1];
     } 
 
     return itemParam;
@@ -4164,20 +4758,18 @@ NonCombatant* GameLogic::getNonCombatantParameter(Player *aPlayer, std::string p
     std::vector<NonCombatant*> allNonCombatants, availableNPCs;
     int choice;
     
-    allNonCombatants = manager->getGameNPCs();
-
     if (aQuest != nullptr){
-        for (auto NPC : allNonCombatants){
-            if (NPC->getQuest() == aQuest){
-                if (aQuest->isGiverOrReceiver(NPC) == nullptr){
-                    availableNPCs.push_back(NPC);
-                }
-            } else if (NPC->getQuest() == nullptr){
+        for (auto NPC : manager->getNPCsByQuest(aQuest)){
+            if (aQuest->isGiverOrReceiver(NPC) == nullptr){
                 availableNPCs.push_back(NPC);
             }
         }
+        for (auto NPC : manager->getNPCsByQuest(nullptr)){
+            availableNPCs.push_back(NPC);
+        }
         choice = getPointerParameter<NonCombatant*>(aPlayer, paramName, availableNPCs);
     } else {
+        allNonCombatants = manager->getGameNPCs();
         choice = getPointerParameter<NonCombatant*>(aPlayer, paramName, allNonCombatants);
     }
     if (choice != -1){
@@ -4309,6 +4901,7 @@ void GameLogic::checkEndCombat(Player *aPlayer, Creature *aCreature){
     std::string message = "";
     int xp = 0;
     Area *deathLocation = nullptr;
+    std::vector<std::pair<EquipmentSlot, Item*>> droppedItems;
 
     if ((aPlayer != nullptr) && (aCreature != nullptr)){
         if (aCreature->getCurrentHealth() == 0){
@@ -4334,7 +4927,13 @@ void GameLogic::checkEndCombat(Player *aPlayer, Creature *aCreature){
             messagePlayer(aPlayer, message);
 
             // remove all items from creature
+            droppedItems = aCreature->getInventory();
             aCreature->removeAllAndCopyFromInventory(manager);
+            journalObject(aPlayer);
+            for (auto item : droppedItems){
+                journalObject(item.second);
+            }
+            journalInventory(aCreature);
 
             // remove creature from area
             deathLocation = aCreature->getLocation();
@@ -4355,13 +4954,18 @@ void GameLogic::checkEndCombat(Player *aPlayer, Creature *aCreature){
 bool GameLogic::checkPlayerDeath(Player *aPlayer){
     bool died = false;
     Area *deathLocation = nullptr;
+    std::vector<std::pair<EquipmentSlot, Item*>> droppedItems;
 
     if (aPlayer->getCurrentHealth() == 0){
         //player dies
         messagePlayer(aPlayer, "You died...");
 
         // remove all items from player
+        droppedItems = aPlayer->getInventory();
         aPlayer->removeAllFromInventory();
+        for (auto item : droppedItems){
+            journalObject(item.second);
+        }
 
         // remove player from area
         deathLocation = aPlayer->getLocation();
@@ -4384,8 +4988,12 @@ void GameLogic::respawn(Player* aPlayer, Creature *aCreature){
     if (aPlayer != nullptr){
         // move player to respawn location
         spawnLocation = aPlayer->getSpawnLocation();
+        std::unique_lock<std::mutex> zoneLock(zoneMutex);
+        pageInZone(spawnLocation);
         spawnLocation->addCharacter(aPlayer);
+        zoneLock.unlock();
         aPlayer->respawn();
+        journalObject(aPlayer);
 
         // message players
         messageAreaPlayers(aPlayer, "A player named " + aPlayer->getName() + " appears freshly reborn in front of you. They look a little confused.", spawnLocation);
@@ -4395,6 +5003,7 @@ void GameLogic::respawn(Player* aPlayer, Creature *aCreature){
         spawnLocation = aCreature->getSpawnLocation();
         spawnLocation->addCharacter(aCreature);
         aCreature->respawn();
+        journalObject(aCreature);
 
         // message players
         messageAreaPlayers(nullptr, "A creature named " + aCreature->getName() + " appears freshly reborn in front of you. They look a little confused.", spawnLocation);
@@ -4413,15 +5022,16 @@ bool GameLogic::endConversation(Player *aPlayer){
 
 void GameLogic::handleParseError(Player *aPlayer, parser::ParseResult result){
     printParseResult(result);
+    std::string suggestion = getSuggestion(aPlayer, result);
     if (result.status == parser::ParseStatus::INVALID_VERB){
         // Input string contains invalid verb.
-        messagePlayer(aPlayer, "I don't know what you mean by that.");
+        messagePlayer(aPlayer, "I don't know what you mean by that." + suggestion);
     } else if (result.status == parser::ParseStatus::UNAVAILABLE_VERB){
         // Input string contains valid verb but not in current area.
         messagePlayer(aPlayer, "You can't do that here.");
     } else if (result.status == parser::ParseStatus::INVALID_DIRECT){
         // Input string contains an invalid noun alias in the direct object position.
-        messagePlayer(aPlayer, "I don't know what you mean by that.");
+        messagePlayer(aPlayer, "I don't know what you mean by that." + suggestion);
     } else if (result.status == parser::ParseStatus::UNAVAILABLE_DIRECT){
         // Input string contains a valid noun alias in the direct object position but not in current area.
         messagePlayer(aPlayer, "I don't see that here.");
@@ -4430,13 +5040,28 @@ void GameLogic::handleParseError(Player *aPlayer, parser::ParseResult result){
         messagePlayer(aPlayer, "I don't know what you mean by that.");
     } else if (result.status == parser::ParseStatus::INVALID_INDIRECT){
         // Input string contains an invalid noun alias in the indirect object position.
-        messagePlayer(aPlayer, "I don't know what you mean by that.");
+        messagePlayer(aPlayer, "I don't know what you mean by that." + suggestion);
     } else if (result.status == parser::ParseStatus::UNAVAILABLE_INDIRECT){
         // Input string contains a valid noun alias in the indirect object position but not in current area.
         messagePlayer(aPlayer, "I don't see that here.");
     }
 }
 
+std::string GameLogic::getSuggestion(Player *aPlayer, const parser::ParseResult &result){
+    Area *anArea = aPlayer->getLocation();
+    if (anArea == nullptr){
+        return "";
+    }
+
+    bool isAdmin = accountManager->verifyAdmin(aPlayer->getUser());
+    std::string word = parser::TextParser::getSuggestion(result, aPlayer->getLexicalData(), anArea->getLexicalData(), isAdmin);
+    if (word.empty()){
+        return "";
+    }
+
+    return " Did you mean \"" + word + "\"?";
+}
+
 void GameLogic::printParseResult(parser::ParseResult result){
     std::cout << "Result from parser:\n";
     std::cout << "status = "; 
@@ -4837,6 +5462,16 @@ std::string GameLogic::getMsgFromPlayerQ(Player *aPlayer){
 }
 
 
+void GameLogic::executeGuardedCommand(Player *aPlayer, parser::ParseResult result, EpochManager::Guard objectGuard){
+    executeCommand(aPlayer, result);
+}
+
+
+void GameLogic::handleGuardedParseErrorMult(Player *aPlayer, std::vector<parser::ParseResult> results, EpochManager::Guard objectGuard){
+    handleParseErrorMult(aPlayer, results);
+}
+
+
 bool GameLogic::executeCommand(Player *aPlayer, parser::ParseResult result){
     // Wait for saving to complete before executing any commands
     if (!waitForSaveOrTimeout()) {
@@ -5329,6 +5964,11 @@ bool GameLogic::executeCommand(Player *aPlayer, parser::ParseResult result){
             std::cout << "DEBUG: executeCommand received an INVALID command.\n";
             break;
     }
+
+    if (success){
+        journalCommand(aPlayer, result.command, (param != nullptr) ? param : directObj, indirectObj);
+    }
+
     return success;
 }
 
@@ -5442,6 +6082,11 @@ std::cout << "inside executeCombatCommand\n";
             std::cout << "DEBUG: combat version of executeCommand reached default.\n";
             break;
     }
+
+    if (success){
+        journalCommand(aPlayer, aCommand.commandE, aCommand.firstParam, aCommand.secondParam);
+    }
+
     return success;
 }
 
@@ -6102,16 +6747,21 @@ bool GameLogic::goCommand(Player *aPlayer, InteractiveNoun *param){
         cooldown = 1;
     }
 
+    // the player must not enter an area while its zone is being paged out
+    std::unique_lock<std::mutex> zoneLock(zoneMutex);
     if (param != nullptr){
         message = param->go(aPlayer, nullptr, nullptr, &effects);
         success = true;
     }
     
     if (message.compare("false") == 0){
+        zoneLock.unlock();
         message = "You can't go that way. ";
     } else {
         canGo = true;
         newArea = aPlayer->getLocation();
+        pageInZone(newArea);
+        zoneLock.unlock();
         message += handleEffects(aPlayer, effects);
         messageAreaPlayers(aPlayer, "A player named " + aPlayer->getName() + " leaves the area.", currLocation);
         messageAreaPlayers(aPlayer, "You see a player named " + aPlayer->getName() + " enter the area.", newArea);
@@ -6801,12 +7451,16 @@ bool GameLogic::warpCommand(Player *aPlayer, InteractiveNoun *param){
     Area *currLocation = aPlayer->getLocation();
 
     if ((aPlayer->isEditMode()) && (param != nullptr)){
+        std::unique_lock<std::mutex> zoneLock(zoneMutex);
         message = param->warp(aPlayer, nullptr);
     
         if (message.compare("false") == 0){
+            zoneLock.unlock();
             message = "You can't warp there.";
         } else {
             newArea = aPlayer->getLocation();
+            pageInZone(newArea);
+            zoneLock.unlock();
             message += newArea->getFullDescription(aPlayer);
             messageAreaPlayers(aPlayer, "A player named " + aPlayer->getName() + " leaves the area.", currLocation);
             messageAreaPlayers(aPlayer, "You see a player named " + aPlayer->getName() + " enter the area.", newArea);
@@ -6830,6 +7484,7 @@ bool GameLogic::copyCommand(Player *aPlayer, InteractiveNoun *directObj){
         newObject = directObj->copy();
         if (newObject != nullptr){
             manager->addObject(newObject, -1);
+            journalObject(newObject);
             message = "The " + directObj->getName() + " was copied successfully.";
             message += " The ID of the new object is [" + std::to_string(newObject->getID()) + "].";
             success = true;
@@ -6953,13 +7608,11 @@ bool GameLogic::saveCommand(Player *aPlayer, const std::string &stringParam){
     if (aPlayer->isEditMode()) {
         saving.store(true);
 
-        gamedata::DataManager dm;
-
         if (stringParam.empty()) {
             if (!currentFilename.empty()) {
                 // use current fileName
                 std::cout << "Saving " << currentFilename << std::endl;
-                success = dm.saveGame(currentFilename, manager, startArea->getID());
+                success = saveAndCompact(currentFilename);
                 if (success) accountManager->saveToDisk();
             }
             else {
@@ -6967,7 +7620,7 @@ bool GameLogic::saveCommand(Player *aPlayer, const std::string &stringParam){
             }
         }
         else {
-            success = dm.saveGame(stringParam, manager, startArea->getID());
+            success = saveAndCompact(stringParam);
             if (success) {
                 accountManager->setFileName(stringParam + ".accounts");
                 accountManager->saveToDisk();
@@ -7069,16 +7722,17 @@ bool GameLogic::deleteCommand(Player *aPlayer, InteractiveNoun *directObj){
     Creature *aCreature = nullptr;
     Feature *aFeature = nullptr;
     Exit *anExit = nullptr;
+    std::vector<Item*> movedItems;
 
     if (((aPlayer == nullptr) || (aPlayer->isEditMode())) && (directObj != nullptr)){
         anObjectType = directObj->getObjectType();
         if ((anObjectType == ObjectType::ITEM) || (anObjectType == ObjectType::CONTAINER)){
             // rmeove all references to the item in quests
-            allQuests = manager->getGameQuests();
+            allQuests = manager->getQuestsByRewardItem(static_cast<Item*>(directObj));
             for (auto quest : allQuests){
-                if (quest->getRewardItem()->getID() == directObj->getID()){
-                    quest->setRewardItem(nullptr);
-                }
+                quest->setRewardItem(nullptr);
+                manager->updateIndexes(quest);
+                journalObject(quest);
             }
 
             // remove from containing object
@@ -7099,6 +7753,7 @@ bool GameLogic::deleteCommand(Player *aPlayer, InteractiveNoun *directObj){
             // remove any contained objects
             if (anObjectType == ObjectType::CONTAINER){
                 aContainer = static_cast<Container*>(directObj);
+                movedItems = aContainer->getAllContents();
                 aContainer->removeAll();
             }
 
@@ -7115,6 +7770,9 @@ bool GameLogic::deleteCommand(Player *aPlayer, InteractiveNoun *directObj){
             }
 
             // remove any contained items
+            for (auto item : aCreature->getInventory()){
+                movedItems.push_back(item.second);
+            }
             aCreature->removeAll();
 
             success = true;
@@ -7137,8 +7795,12 @@ bool GameLogic::deleteCommand(Player *aPlayer, InteractiveNoun *directObj){
         }
 
         if (success){
-            manager->removeObject(directObj, -1);
+            for (auto item : movedItems){
+                journalObject(item);
+            }
+            journalRemoval(directObj);
             message = "You deleted the " + directObj->getName() + ".";
+            manager->removeObject(directObj, -1);
         }
     } else {
         message = "You must be in editmode to delete.";
@@ -17,6 +17,8 @@
 #include <mutex>
 #include <utility>
 #include <map>
+#include <vector>
+#include <chrono>
 #include "ObjectType.hpp"
 #include "CommandEnum.hpp"
 #include "ItemPosition.hpp"
@@ -28,6 +30,7 @@
 #include "EquipmentSlot.hpp"
 #include "CharacterSize.hpp"
 #include "Player.hpp"
+#include "EpochManager.hpp"
 
 namespace legacymud { namespace parser {
     struct ParseResult;
@@ -41,6 +44,10 @@ namespace legacymud { namespace account {
     class Account;
 }}
 
+namespace legacymud { namespace gamedata {
+    class Journal;
+}}
+
 namespace legacymud { namespace test {
     class GameLogicShim;
 }}
@@ -57,6 +64,29 @@ class Quest;
 class PlayerClass;
 class Container;
 
+/*!
+ * \brief   Stores a message from a player and the results of parsing it.
+ *
+ * Messages are parsed on the thread that received them. The lexical data
+ * versions in \c key are checked again before the results are used, in
+ * case something in scope changed while the message was queued. Removing
+ * an object changes those versions, so results that point to a removed
+ * object are parsed again instead of used.
+ *
+ * A queued message does not hold an EpochManager::Guard, so any number of
+ * messages can wait in the queue. processInput takes a guard before it
+ * checks the versions and keeps it until the command has been executed.
+ */
+struct ParsedMessage {
+    std::string message;
+    int fileDescriptor;
+    bool parsed;
+    parser::ParseCache::Key key;
+    std::vector<parser::ParseResult> results;
+
+    ParsedMessage() : fileDescriptor(-1), parsed(false) {}
+};
+
 class GameLogic {
     public:
         GameLogic();
@@ -97,6 +127,10 @@ class GameLogic {
         /*!
          * \brief   Processes messages from the message queue.
          * 
+         * This function runs the commands that were already parsed when the
+         * messages were received. A message is only parsed again if the
+         * lexical data in scope has changed since then.
+         * 
          * \param[in] numToProcess  Specifies how many messages to process at a
          *                          time.
          */
@@ -106,7 +140,8 @@ class GameLogic {
          * \brief   Adds a new message into the message queue.
          * 
          * This function adds a new message from the server into the message
-         * queue for later processing.
+         * queue for later processing. Messages for the main queue are parsed
+         * here, on the server thread that received them.
          * 
          * \param[in] message           Specifies the message to add.
          * \param[in] fileDescriptor    Specifies the player that sent the message.
@@ -138,6 +173,48 @@ class GameLogic {
          */
         bool updatePlayersInCombat();
 
+        /*!
+         * \brief   Sets how long a player must be logged out before it is evicted.
+         * 
+         * \param[in] seconds   Specifies the time in seconds, or -1 to keep
+         *                      logged out players in memory indefinitely.
+         */
+        void setPlayerEvictionTimeout(int seconds);
+
+        /*!
+         * \brief   Evicts idle logged out players from memory.
+         * 
+         * This function writes each player that has been logged out for longer
+         * than the eviction timeout to its own file and then removes the player
+         * and its inventory from the game. Evicted players are loaded back from
+         * their files when they log in again.
+         *
+         * \return  Returns an int with the number of players evicted.
+         */
+        int evictIdlePlayers();
+
+        /*!
+         * \brief   Sets how long an area must be empty of players before its zone
+         *          can be paged out.
+         * 
+         * \param[in] seconds   Specifies the time in seconds, or -1 to keep
+         *                      all zones in memory.
+         */
+        void setZoneEvictionTimeout(int seconds);
+
+        /*!
+         * \brief   Pages out zones that have been empty of players.
+         * 
+         * This function groups connected areas that have been empty of players
+         * for longer than the zone eviction timeout into zones, writes the exits,
+         * features, items and creatures of each zone to the zone's own file and
+         * removes them from the game. The areas themselves stay loaded. A zone
+         * is paged back in when a player enters one of its areas.
+         *
+         * \return  Returns an int with the number of zones paged out.
+         */
+        int evictIdleZones();
+
         /*!
          * \brief   Rolls the specifed number of the specified sided dice.
          * 
@@ -165,6 +242,14 @@ class GameLogic {
     private:
         void registerQuestsGOM();
 
+        /*!
+         * \brief   Parses a message for the player that sent it.
+         * 
+         * \param[in,out] aMessage  Specifies the message to parse. The key
+         *                          and results are set if the player was found.
+         */
+        void parseMessage(ParsedMessage &aMessage);
+
         /*!
          * \brief   Loads the specified player into the game.
          * 
@@ -184,7 +269,8 @@ class GameLogic {
          * 
          * This function hibernates the specified player by removing them from the 
          * active game (other players will no longer receive notices about this
-         * player). The player must be loaded before they can play more.
+         * player). The player must be loaded before they can play more. The
+         * player's progress is written to its own file in the background.
          * 
          * \param[in] aPlayer           Specifies the player to hibernate.
          *
@@ -193,6 +279,91 @@ class GameLogic {
          */
         bool hibernatePlayer(Player *aPlayer);
 
+        /*!
+         * \brief   Saves the game and compacts the journal.
+         * 
+         * This function takes a full save of the game to the specified file and
+         * then discards the journal records that the save covers. Saving under
+         * a new filename switches the journal to that file's journal.
+         * 
+         * \param[in] fileName  Specifies the file to save the game to.
+         *
+         * \return  Returns a bool indicating whether or not saving the game
+         *          was successful.
+         */
+        bool saveAndCompact(const std::string &fileName);
+
+        /*!
+         * \brief   Gets the objects in an area that are paged out with its zone.
+         * 
+         * \param[in] anArea        Specifies the area.
+         * \param[out] contents     Receives the area's exits, features, items,
+         *                          creatures and everything those items and
+         *                          creatures hold.
+         */
+        void getZoneContents(Area *anArea, std::vector<InteractiveNoun*> &contents);
+
+        /*!
+         * \brief   Pages in the zone that the specified area belongs to.
+         * 
+         * This function does nothing if the area's zone is already loaded.
+         * The caller must hold zoneMutex until the character entering the
+         * area has been added to it, so that the zone cannot be paged out
+         * again in between.
+         * 
+         * \param[in] anArea        Specifies the area that is being entered.
+         *
+         * \return  Returns a bool indicating whether or not the zone was paged in.
+         */
+        bool pageInZone(Area *anArea);
+
+        /*!
+         * \brief   Pages in every zone that is paged out.
+         */
+        void pageInAllZones();
+
+        /*!
+         * \brief   Records the current state of the specified object in the journal.
+         * 
+         * \param[in] anObject  Specifies the object that was created or changed.
+         */
+        void journalObject(InteractiveNoun *anObject);
+
+        /*!
+         * \brief   Records the removal of the specified object in the journal.
+         * 
+         * \param[in] anObject  Specifies the object that is being deleted.
+         */
+        void journalRemoval(InteractiveNoun *anObject);
+
+        /*!
+         * \brief   Records every item in the specified character's inventory in the journal.
+         * 
+         * \param[in] aCharacter    Specifies the character.
+         */
+        void journalInventory(Character *aCharacter);
+
+        /*!
+         * \brief   Records the specified player and everything it carries in the journal.
+         *
+         * This function is called whenever the player is written to its own file,
+         * so that older journal records of the player cannot overwrite the file
+         * when the journal is replayed.
+         * 
+         * \param[in] aPlayer   Specifies the player that was saved.
+         */
+        void journalPlayer(Player *aPlayer);
+
+        /*!
+         * \brief   Records the objects changed by a successful command in the journal.
+         * 
+         * \param[in] aPlayer       Specifies the player who entered the command.
+         * \param[in] aCommand      Specifies the command that was executed.
+         * \param[in] firstParam    Specifies the direct object of the command, if any.
+         * \param[in] secondParam   Specifies the indirect object of the command, if any.
+         */
+        void journalCommand(Player *aPlayer, CommandEnum aCommand, InteractiveNoun *firstParam, InteractiveNoun *secondParam);
+
         /*!
          * \brief   Creates a new instance of the specified object type.
          * 
@@ -278,7 +449,7 @@ class GameLogic {
         void updateLexicalDataPlayer(Quest *aQuest, SpecialSkill *aSkill, PlayerClass *aClass, std::string oldAlias, std::string newAlias);
 
         template <class aType>
-        int getPointerParameter(Player *aPlayer, std::string paramName, std::vector<aType> possibleVals, bool canBeNull = false, std::string question = "");
+        int getPointerParameter(Player *aPlayer, std::string paramName, const std::vector<aType> &possibleVals, bool canBeNull = false, std::string question = "");
         
         int getIntParameter(Player *aPlayer, std::string paramName, int maxNum = std::numeric_limits<int>::max());
 
@@ -444,6 +615,17 @@ class GameLogic {
          */
         void handleParseError(Player *aPlayer, parser::ParseResult result);
 
+        /*!
+         * \brief   Gets a "did you mean" hint for an invalid verb or noun.
+         * 
+         * \param[in] aPlayer   Specifies the player that sent the messsage.
+         * \param[in] result    Specifies the invalid result received from the parser.
+         *
+         * \return  Returns the hint to append to the error message, or an empty
+         *          string if there is no similar word.
+         */
+        std::string getSuggestion(Player *aPlayer, const parser::ParseResult &result);
+
         /*!
          * \brief   Prints the type, status, command, and unparsed fields of the
          *          specified ParseResult to stdout.
@@ -523,6 +705,26 @@ class GameLogic {
          */
         bool executeCommand(Player *aPlayer, parser::ParseResult result);
 
+        /*!
+         * \brief   Executes the specified command on a command thread.
+         *
+         * \param[in] aPlayer       Specifies the player entering the command.
+         * \param[in] result        Specifies the results from the parser.
+         * \param[in] objectGuard   Specifies the guard that protects the objects
+         *                          in the results until the command is done.
+         */
+        void executeGuardedCommand(Player *aPlayer, parser::ParseResult result, EpochManager::Guard objectGuard);
+
+        /*!
+         * \brief   Handles multiple parse results on a command thread.
+         *
+         * \param[in] aPlayer       Specifies the player that sent the message.
+         * \param[in] results       Specifies the results received from the parser.
+         * \param[in] objectGuard   Specifies the guard that protects the objects
+         *                          in the results until the player chooses one.
+         */
+        void handleGuardedParseErrorMult(Player *aPlayer, std::vector<parser::ParseResult> results, EpochManager::Guard objectGuard);
+
         /*!
          * \brief   Executes the specified command.
          * 
@@ -1114,7 +1316,8 @@ class GameLogic {
          */
         int validateStringNumber(std::string number, int min, int max);
         GameObjectManager *manager;
-        std::queue<std::pair<std::string, int>> messageQueue;
+        gamedata::Journal *journal;
+        std::queue<ParsedMessage> messageQueue;
         std::mutex queueMutex;
         std::map<int, std::pair<std::mutex*, std::queue<std::string>*>> playerMessageQueues;
         std::mutex playerMsgQMutex;
@@ -1122,6 +1325,13 @@ class GameLogic {
         telnet::Server* theServer;
         Area *startArea;
         std::string currentFilename;
+        int playerEvictionTimeout;
+        std::mutex playerResidencyMutex;
+        int zoneEvictionTimeout;
+        std::map<int, std::vector<int>> pagedZones;
+        std::map<int, int> pagedAreaZones;
+        std::map<int, std::chrono::steady_clock::time_point> areaLastOccupied;
+        std::mutex zoneMutex;
 };
 
 }}
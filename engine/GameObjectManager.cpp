@@ -1,7 +1,7 @@
 /*********************************************************************//**
  * \author      Rachel Weissman-Hohler
  * \created     02/01/2017
- * \modified    03/05/2017
+ * \modified    10/19/2026
  * \course      CS467, Winter 2017
  * \file        GameObjectManager.cpp
  *
@@ -22,6 +22,7 @@
 #include "Quest.hpp"
 #include "Item.hpp"
 #include <algorithm>
+#include <cctype>
 
 namespace legacymud { namespace engine {
 
@@ -49,6 +50,7 @@ GameObjectManager::~GameObjectManager(){
     gameCreatures.clear();
     activeGamePlayers.clear();
     inactivePlayers.clear();
+    inactiveSince.clear();
     gamePlayerClasses.clear();
     gameAreas.clear();
     gameSkills.clear();
@@ -58,6 +60,8 @@ GameObjectManager::~GameObjectManager(){
     gameCreatureTypes.clear();
     gameQuests.clear();
     gameItems.clear();
+    questsByRewardItem.clear();
+    npcsByQuest.clear();
 }
 
 
@@ -83,13 +87,22 @@ bool GameObjectManager::addObject(InteractiveNoun *anObject, int FD){
         if (anID >= 0){
             std::unique_lock<std::mutex> gameObjectsLock(gameObjectsMutex);
             gameObjects[anID] = anObject;
+            objectRegistry.setObject(anID, anObject);
+            gameObjectsView.reset();
+            std::unique_lock<std::mutex> indexesLock(indexesMutex);
+            indexObject(anObject);
+            indexesLock.unlock();
             gameObjectsLock.unlock();
             if ((aType == ObjectType::PLAYER) && (FD >= 0)){
                 aPlayer = dynamic_cast<Player*>(anObject);
                 if (aPlayer != nullptr){
                     std::unique_lock<std::mutex> activeGamePlayersLock(activeGamePlayersMutex);
                     activeGamePlayers[FD] = aPlayer;
+                    activeGamePlayersView.reset();
                     activeGamePlayersLock.unlock();
+                    std::unique_lock<std::mutex> gamePlayersViewLock(gamePlayersViewMutex);
+                    gamePlayersView.reset();
+                    gamePlayersViewLock.unlock();
                     success = true;
                 }
             } else if (aType == ObjectType::PLAYER){
@@ -97,7 +110,11 @@ bool GameObjectManager::addObject(InteractiveNoun *anObject, int FD){
                 if (aPlayer != nullptr){
                     std::unique_lock<std::mutex> inactivePlayersLock(inactivePlayersMutex);
                     inactivePlayers[aPlayer->getUser()] = aPlayer;
+                    inactiveSince[aPlayer->getUser()] = std::chrono::steady_clock::now();
                     inactivePlayersLock.unlock();
+                    std::unique_lock<std::mutex> gamePlayersViewLock(gamePlayersViewMutex);
+                    gamePlayersView.reset();
+                    gamePlayersViewLock.unlock();
                     success = true;
                 }
             } else if (aType == ObjectType::CREATURE){
@@ -105,6 +122,7 @@ bool GameObjectManager::addObject(InteractiveNoun *anObject, int FD){
                 if (aCreature != nullptr){
                     std::unique_lock<std::mutex> gameCreaturesLock(gameCreaturesMutex);
                     gameCreatures[anID] = aCreature;
+                    gameCreaturesView.reset();
                     gameCreaturesLock.unlock();
                     success = true;
                 }
@@ -113,6 +131,7 @@ bool GameObjectManager::addObject(InteractiveNoun *anObject, int FD){
                 if (aPlayerClass != nullptr){
                     std::unique_lock<std::mutex> gamePlayerClassesLock(gamePlayerClassesMutex);
                     gamePlayerClasses.push_back(aPlayerClass);
+                    gamePlayerClassesView.reset();
                     gamePlayerClassesLock.unlock();
                     success = true;
                 }
@@ -121,6 +140,7 @@ bool GameObjectManager::addObject(InteractiveNoun *anObject, int FD){
                 if (anArea != nullptr){
                     std::unique_lock<std::mutex> gameAreasLock(gameAreasMutex);
                     gameAreas.push_back(anArea);
+                    gameAreasView.reset();
                     gameAreasLock.unlock();
                     success = true;
                 }
@@ -129,6 +149,7 @@ bool GameObjectManager::addObject(InteractiveNoun *anObject, int FD){
                 if (aSkill != nullptr){
                     std::unique_lock<std::mutex> gameSkillsLock(gameSkillsMutex);
                     gameSkills.push_back(aSkill);
+                    gameSkillsView.reset();
                     gameSkillsLock.unlock();
                     success = true;
                 }
@@ -137,6 +158,7 @@ bool GameObjectManager::addObject(InteractiveNoun *anObject, int FD){
                 if (anItemType != nullptr){
                     std::unique_lock<std::mutex> gameItemTypesLock(gameItemTypesMutex);
                     gameItemTypes.push_back(anItemType);
+                    gameItemTypesView.reset();
                     gameItemTypesLock.unlock();
                     success = true;
                 }
@@ -145,6 +167,7 @@ bool GameObjectManager::addObject(InteractiveNoun *anObject, int FD){
                 if (aNPC != nullptr){
                     std::unique_lock<std::mutex> gameNPCsLock(gameNPCsMutex);
                     gameNPCs.push_back(aNPC);
+                    gameNPCsView.reset();
                     gameNPCsLock.unlock();
                     success = true;
                 }
@@ -153,6 +176,7 @@ bool GameObjectManager::addObject(InteractiveNoun *anObject, int FD){
                 if (aContainer != nullptr){
                     std::unique_lock<std::mutex> gameContainersLock(gameContainersMutex);
                     gameContainers.push_back(aContainer);
+                    gameContainersView.reset();
                     gameContainersLock.unlock();
                     success = true;
                 }
@@ -161,6 +185,7 @@ bool GameObjectManager::addObject(InteractiveNoun *anObject, int FD){
                 if (aCreatureType != nullptr){
                     std::unique_lock<std::mutex> gameCreatureTypesLock(gameCreatureTypesMutex);
                     gameCreatureTypes.push_back(aCreatureType);
+                    gameCreatureTypesView.reset();
                     gameCreatureTypesLock.unlock();
                     success = true;
                 }
@@ -169,6 +194,7 @@ bool GameObjectManager::addObject(InteractiveNoun *anObject, int FD){
                 if (aQuest != nullptr){
                     std::unique_lock<std::mutex> gameQuestsLock(gameQuestsMutex);
                     gameQuests.push_back(aQuest);
+                    gameQuestsView.reset();
                     gameQuestsLock.unlock();
                     success = true;
                 }
@@ -177,6 +203,7 @@ bool GameObjectManager::addObject(InteractiveNoun *anObject, int FD){
                 if (anItem != nullptr){
                     std::unique_lock<std::mutex> gameItemsLock(gameItemsMutex);
                     gameItems.push_back(anItem);
+                    gameItemsView.reset();
                     gameItemsLock.unlock();
                     success = true;
                 }
@@ -213,11 +240,20 @@ bool GameObjectManager::removeObject(InteractiveNoun *anObject, int FD){
         if (anID >= 0){
             std::unique_lock<std::mutex> gameObjectsLock(gameObjectsMutex);
             numRemoved = gameObjects.erase(anID);
+            objectRegistry.setObject(anID, nullptr);
+            gameObjectsView.reset();
+            std::unique_lock<std::mutex> indexesLock(indexesMutex);
+            unindexObject(anObject);
+            indexesLock.unlock();
             gameObjectsLock.unlock();
             if ((aType == ObjectType::PLAYER) && (FD >= 0)){
                 std::unique_lock<std::mutex> activeGamePlayersLock(activeGamePlayersMutex);
                 numRemoved += activeGamePlayers.erase(FD);
+                activeGamePlayersView.reset();
                 activeGamePlayersLock.unlock();
+                std::unique_lock<std::mutex> gamePlayersViewLock(gamePlayersViewMutex);
+                gamePlayersView.reset();
+                gamePlayersViewLock.unlock();
                 if (numRemoved == 2){
                     success = true;
                 }
@@ -226,7 +262,11 @@ bool GameObjectManager::removeObject(InteractiveNoun *anObject, int FD){
                 if (aPlayer != nullptr){
                     std::unique_lock<std::mutex> inactivePlayersLock(inactivePlayersMutex);
                     numRemoved += inactivePlayers.erase(aPlayer->getUser());
+                    inactiveSince.erase(aPlayer->getUser());
                     inactivePlayersLock.unlock();
+                    std::unique_lock<std::mutex> gamePlayersViewLock(gamePlayersViewMutex);
+                    gamePlayersView.reset();
+                    gamePlayersViewLock.unlock();
                     if (numRemoved == 2){
                         success = true;
                     }
@@ -234,6 +274,7 @@ bool GameObjectManager::removeObject(InteractiveNoun *anObject, int FD){
             } else if (aType == ObjectType::CREATURE){
                 std::unique_lock<std::mutex> gameCreaturesLock(gameCreaturesMutex);
                 numRemoved += gameCreatures.erase(anID);
+                gameCreaturesView.reset();
                 gameCreaturesLock.unlock();
                 if (numRemoved == 2){
                     success = true;
@@ -243,7 +284,8 @@ bool GameObjectManager::removeObject(InteractiveNoun *anObject, int FD){
                 std::unique_lock<std::mutex> gamePlayerClassesLock(gamePlayerClassesMutex);
                 size = gamePlayerClasses.size();
                 gamePlayerClasses.erase(std::remove(gamePlayerClasses.begin(), gamePlayerClasses.end(), aPlayerClass), gamePlayerClasses.end());
-                if ((numRemoved == 1) && ((gamePlayerClasses.size() - size) == 1)){
+                gamePlayerClassesView.reset();
+                if ((numRemoved == 1) && ((size - gamePlayerClasses.size()) == 1)){
                     success = true;
                 }
                 gamePlayerClassesLock.unlock();
@@ -252,7 +294,8 @@ bool GameObjectManager::removeObject(InteractiveNoun *anObject, int FD){
                 std::unique_lock<std::mutex> gameAreasLock(gameAreasMutex);
                 size = gameAreas.size();
                 gameAreas.erase(std::remove(gameAreas.begin(), gameAreas.end(), anArea), gameAreas.end());
-                if ((numRemoved == 1) && ((gameAreas.size() - size) == 1)){
+                gameAreasView.reset();
+                if ((numRemoved == 1) && ((size - gameAreas.size()) == 1)){
                     success = true;
                 }
                 gameAreasLock.unlock();
@@ -261,7 +304,8 @@ bool GameObjectManager::removeObject(InteractiveNoun *anObject, int FD){
                 std::unique_lock<std::mutex> gameSkillsLock(gameSkillsMutex);
                 size = gameSkills.size();
                 gameSkills.erase(std::remove(gameSkills.begin(), gameSkills.end(), aSkill), gameSkills.end());
-                if ((numRemoved == 1) && ((gameSkills.size() - size) == 1)){
+                gameSkillsView.reset();
+                if ((numRemoved == 1) && ((size - gameSkills.size()) == 1)){
                     success = true;
                 }
                 gameSkillsLock.unlock();
@@ -270,7 +314,8 @@ bool GameObjectManager::removeObject(InteractiveNoun *anObject, int FD){
                 std::unique_lock<std::mutex> gameItemTypesLock(gameItemTypesMutex);
                 size = gameItemTypes.size();
                 gameItemTypes.erase(std::remove(gameItemTypes.begin(), gameItemTypes.end(), anItemType), gameItemTypes.end());
-                if ((numRemoved == 1) && ((gameItemTypes.size() - size) == 1)){
+                gameItemTypesView.reset();
+                if ((numRemoved == 1) && ((size - gameItemTypes.size()) == 1)){
                     success = true;
                 }
                 gameItemTypesLock.unlock();
@@ -279,7 +324,8 @@ bool GameObjectManager::removeObject(InteractiveNoun *anObject, int FD){
                 std::unique_lock<std::mutex> gameNPCsLock(gameNPCsMutex);
                 size = gameNPCs.size();
                 gameNPCs.erase(std::remove(gameNPCs.begin(), gameNPCs.end(), aNPC), gameNPCs.end());
-                if ((numRemoved == 1) && ((gameNPCs.size() - size) == 1)){
+                gameNPCsView.reset();
+                if ((numRemoved == 1) && ((size - gameNPCs.size()) == 1)){
                     success = true;
                 }
                 gameNPCsLock.unlock();
@@ -288,7 +334,8 @@ bool GameObjectManager::removeObject(InteractiveNoun *anObject, int FD){
                 std::unique_lock<std::mutex> gameContainersLock(gameContainersMutex);
                 size = gameContainers.size();
                 gameContainers.erase(std::remove(gameContainers.begin(), gameContainers.end(), aContainer), gameContainers.end());
-                if ((numRemoved == 1) && ((gameContainers.size() - size) == 1)){
+                gameContainersView.reset();
+                if ((numRemoved == 1) && ((size - gameContainers.size()) == 1)){
                     success = true;
                 }
                 gameContainersLock.unlock();
@@ -297,7 +344,8 @@ bool GameObjectManager::removeObject(InteractiveNoun *anObject, int FD){
                 std::unique_lock<std::mutex> gameCreatureTypesLock(gameCreatureTypesMutex);
                 size = gameCreatureTypes.size();
                 gameCreatureTypes.erase(std::remove(gameCreatureTypes.begin(), gameCreatureTypes.end(), aCreatureType), gameCreatureTypes.end());
-                if ((numRemoved == 1) && ((gameCreatureTypes.size() - size) == 1)){
+                gameCreatureTypesView.reset();
+                if ((numRemoved == 1) && ((size - gameCreatureTypes.size()) == 1)){
                     success = true;
                 }
                 gameCreatureTypesLock.unlock();
@@ -306,7 +354,8 @@ bool GameObjectManager::removeObject(InteractiveNoun *anObject, int FD){
                 std::unique_lock<std::mutex> gameQuestsLock(gameQuestsMutex);
                 size = gameQuests.size();
                 gameQuests.erase(std::remove(gameQuests.begin(), gameQuests.end(), aQuest), gameQuests.end());
-                if ((numRemoved == 1) && ((gameQuests.size() - size) == 1)){
+                gameQuestsView.reset();
+                if ((numRemoved == 1) && ((size - gameQuests.size()) == 1)){
                     success = true;
                 }
                 gameQuestsLock.unlock();
@@ -315,7 +364,8 @@ bool GameObjectManager::removeObject(InteractiveNoun *anObject, int FD){
                 std::unique_lock<std::mutex> gameItemsLock(gameItemsMutex);
                 size = gameItems.size();
                 gameItems.erase(std::remove(gameItems.begin(), gameItems.end(), anItem), gameItems.end());
-                if ((numRemoved == 1) && ((gameItems.size() - size) == 1)){
+                gameItemsView.reset();
+                if ((numRemoved == 1) && ((size - gameItems.size()) == 1)){
                     success = true;
                 }
                 gameItemsLock.unlock();
@@ -323,9 +373,11 @@ bool GameObjectManager::removeObject(InteractiveNoun *anObject, int FD){
                 success = true;
             }
         }
-        // if successfully removed, release memory
+        // if successfully removed, make sure the parser can no longer find the
+        // object and release memory once no command can be using it
         if (success){
-            delete anObject;
+            anObject->removeFromParser();
+            objectEpochs.retire(anObject);
             anObject = nullptr;
         }
     }
@@ -335,43 +387,113 @@ bool GameObjectManager::removeObject(InteractiveNoun *anObject, int FD){
 
 
 std::map<int, InteractiveNoun*> GameObjectManager::getAllObjects() const{
+    return *getAllObjectsView();
+}
+
+
+std::shared_ptr<const std::map<int, InteractiveNoun*>> GameObjectManager::getAllObjectsView() const{
     std::lock_guard<std::mutex> gameObjectsLock(gameObjectsMutex);
 
-    return gameObjects;
+    // rebuild the view only if an object was added or removed since the last call
+    if (gameObjectsView == nullptr){
+        gameObjectsView = std::make_shared<const std::map<int, InteractiveNoun*>>(gameObjects);
+    }
+    return gameObjectsView;
 }
 
 
 InteractiveNoun* GameObjectManager::getPointer(int ID) const{
+    // IDs from InteractiveNoun::nextID are found in the registry without locking
+    if (ObjectRegistry::inRange(ID)){
+        return objectRegistry.getObject(ID);
+    }
+
     std::lock_guard<std::mutex> gameObjectsLock(gameObjectsMutex);
-    int result = gameObjects.count(ID);
+    auto found = gameObjects.find(ID);
 
-    if (result == 1){
-        return gameObjects.at(ID);
+    if (found != gameObjects.end()){
+        return found->second;
     } else {
         return nullptr;
     }
 }
 
 
+ObjectHandle GameObjectManager::getHandle(InteractiveNoun *anObject) const{
+    if (anObject == nullptr){
+        return ObjectHandle();
+    }
+
+    int anID = anObject->getID();
+    std::lock_guard<std::mutex> gameObjectsLock(gameObjectsMutex);
+    auto found = gameObjects.find(anID);
+
+    if ((found != gameObjects.end()) && (found->second == anObject)){
+        return objectRegistry.getHandle(anID);
+    } else {
+        return ObjectHandle();
+    }
+}
+
+
+InteractiveNoun* GameObjectManager::getPointer(ObjectHandle aHandle) const{
+    // handles of IDs outside the registry have no generation to check
+    if (ObjectRegistry::inRange(aHandle.ID)){
+        return objectRegistry.getObject(aHandle);
+    }
+    return getPointer(aHandle.ID);
+}
+
+
+EpochManager::Guard GameObjectManager::protectObjects(){
+    return EpochManager::Guard(objectEpochs);
+}
+
+
+int GameObjectManager::reclaimObjects(){
+    return objectEpochs.reclaim();
+}
+
+
 std::vector<Creature*> GameObjectManager::getCreatures() const{
+    return *getCreaturesView();
+}
+
+
+std::shared_ptr<const std::vector<Creature*>> GameObjectManager::getCreaturesView() const{
     std::lock_guard<std::mutex> gameCreaturesLock(gameCreaturesMutex);
-    std::vector<Creature*> creatureVector;
 
-    for (auto creature : gameCreatures){
-        creatureVector.push_back(creature.second);
+    // rebuild the view only if a creature was added or removed since the last call
+    if (gameCreaturesView == nullptr){
+        auto creatureVector = std::make_shared<std::vector<Creature*>>();
+        creatureVector->reserve(gameCreatures.size());
+        for (auto creature : gameCreatures){
+            creatureVector->push_back(creature.second);
+        }
+        gameCreaturesView = creatureVector;
     }
-    return creatureVector;
+    return gameCreaturesView;
 }
 
 
 std::vector<Player*> GameObjectManager::getPlayersPtrs() const{
+    return *getPlayersView();
+}
+
+
+std::shared_ptr<const std::vector<Player*>> GameObjectManager::getPlayersView() const{
     std::lock_guard<std::mutex> activeGamePlayersLock(activeGamePlayersMutex);
-    std::vector<Player*> playerVector;
 
-    for (auto player : activeGamePlayers){
-        playerVector.push_back(player.second);
+    // rebuild the view only if a player became active or inactive since the last call
+    if (activeGamePlayersView == nullptr){
+        auto playerVector = std::make_shared<std::vector<Player*>>();
+        playerVector->reserve(activeGamePlayers.size());
+        for (auto player : activeGamePlayers){
+            playerVector->push_back(player.second);
+        }
+        activeGamePlayersView = playerVector;
     }
-    return playerVector;
+    return activeGamePlayersView;
 }
 
 
@@ -418,7 +540,9 @@ bool GameObjectManager::loadPlayer(std::string username, int FD){
 
     if ((result == 1) && (FD >= 0)){
         activeGamePlayers[FD] = inactivePlayers.at(username);
+        activeGamePlayersView.reset();
         inactivePlayers.erase(username);
+        inactiveSince.erase(username);
         return true;
     } else {
         return false;
@@ -436,7 +560,9 @@ bool GameObjectManager::hibernatePlayer(int FD){
     if (result == 1){
         aPlayer = activeGamePlayers.at(FD);
         inactivePlayers[aPlayer->getUser()] = aPlayer;
+        inactiveSince[aPlayer->getUser()] = std::chrono::steady_clock::now();
         activeGamePlayers.erase(FD);
+        activeGamePlayersView.reset();
         return true;
     } else {
         return false;
@@ -445,72 +571,231 @@ bool GameObjectManager::hibernatePlayer(int FD){
 
 
 std::vector<PlayerClass*> GameObjectManager::getPlayerClasses() const{
-    std::lock_guard<std::mutex> gamePlayerClassesLock(gamePlayerClassesMutex);
-    return gamePlayerClasses;
+    return *getView<PlayerClass>();
 }
 
 
 std::vector<Area*> GameObjectManager::getGameAreas() const{
-    std::lock_guard<std::mutex> gameAreasLock(gameAreasMutex);
-    return gameAreas;
+    return *getView<Area>();
 }
 
 
 std::vector<SpecialSkill*> GameObjectManager::getGameSkills() const{
-    std::lock_guard<std::mutex> gameSkillsLock(gameSkillsMutex);
-    return gameSkills;
+    return *getView<SpecialSkill>();
 }
 
 
 std::vector<ItemType*> GameObjectManager::getGameItemTypes() const{
-    std::lock_guard<std::mutex> gameItemTypesLock(gameItemTypesMutex);
-    return gameItemTypes;
+    return *getView<ItemType>();
 }
 
 
 std::vector<NonCombatant*> GameObjectManager::getGameNPCs() const{
-    std::lock_guard<std::mutex> gameNPCsLock(gameNPCsMutex);
-    return gameNPCs;
+    return *getView<NonCombatant>();
 }
 
 
 std::vector<Container*> GameObjectManager::getGameContainers() const{
-    std::lock_guard<std::mutex> gameContainersLock(gameContainersMutex);
-    return gameContainers;
+    return *getView<Container>();
 }
 
 
 std::vector<CreatureType*> GameObjectManager::getGameCreatureTypes() const{
-    std::lock_guard<std::mutex> gameCreatureTypesLock(gameCreatureTypesMutex);
-    return gameCreatureTypes;
+    return *getView<CreatureType>();
 }
 
 
 std::vector<Quest*> GameObjectManager::getGameQuests() const{
-    std::lock_guard<std::mutex> gameQuestsLock(gameQuestsMutex);
-    return gameQuests;
+    return *getView<Quest>();
 }
 
 
 std::vector<Item*> GameObjectManager::getGameItems() const{
-    std::lock_guard<std::mutex> gameItemsLock(gameItemsMutex);
-    return gameItems;
+    return *getView<Item>();
 }
 
+
 std::vector<Player*> GameObjectManager::getGamePlayers() const{
-    std::vector<Player*> allPlayers;
-    std::unique_lock<std::mutex> activeGamePlayersLock(activeGamePlayersMutex, std::defer_lock);
-    std::unique_lock<std::mutex> inactivePlayersLock(inactivePlayersMutex, std::defer_lock);
-    std::lock(activeGamePlayersLock, inactivePlayersLock);
+    return *getView<Player>();
+}
 
-    for (auto player : activeGamePlayers){
-        allPlayers.push_back(player.second);
+
+std::vector<Player*> GameObjectManager::getIdlePlayers(int seconds) const{
+    std::lock_guard<std::mutex> inactivePlayersLock(inactivePlayersMutex);
+    std::chrono::steady_clock::time_point cutoff = std::chrono::steady_clock::now() - std::chrono::seconds(seconds);
+    std::vector<Player*> idlePlayers;
+
+    for (auto player : inactiveSince){
+        if (player.second <= cutoff){
+            idlePlayers.push_back(inactivePlayers.at(player.first));
+        }
     }
-    for (auto player : inactivePlayers){
-        allPlayers.push_back(player.second);
+
+    return idlePlayers;
+}
+
+
+
+template <>
+std::shared_ptr<const std::vector<Creature*>> GameObjectManager::getView<Creature>() const{
+    return getCreaturesView();
+}
+
+
+template <>
+std::shared_ptr<const std::vector<Player*>> GameObjectManager::getView<Player>() const{
+    std::lock_guard<std::mutex> gamePlayersViewLock(gamePlayersViewMutex);
+
+    // rebuild the view only if a player was added or removed since the last call
+    if (gamePlayersView == nullptr){
+        auto playerVector = std::make_shared<std::vector<Player*>>();
+        std::unique_lock<std::mutex> activeGamePlayersLock(activeGamePlayersMutex, std::defer_lock);
+        std::unique_lock<std::mutex> inactivePlayersLock(inactivePlayersMutex, std::defer_lock);
+        std::lock(activeGamePlayersLock, inactivePlayersLock);
+
+        playerVector->reserve(activeGamePlayers.size() + inactivePlayers.size());
+        for (auto player : activeGamePlayers){
+            playerVector->push_back(player.second);
+        }
+        for (auto player : inactivePlayers){
+            playerVector->push_back(player.second);
+        }
+        gamePlayersView = playerVector;
+    }
+    return gamePlayersView;
+}
+
+
+template <>
+std::shared_ptr<const std::vector<PlayerClass*>> GameObjectManager::getView<PlayerClass>() const{
+    std::lock_guard<std::mutex> gamePlayerClassesLock(gamePlayerClassesMutex);
+    return getOrBuildView(gamePlayerClasses, gamePlayerClassesView);
+}
+
+
+template <>
+std::shared_ptr<const std::vector<Area*>> GameObjectManager::getView<Area>() const{
+    std::lock_guard<std::mutex> gameAreasLock(gameAreasMutex);
+    return getOrBuildView(gameAreas, gameAreasView);
+}
+
+
+template <>
+std::shared_ptr<const std::vector<SpecialSkill*>> GameObjectManager::getView<SpecialSkill>() const{
+    std::lock_guard<std::mutex> gameSkillsLock(gameSkillsMutex);
+    return getOrBuildView(gameSkills, gameSkillsView);
+}
+
+
+template <>
+std::shared_ptr<const std::vector<ItemType*>> GameObjectManager::getView<ItemType>() const{
+    std::lock_guard<std::mutex> gameItemTypesLock(gameItemTypesMutex);
+    return getOrBuildView(gameItemTypes, gameItemTypesView);
+}
+
+
+template <>
+std::shared_ptr<const std::vector<NonCombatant*>> GameObjectManager::getView<NonCombatant>() const{
+    std::lock_guard<std::mutex> gameNPCsLock(gameNPCsMutex);
+    return getOrBuildView(gameNPCs, gameNPCsView);
+}
+
+
+template <>
+std::shared_ptr<const std::vector<Container*>> GameObjectManager::getView<Container>() const{
+    std::lock_guard<std::mutex> gameContainersLock(gameContainersMutex);
+    return getOrBuildView(gameContainers, gameContainersView);
+}
+
+
+template <>
+std::shared_ptr<const std::vector<CreatureType*>> GameObjectManager::getView<CreatureType>() const{
+    std::lock_guard<std::mutex> gameCreatureTypesLock(gameCreatureTypesMutex);
+    return getOrBuildView(gameCreatureTypes, gameCreatureTypesView);
+}
+
+
+template <>
+std::shared_ptr<const std::vector<Quest*>> GameObjectManager::getView<Quest>() const{
+    std::lock_guard<std::mutex> gameQuestsLock(gameQuestsMutex);
+    return getOrBuildView(gameQuests, gameQuestsView);
+}
+
+
+template <>
+std::shared_ptr<const std::vector<Item*>> GameObjectManager::getView<Item>() const{
+    std::lock_guard<std::mutex> gameItemsLock(gameItemsMutex);
+    return getOrBuildView(gameItems, gameItemsView);
+}
+
+
+void GameObjectManager::updateIndexes(InteractiveNoun *anObject){
+    if (anObject == nullptr){
+        return;
+    }
+
+    // hold the objects lock so the object can't be removed while it is indexed
+    std::lock_guard<std::mutex> gameObjectsLock(gameObjectsMutex);
+    auto found = gameObjects.find(anObject->getID());
+
+    if ((found != gameObjects.end()) && (found->second == anObject)){
+        std::lock_guard<std::mutex> indexesLock(indexesMutex);
+        indexObject(anObject);
+    }
+}
+
+
+std::vector<Quest*> GameObjectManager::getQuestsByRewardItem(Item *anItem) const{
+    std::lock_guard<std::mutex> indexesLock(indexesMutex);
+    return questsByRewardItem.find(anItem);
+}
+
+
+std::vector<NonCombatant*> GameObjectManager::getNPCsByQuest(Quest *aQuest) const{
+    std::lock_guard<std::mutex> indexesLock(indexesMutex);
+    return npcsByQuest.find(aQuest);
+}
+
+
+void GameObjectManager::indexObject(InteractiveNoun *anObject){
+    Quest *aQuest = nullptr;
+    NonCombatant *aNPC = nullptr;
+
+    switch (anObject->getObjectType()){
+        case ObjectType::QUEST:
+            aQuest = dynamic_cast<Quest*>(anObject);
+            if (aQuest != nullptr){
+                // quests without a reward item are not indexed
+                if (aQuest->getRewardItem() != nullptr){
+                    questsByRewardItem.update(aQuest, aQuest->getRewardItem());
+                } else {
+                    questsByRewardItem.remove(aQuest);
+                }
+            }
+            break;
+        case ObjectType::NON_COMBATANT:
+            aNPC = dynamic_cast<NonCombatant*>(anObject);
+            if (aNPC != nullptr){
+                npcsByQuest.update(aNPC, aNPC->getQuest());
+            }
+            break;
+        default:
+            break;
     }
+}
 
-    return allPlayers;
+
+void GameObjectManager::unindexObject(InteractiveNoun *anObject){
+    switch (anObject->getObjectType()){
+        case ObjectType::QUEST:
+            questsByRewardItem.remove(static_cast<Quest*>(anObject));
+            break;
+        case ObjectType::NON_COMBATANT:
+            npcsByQuest.remove(static_cast<NonCombatant*>(anObject));
+            break;
+        default:
+            break;
+    }
 }
 
 }}
\ No newline at end of file
@@ -1,7 +1,7 @@
 /*********************************************************************//**
  * \author      Rachel Weissman-Hohler
  * \created     02/01/2017
- * \modified    03/05/2017
+ * \modified    10/19/2026
  * \course      CS467, Winter 2017
  * \file        GameObjectManager.hpp
  *
@@ -17,6 +17,11 @@
 #include <map>
 #include <mutex>
 #include <atomic>
+#include <chrono>
+#include <memory>
+#include "EpochManager.hpp"
+#include "ObjectIndex.hpp"
+#include "ObjectRegistry.hpp"
 
 namespace legacymud { namespace engine {
 
@@ -60,6 +65,11 @@ class GameObjectManager {
          * \brief   Removes the specified object from the game manager and releases
          *          the associated memory if successfully removed.
          *
+         * The object is not deleted right away, because other threads may
+         * still hold pointers to it. It is deleted by reclaimObjects() once
+         * every guard returned by protectObjects() before the removal has
+         * been released.
+         *
          * \param[in] anObject  Specifies the object to be removed.
          * \param[in] FD        If the object is a player, specifies their file descriptor
          *
@@ -77,6 +87,18 @@ class GameObjectManager {
          */
         std::map<int, InteractiveNoun*> getAllObjects() const;
 
+        /*!
+         * \brief   Gets a read-only view of the map of ID to InteractiveNoun* 
+         *          with all of the objects in the game.
+         *
+         * The view is built the first time it is requested after an object
+         * is added or removed, and is shared by every caller until the next
+         * change, so requesting it does not copy the map.
+         *
+         * \return  Returns a pointer to a map with all of the objects in the game.
+         */
+        std::shared_ptr<const std::map<int, InteractiveNoun*>> getAllObjectsView() const;
+
         /*!
          * \brief   Gets a pointer to the object indicated by the specified
          *          ID.
@@ -88,6 +110,50 @@ class GameObjectManager {
          */
         InteractiveNoun* getPointer(int ID) const;
 
+        /*!
+         * \brief   Gets a handle to the specified object.
+         *
+         * Unlike a pointer or an ID, a handle never refers to a different 
+         * object after the object is removed, even if another object is
+         * later added with the same ID.
+         *
+         * \param[in] anObject  Specifies the object to get a handle for.
+         *
+         * \return  Returns the handle, or a handle that does not resolve to
+         *          any object if anObject is not in the game.
+         */
+        ObjectHandle getHandle(InteractiveNoun *anObject) const;
+
+        /*!
+         * \brief   Gets a pointer to the object indicated by the specified
+         *          handle without locking.
+         *
+         * \param[in] aHandle   Specifies the handle of the object to be returned.
+         *
+         * \return  Returns the object, if it is still in the game, otherwise
+         *          nullptr.
+         */
+        InteractiveNoun* getPointer(ObjectHandle aHandle) const;
+
+        /*!
+         * \brief   Protects the objects in the game from being deleted.
+         *
+         * Objects removed while the returned guard is active are not deleted
+         * until it is released, so pointers obtained while holding it stay
+         * valid.
+         *
+         * \return  Returns the guard. The objects are protected until it is
+         *          released or destroyed.
+         */
+        EpochManager::Guard protectObjects();
+
+        /*!
+         * \brief   Deletes the removed objects that no guard can see.
+         *
+         * \return  Returns the number of objects that were deleted.
+         */
+        int reclaimObjects();
+
         /*!
          * \brief   Gets the list of creatures in the game.
          *
@@ -96,6 +162,16 @@ class GameObjectManager {
          */
         std::vector<Creature*> getCreatures() const;
 
+        /*!
+         * \brief   Gets a read-only view of the list of creatures in the game.
+         *
+         * The view is only rebuilt after a creature is added or removed, so
+         * requesting it does not allocate or copy the list.
+         *
+         * \return  Returns a pointer to a vector with the creatures in the game.
+         */
+        std::shared_ptr<const std::vector<Creature*>> getCreaturesView() const;
+
         /*!
          * \brief   Gets the list of pointers to active players in the game.
          *
@@ -104,6 +180,16 @@ class GameObjectManager {
          */
         std::vector<Player*> getPlayersPtrs() const;
 
+        /*!
+         * \brief   Gets a read-only view of the list of active players in the game.
+         *
+         * The view is only rebuilt after a player becomes active or inactive,
+         * so requesting it does not allocate or copy the list.
+         *
+         * \return  Returns a pointer to a vector with the active players in the game.
+         */
+        std::shared_ptr<const std::vector<Player*>> getPlayersView() const;
+
         /*!
          * \brief   Gets the list of active player file descriptors in the game.
          *
@@ -221,35 +307,194 @@ class GameObjectManager {
          * \return  Returns a vector of pointers to Player.
          */
         std::vector<Player*> getGamePlayers() const;
+
+        /*!
+         * \brief   Gets list of inactive Players that have been inactive for at
+         *          least the specified time.
+         *
+         * \param[in] seconds   Specifies the minimum time inactive, in seconds.
+         *
+         * \return  Returns a vector of pointers to the idle Players.
+         */
+        std::vector<Player*> getIdlePlayers(int seconds) const;
+
+        /*!
+         * \brief   Gets a read-only view of the objects of the specified class.
+         *
+         * Like getAllObjectsView(), the view is shared by every caller until
+         * an object of the class is added or removed, so iterating over it
+         * does not lock or copy anything. The supported classes are Area,
+         * Container, Creature, Item, ItemType, NonCombatant, Player (active
+         * and inactive), PlayerClass, Quest, SpecialSkill and CreatureType.
+         *
+         * Objects removed after the view was built may still be in it. 
+         * Callers that hold a guard from protectObjects() can still use them.
+         *
+         * \return  Returns a pointer to a vector with the objects.
+         */
+        template <class T>
+        std::shared_ptr<const std::vector<T*>> getView() const;
+
+        /*!
+         * \brief   Gets the objects of the specified class that match the
+         *          specified predicate.
+         *
+         * The predicate is called without holding any locks, so it may call
+         * back into the manager.
+         *
+         * \param[in] aPredicate    Specifies a callable that takes a T* and
+         *                          returns true if the object should be included.
+         *
+         * \return  Returns a vector with the matching objects.
+         */
+        template <class T, class Predicate>
+        std::vector<T*> query(Predicate aPredicate) const{
+            std::shared_ptr<const std::vector<T*>> objects = getView<T>();
+            std::vector<T*> matches;
+
+            for (auto anObject : *objects){
+                if (aPredicate(anObject)){
+                    matches.push_back(anObject);
+                }
+            }
+            return matches;
+        }
+
+        /*!
+         * \brief   Calls the specified visitor with each object of the 
+         *          specified class until it returns false.
+         *
+         * The visitor is called without holding any locks, so it may call
+         * back into the manager.
+         *
+         * \param[in] aVisitor  Specifies a callable that takes a T* and returns
+         *                      false to stop visiting.
+         *
+         * \return  Returns the number of objects visited.
+         */
+        template <class T, class Visitor>
+        int visit(Visitor aVisitor) const{
+            std::shared_ptr<const std::vector<T*>> objects = getView<T>();
+            int numVisited = 0;
+
+            for (auto anObject : *objects){
+                numVisited++;
+                if (!aVisitor(anObject)){
+                    break;
+                }
+            }
+            return numVisited;
+        }
+
+        /*!
+         * \brief   Updates the indexes of the specified object after one of
+         *          its indexed attributes changed.
+         *
+         * The indexed attributes are the reward item of a quest and the
+         * quest of a non-combatant. Objects that are not in the game are
+         * ignored.
+         *
+         * \param[in] anObject  Specifies the object that changed.
+         */
+        void updateIndexes(InteractiveNoun *anObject);
+
+        /*!
+         * \brief   Gets the quests that reward the specified item.
+         *
+         * \param[in] anItem    Specifies the reward item.
+         *
+         * \return  Returns a vector of pointers to Quest.
+         */
+        std::vector<Quest*> getQuestsByRewardItem(Item *anItem) const;
+
+        /*!
+         * \brief   Gets the non-combatants with the specified quest.
+         *
+         * \param[in] aQuest    Specifies the quest, or nullptr for the 
+         *                      non-combatants without a quest.
+         *
+         * \return  Returns a vector of pointers to NonCombatant.
+         */
+        std::vector<NonCombatant*> getNPCsByQuest(Quest *aQuest) const;
     private:
+        // Gets the view of a list, copying the list only if the view was reset.
+        // The caller must hold the mutex of the list.
+        template <class T>
+        static std::shared_ptr<const std::vector<T*>> getOrBuildView(const std::vector<T*> &objects, std::shared_ptr<const std::vector<T*>> &view){
+            if (view == nullptr){
+                view = std::make_shared<const std::vector<T*>>(objects);
+            }
+            return view;
+        }
+
+        // Adds or moves the object in the indexes for its type. The caller
+        // must hold indexesMutex.
+        void indexObject(InteractiveNoun *anObject);
+
+        // Removes the object from the indexes for its type. The caller must
+        // hold indexesMutex.
+        void unindexObject(InteractiveNoun *anObject);
+
         std::map<int, InteractiveNoun*> gameObjects;
         mutable std::mutex gameObjectsMutex;
+        ObjectRegistry objectRegistry;
+        EpochManager objectEpochs;
+        mutable std::shared_ptr<const std::map<int, InteractiveNoun*>> gameObjectsView;
         std::map<int, Creature*> gameCreatures;
         mutable std::mutex gameCreaturesMutex;
+        mutable std::shared_ptr<const std::vector<Creature*>> gameCreaturesView;
         std::map<int, Player*> activeGamePlayers;
         mutable std::mutex activeGamePlayersMutex;
+        mutable std::shared_ptr<const std::vector<Player*>> activeGamePlayersView;
         std::map<std::string, Player*> inactivePlayers;
+        std::map<std::string, std::chrono::steady_clock::time_point> inactiveSince;
         mutable std::mutex inactivePlayersMutex;
+        mutable std::shared_ptr<const std::vector<Player*>> gamePlayersView;
+        mutable std::mutex gamePlayersViewMutex;
         std::vector<PlayerClass*> gamePlayerClasses;
         mutable std::mutex gamePlayerClassesMutex;
+        mutable std::shared_ptr<const std::vector<PlayerClass*>> gamePlayerClassesView;
         std::vector<Area*> gameAreas;
         mutable std::mutex gameAreasMutex;
+        mutable std::shared_ptr<const std::vector<Area*>> gameAreasView;
         std::vector<SpecialSkill*> gameSkills;
         mutable std::mutex gameSkillsMutex;
+        mutable std::shared_ptr<const std::vector<SpecialSkill*>> gameSkillsView;
         std::vector<ItemType*> gameItemTypes;
         mutable std::mutex gameItemTypesMutex;
+        mutable std::shared_ptr<const std::vector<ItemType*>> gameItemTypesView;
         std::vector<NonCombatant*> gameNPCs;
         mutable std::mutex gameNPCsMutex;
+        mutable std::shared_ptr<const std::vector<NonCombatant*>> gameNPCsView;
         std::vector<Container*> gameContainers;
         mutable std::mutex gameContainersMutex;
+        mutable std::shared_ptr<const std::vector<Container*>> gameContainersView;
         std::vector<CreatureType*> gameCreatureTypes;
         mutable std::mutex gameCreatureTypesMutex;
+        mutable std::shared_ptr<const std::vector<CreatureType*>> gameCreatureTypesView;
         std::vector<Quest*> gameQuests;
         mutable std::mutex gameQuestsMutex;
+        mutable std::shared_ptr<const std::vector<Quest*>> gameQuestsView;
         std::vector<Item*> gameItems;
         mutable std::mutex gameItemsMutex;
+        mutable std::shared_ptr<const std::vector<Item*>> gameItemsView;
+        ObjectIndex<Item*, Quest*> questsByRewardItem;
+        ObjectIndex<Quest*, NonCombatant*> npcsByQuest;
+        mutable std::mutex indexesMutex;
 };
 
+template <> std::shared_ptr<const std::vector<Area*>> GameObjectManager::getView<Area>() const;
+template <> std::shared_ptr<const std::vector<Container*>> GameObjectManager::getView<Container>() const;
+template <> std::shared_ptr<const std::vector<Creature*>> GameObjectManager::getView<Creature>() const;
+template <> std::shared_ptr<const std::vector<Item*>> GameObjectManager::getView<Item>() const;
+template <> std::shared_ptr<const std::vector<ItemType*>> GameObjectManager::getView<ItemType>() const;
+template <> std::shared_ptr<const std::vector<NonCombatant*>> GameObjectManager::getView<NonCombatant>() const;
+template <> std::shared_ptr<const std::vector<Player*>> GameObjectManager::getView<Player>() const;
+template <> std::shared_ptr<const std::vector<PlayerClass*>> GameObjectManager::getView<PlayerClass>() const;
+template <> std::shared_ptr<const std::vector<Quest*>> GameObjectManager::getView<Quest>() const;
+template <> std::shared_ptr<const std::vector<SpecialSkill*>> GameObjectManager::getView<SpecialSkill>() const;
+template <> std::shared_ptr<const std::vector<CreatureType*>> GameObjectManager::getView<CreatureType>() const;
+
 }}
  
 #endif
\ No newline at end of file
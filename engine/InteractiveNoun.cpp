@@ -17,6 +17,7 @@
 #include "Area.hpp"
 #include "NonCombatant.hpp"
 #include "Combatant.hpp"
+#include "SlabAllocator.hpp"
 #include <WordManager.hpp>
 #include <rapidjson/writer.h>
 #include <rapidjson/stringbuffer.h>
@@ -29,6 +30,24 @@
 
 namespace legacymud { namespace engine {
 
+namespace {
+
+// Deletes the actions in a table when the last object sharing it releases it.
+struct DeleteActions {
+    void operator()(std::vector<Action*> *allActions) const{
+        for (auto action : *allActions){
+            delete action;
+        }
+        delete allActions;
+    }
+};
+
+std::shared_ptr<std::vector<Action*>> makeActionTable(){
+    return std::shared_ptr<std::vector<Action*>>(new std::vector<Action*>(), DeleteActions());
+}
+
+}
+
 std::atomic<int> InteractiveNoun::nextID {1};
 
 
@@ -42,7 +61,7 @@ void InteractiveNoun::setStaticID(int num){
 }
 
 
-InteractiveNoun::InteractiveNoun(int anID) : ID(anID){
+InteractiveNoun::InteractiveNoun(int anID) : actions(makeActionTable()), ID(anID){
 
 }
 
@@ -56,11 +75,7 @@ InteractiveNoun::InteractiveNoun(const InteractiveNoun &otherNoun) : ID(nextID++
         aliases.push_back(otherNoun.aliases[i]);
     }
         
-    if (!otherNoun.actions.empty()){
-        for (auto action : otherNoun.actions){
-            actions.push_back(new Action(*action));
-        }
-    }
+    actions = otherNoun.actions;
 }
 
 
@@ -71,20 +86,11 @@ InteractiveNoun & InteractiveNoun::operator=(const InteractiveNoun &otherNoun){
     std::unique_lock<std::mutex> actionsLock(actionsMutex, std::defer_lock);
     std::lock(otherAliasesLock, otherActionsLock, aliasesLock, actionsLock);
     if (this != &otherNoun){
-        for (auto action : actions){
-            delete action;
-        }
-        actions.clear();
-
         for (size_t i = 1; i < otherNoun.aliases.size(); i++){
             aliases.push_back(otherNoun.aliases[i]);
         }
 
-        if (!otherNoun.actions.empty()){
-            for (auto action : otherNoun.actions){
-                actions.push_back(new Action(*action));
-            }
-        }        
+        actions = otherNoun.actions;
     }
 
     return *this;
@@ -107,10 +113,17 @@ bool InteractiveNoun::operator==(const InteractiveNoun &otherNoun) const{
 
 
 InteractiveNoun::~InteractiveNoun(){
-    for (auto action : actions){
-        delete action;
-    }
-    actions.clear();
+
+}
+
+
+void* InteractiveNoun::operator new(std::size_t size){
+    return SlabAllocator::allocate(size);
+}
+
+
+void InteractiveNoun::operator delete(void *ptr, std::size_t size){
+    SlabAllocator::deallocate(ptr, size);
 }
 
 
@@ -153,9 +166,21 @@ int InteractiveNoun::getID() const{
 
 Action* InteractiveNoun::getAction(CommandEnum aCommand) const{
     std::lock_guard<std::mutex> actionsLock(actionsMutex);
-    for (size_t i = 0; i < actions.size(); i++){
-        if (actions[i]->getCommand() == aCommand){
-            return actions[i];
+    for (size_t i = 0; i < actions->size(); i++){
+        if ((*actions)[i]->getCommand() == aCommand){
+            return (*actions)[i];
+        }
+    }
+    return nullptr;
+}
+
+
+Action* InteractiveNoun::getEditableAction(CommandEnum aCommand){
+    std::lock_guard<std::mutex> actionsLock(actionsMutex);
+    for (size_t i = 0; i < actions->size(); i++){
+        if ((*actions)[i]->getCommand() == aCommand){
+            detachActions();
+            return (*actions)[i];
         }
     }
     return nullptr;
@@ -166,9 +191,9 @@ std::vector<Action*> InteractiveNoun::getActions(std::string alias) const{
     std::lock_guard<std::mutex> actionsLock(actionsMutex);
     std::vector<Action*> aliasActions;
 
-    for (size_t i = 0; i < actions.size(); i++){
-        if (actions[i]->isAlias(alias) == true){
-            aliasActions.push_back(actions[i]);
+    for (size_t i = 0; i < actions->size(); i++){
+        if ((*actions)[i]->isAlias(alias) == true){
+            aliasActions.push_back((*actions)[i]);
         }
     }
 
@@ -179,7 +204,7 @@ std::vector<Action*> InteractiveNoun::getActions(std::string alias) const{
 std::vector<Action*> InteractiveNoun::getAllActions() const{
     std::lock_guard<std::mutex> actionsLock(actionsMutex);
 
-    return actions;
+    return *actions;
 }
 
 
@@ -195,7 +220,7 @@ std::vector<std::string> InteractiveNoun::getVerbAliases() const{
     std::vector<std::string> verbAliases;
     std::vector<std::string> aliases;
 
-    for (auto action : actions){
+    for (auto action : *actions){
         aliases = action->getAliases();
         verbAliases.insert(verbAliases.end(), aliases.begin(), aliases.end());
     }
@@ -206,8 +231,8 @@ std::vector<std::string> InteractiveNoun::getVerbAliases() const{
 
 bool InteractiveNoun::checkAction(CommandEnum aCommand) const{
     std::lock_guard<std::mutex> actionsLock(actionsMutex);
-    for (size_t i = 0; i < actions.size(); i++){
-        if (actions[i]->getCommand() == aCommand){
+    for (size_t i = 0; i < actions->size(); i++){
+        if ((*actions)[i]->getCommand() == aCommand){
             return true;
         }
     }
@@ -219,10 +244,11 @@ Action* InteractiveNoun::addAction(CommandEnum aCommand){
     if (!checkAction(aCommand)){
         std::lock_guard<std::mutex> actionsLock(actionsMutex);
         Action *anAction = new Action(aCommand);
-        actions.push_back(anAction);
+        detachActions();
+        actions->push_back(anAction);
         return anAction;
     } else {
-        return getAction(aCommand);
+        return getEditableAction(aCommand);
     }
 }
 
@@ -231,10 +257,11 @@ Action* InteractiveNoun::addAction(CommandEnum aCommand, bool valid, std::string
     if (!checkAction(aCommand)){
         std::lock_guard<std::mutex> actionsLock(actionsMutex);
         Action *anAction = new Action(aCommand, valid, flavorText, effect);
-        actions.push_back(anAction);
+        detachActions();
+        actions->push_back(anAction);
         return anAction;
     } else {
-        return getAction(aCommand);
+        return getEditableAction(aCommand);
     }
 }
 
@@ -243,14 +270,15 @@ bool InteractiveNoun::removeAction(CommandEnum aCommand){
     std::lock_guard<std::mutex> actionsLock(actionsMutex);
     int index = -1;
 
-    for (size_t i = 0; i < actions.size(); i++){
-        if (actions[i]->getCommand() == aCommand){
+    for (size_t i = 0; i < actions->size(); i++){
+        if ((*actions)[i]->getCommand() == aCommand){
             index = i;
         }
     }
 
     if (index != -1){
-        actions.erase(actions.begin() + index);
+        detachActions();
+        actions->erase(actions->begin() + index);
         return true;
     }
 
@@ -295,8 +323,20 @@ bool InteractiveNoun::removeNounAlias(std::string anAlias){
 }
 
 
+void InteractiveNoun::replaceName(SharedString &name, std::string newName){
+    std::lock_guard<std::mutex> nameLock(nameMutex);
+    removeNounAlias(name.exchange(newName));
+    addNounAlias(newName);
+}
+
+
+void InteractiveNoun::removeFromParser(){
+    parser::WordManager::removeObject(this, getNounAliases(), getVerbAliases());
+}
+
+
 bool InteractiveNoun::addVerbAlias(CommandEnum aCommand, std::string alias, parser::Grammar::Support direct, parser::Grammar::Support indirect, std::map<std::string, parser::PrepositionType> prepositions){
-    Action *anAction = getAction(aCommand);
+    Action *anAction = getEditableAction(aCommand);
     parser::Grammar *aGrammar;
 
     if (anAction != nullptr){
@@ -318,7 +358,7 @@ bool InteractiveNoun::addVerbAlias(CommandEnum aCommand, std::string alias, pars
 
 
 bool InteractiveNoun::removeVerbAlias(CommandEnum aCommand, std::string alias){
-    Action *anAction = getAction(aCommand);
+    Action *anAction = getEditableAction(aCommand);
 
     if (anAction != nullptr){
         anAction->removeAlias(alias);
@@ -329,6 +369,18 @@ bool InteractiveNoun::removeVerbAlias(CommandEnum aCommand, std::string alias){
 }
 
 
+void InteractiveNoun::detachActions(){
+    if (actions.use_count() > 1){
+        std::shared_ptr<std::vector<Action*>> ownActions = makeActionTable();
+
+        for (auto action : *actions){
+            ownActions->push_back(new Action(*action));
+        }
+        actions = ownActions;
+    }
+}
+
+
 std::string InteractiveNoun::getTextAndEffect(CommandEnum aCommand, EffectType &anEffect) const{
     std::string message = "false";
     Action *anAction = nullptr;
@@ -20,6 +20,7 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <memory>
 #include <tuple>
 #include <mutex>
 #include <atomic>
@@ -28,6 +29,7 @@
 #include "ObjectType.hpp"
 #include "ItemPosition.hpp"
 #include "EffectType.hpp"
+#include "SharedString.hpp"
 
 namespace legacymud { namespace engine {
 
@@ -55,6 +57,13 @@ class InteractiveNoun {
         bool operator==(const InteractiveNoun &otherNoun) const;
         virtual ~InteractiveNoun();
 
+        /*!
+         * \brief   Allocates game objects from the shared slabs of the SlabAllocator
+         *          instead of making a separate heap allocation.
+         */
+        static void* operator new(std::size_t size);
+        static void operator delete(void *ptr, std::size_t size);
+
         bool compareActionsAndAliases(const InteractiveNoun &otherObject) const;
         virtual bool compareObjects(const InteractiveNoun &otherObject) const;
 
@@ -73,6 +82,9 @@ class InteractiveNoun {
          *
          * \return  Returns an Action* with the action that is associated with
          *          the specified command.
+         *
+         * \note    The action may be shared with copies of this object, so it
+         *          must not be changed. Use getEditableAction() instead.
          */
         Action* getAction(CommandEnum command) const;
 
@@ -92,9 +104,28 @@ class InteractiveNoun {
          *
          * \return  Returns a std::vector<Action*> with the actions that include
          *          the specified alias.
+         *
+         * \note    The actions may be shared with copies of this object, so
+         *          they must not be changed. Use getEditableAction() to get
+         *          an action that can be changed.
          */
         std::vector<Action*> getAllActions() const;
 
+        /*!
+         * \brief   Gets the action that is associated with the specified 
+         *          CommandEnum so it can be changed.
+         *
+         * If the actions are shared with a copy of this object, this object
+         * gets its own copy of them first, so changing the action does not
+         * change the copy.
+         *          
+         * \param[in] command   Specifies the command of the action to return.
+         *
+         * \return  Returns an Action* with the action that is associated with
+         *          the specified command, or nullptr if there is none.
+         */
+        Action* getEditableAction(CommandEnum command);
+
         /*!
          * \brief   Gets all of the noun aliases for this interactive noun.
          *
@@ -180,6 +211,16 @@ class InteractiveNoun {
          */
         virtual bool removeNounAlias(std::string);
 
+        /*!
+         * \brief   Removes all of the noun and verb aliases of this interactive
+         *          noun from the parser's lookup tables, so the parser can no
+         *          longer find it. The aliases of the object are not changed.
+         *
+         * This function is called when the object is removed from the game,
+         * before it is freed.
+         */
+        void removeFromParser();
+
         /*!
          * \brief   Adds an alias of the specified command for this interactive noun.
          *
@@ -246,6 +287,19 @@ class InteractiveNoun {
          */
         virtual bool unregisterAlias(bool isVerb, std::string alias, InteractiveNoun *anObject) { return false; }
 
+        /*!
+         * \brief   Applies a batch of alias changes to this object's lexical data.
+         * 
+         * \param[in] batch     Specifies the alias changes to apply.
+         * 
+         * \note    This function will be overridden in child classes that 
+         *          support registering aliases.
+         *
+         * \return  Returns a bool indicating whether or not applying the
+         *          batch succeeded.
+         */
+        virtual bool applyLexicalBatch(const parser::LexicalBatch &batch) { return false; }
+
         /*!
          * \brief   Gets the text and effect for the specified command.
          *
@@ -580,11 +634,33 @@ class InteractiveNoun {
          * \return  Returns a std::string with the serialized data.
          */        
         virtual std::string serializeJustInteractiveNoun();
+    protected:
+        /*!
+         * \brief   Sets the specified name and replaces the old name with the
+         *          new one in the noun aliases.
+         *
+         * \param[in,out] name     Specifies the name to set.
+         * \param[in] newName      Specifies the new name.
+         *
+         * \note    Two threads renaming the same object at once are done one
+         *          after the other, so the aliases always match the name.
+         */
+        void replaceName(SharedString &name, std::string newName);
     private:
-        std::vector<Action*> actions;
+        // Gives this object its own copy of the actions if they are shared.
+        // The caller must hold actionsMutex.
+        void detachActions();
+
+        // Copying an object shares its actions instead of copying them, so
+        // spawning many copies of a creature or item stores the actions,
+        // aliases and grammars once. A shared table is never changed; the
+        // first object to change it gets its own copy. Guarded by actionsMutex.
+        std::shared_ptr<std::vector<Action*>> actions;
         mutable std::mutex actionsMutex;
         std::vector<std::string> aliases;
         mutable std::mutex aliasesMutex;
+        // Held while the name and its noun alias are replaced together.
+        std::mutex nameMutex;
         const int ID;
         static std::atomic<int> nextID;
 };
@@ -64,18 +64,12 @@ Item::Item(InteractiveNoun* location, ItemPosition position, std::string name, I
 
 
 Item::Item(const Item &otherItem) : InteractiveNoun(otherItem) {
-    otherItem.locationMutex.lock();
-    location = otherItem.location;
-    otherItem.locationMutex.unlock();
-    otherItem.nameMutex.lock();
+    location = otherItem.location.load();
     name = otherItem.name;
-    otherItem.nameMutex.unlock();
-    otherItem.typeMutex.lock();
-    type = otherItem.type;
-    otherItem.typeMutex.unlock();
+    type = otherItem.type.load();
     std::string idAlias = "item " + std::to_string(getID());
     InteractiveNoun::addNounAlias(idAlias);
-    InteractiveNoun::addNounAlias(name);
+    InteractiveNoun::addNounAlias(name.get());
 }
 
 
@@ -84,18 +78,12 @@ Item & Item::operator=(const Item &otherItem){
         return *this;
 
     InteractiveNoun::operator=(otherItem);
-    otherItem.locationMutex.lock();
-    location = otherItem.location;
-    otherItem.locationMutex.unlock();
-    otherItem.nameMutex.lock();
+    location = otherItem.location.load();
     name = otherItem.name;
-    otherItem.nameMutex.unlock();
-    otherItem.typeMutex.lock();
-    type = otherItem.type;
-    otherItem.typeMutex.unlock();
+    type = otherItem.type.load();
     std::string idAlias = "item " + std::to_string(getID());
     InteractiveNoun::addNounAlias(idAlias);
-    InteractiveNoun::addNounAlias(name);
+    InteractiveNoun::addNounAlias(name.get());
     
     return *this;
 }
@@ -148,8 +136,7 @@ bool Item::compareObjects(const InteractiveNoun &otherObject) const{
 
 
 InteractiveNoun* Item::getLocation() const{
-    std::lock_guard<std::mutex> locationLock(locationMutex);
-    return location;
+    return location.load();
 }
 
 
@@ -164,19 +151,17 @@ ItemPosition Item::getPosition() const{
 
 
 std::string Item::getName() const{
-    std::lock_guard<std::mutex> nameLock(nameMutex);
-    return name;
+    return name.get();
 }
 
 
 ItemType* Item::getType() const{
-    std::lock_guard<std::mutex> typeLock(typeMutex);
-    return type;
+    return type.load();
 }
 
 
 int Item::getCooldown() const{
-    std::lock_guard<std::mutex> typeLock(typeMutex);
+    ItemType *type = this->type.load();
     int cooldown = 0;
     int weight = 0;
     if (type->getObjectType() == ObjectType::WEAPON_TYPE){
@@ -202,9 +187,8 @@ int Item::getCooldown() const{
 
 
 bool Item::setLocation(InteractiveNoun* containingNoun){
-    std::lock_guard<std::mutex> locationLock(locationMutex);
     if (containingNoun != nullptr){
-        location = containingNoun;
+        location.store(containingNoun);
         return true;
     }
 
@@ -220,19 +204,15 @@ bool Item::setPosition(ItemPosition position){
 
 
 bool Item::setName(std::string name){
-    std::lock_guard<std::mutex> nameLock(nameMutex);
-    removeNounAlias(this->name);
-    addNounAlias(name);
-    this->name = name;
+    replaceName(this->name, name);
 
     return true;
 }
 
 
 bool Item::setType(ItemType *type){
-    std::lock_guard<std::mutex> typeLock(typeMutex);
     if (type != nullptr){
-        this->type = type;
+        this->type.store(type);
         return true;
     }
 
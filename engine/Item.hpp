@@ -17,6 +17,7 @@
 #include <atomic>
 #include <mutex>
 #include <vector>
+#include "SharedString.hpp"
 #include "parser.hpp"
 #include "InteractiveNoun.hpp"
 #include "ItemPosition.hpp"
@@ -593,13 +594,10 @@ class Item: public InteractiveNoun {
          */
         static std::map<std::string, DataType> getAttributeSignature();
     private:
-        InteractiveNoun* location;
-        mutable std::mutex locationMutex;
+        std::atomic<InteractiveNoun*> location;
         std::atomic<ItemPosition> position;
-        std::string name;
-        mutable std::mutex nameMutex;
-        ItemType *type;
-        mutable std::mutex typeMutex;
+        SharedString name;
+        std::atomic<ItemType*> type;
 };
 
 }}
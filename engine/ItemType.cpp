@@ -74,14 +74,12 @@ ItemRarity ItemType::getRarity() const{
 
 
 std::string ItemType::getDescription() const{
-    std::lock_guard<std::mutex> descriptionLock(descriptionMutex);
-    return description;
+    return description.get();
 }
 
 
 std::string ItemType::getName() const{
-    std::lock_guard<std::mutex> nameLock(nameMutex);
-    return name;
+    return name.get();
 }
 
 
@@ -110,18 +108,14 @@ bool ItemType::setRarity(ItemRarity rarity){
 
 
 bool ItemType::setDescription(std::string description){
-    std::lock_guard<std::mutex> descriptionLock(descriptionMutex);
-    this->description = description;
+    this->description.set(description);
 
     return true;
 }
 
 
 bool ItemType::setName(std::string name){
-    std::lock_guard<std::mutex> nameLock(nameMutex);
-    removeNounAlias(this->name);
-    addNounAlias(name);
-    this->name = name;
+    replaceName(this->name, name);
 
     return true;
 }
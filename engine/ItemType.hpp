@@ -19,6 +19,7 @@
 #include <atomic>
 #include <mutex>
 #include <vector>
+#include "SharedString.hpp"
 #include "InteractiveNoun.hpp"
 #include "EquipmentSlot.hpp"
 #include "ItemRarity.hpp"
@@ -442,10 +443,8 @@ class ItemType: public InteractiveNoun {
     private:
         std::atomic<int> weight;
         std::atomic<ItemRarity> rarity;
-        std::string description;
-        mutable std::mutex descriptionMutex;
-        std::string name;
-        mutable std::mutex nameMutex;
+        SharedString description;
+        SharedString name;
         std::atomic<int> cost;
         std::atomic<EquipmentSlot> slotType;
 };
@@ -89,39 +89,26 @@ bool NonCombatant::addToInventory(Item *anItem){
     Container *aContainer = nullptr;
     std::vector<Item*> contents;
     Area *location = getLocation();
-    std::vector<std::string> nounAliases, verbAliases;
+    parser::LexicalBatch batch;
 
     if (anItem != nullptr){
         success = Character::addToInventory(anItem);
 
         if (success){
-            nounAliases = anItem->getNounAliases();
-            verbAliases = anItem->getVerbAliases();
-
-            for (auto noun : nounAliases){
-                location->registerAlias(false, noun, anItem);
-            }
-            for (auto verb : verbAliases){
-                location->registerAlias(true, verb, anItem);
-            }
+            batch.addObject(anItem);
 
             if (anItem->getObjectType() == ObjectType::CONTAINER){
                 aContainer = dynamic_cast<Container*>(anItem);
                 if (aContainer != nullptr){
                     contents = aContainer->getAllContents();
                     for (auto content : contents){
-                        nounAliases = content->getNounAliases();
-                        verbAliases = content->getVerbAliases();
-
-                        for (auto noun : nounAliases){
-                            location->registerAlias(false, noun, content);
-                        }
-                        for (auto verb : verbAliases){
-                            location->registerAlias(true, verb, content);
-                        }
+                        batch.addObject(content);
                     }
                 }
             }
+            if (location != nullptr){
+                location->applyLexicalBatch(batch);
+            }
         }
     }
     return success;
@@ -133,39 +120,26 @@ bool NonCombatant::removeFromInventory(Item *anItem){
     Container *aContainer = nullptr;
     std::vector<Item*> contents;
     Area *location = getLocation();
-    std::vector<std::string> nounAliases, verbAliases;
+    parser::LexicalBatch batch;
 
     if (anItem != nullptr){
         success = Character::removeFromInventory(anItem);
 
         if (success){
-            nounAliases = anItem->getNounAliases();
-            verbAliases = anItem->getVerbAliases();
-
-            for (auto noun : nounAliases){
-                location->unregisterAlias(false, noun, anItem);
-            }
-            for (auto verb : verbAliases){
-                location->unregisterAlias(true, verb, anItem);
-            }
+            batch.removeObject(anItem);
 
             if (anItem->getObjectType() == ObjectType::CONTAINER){
                 aContainer = dynamic_cast<Container*>(anItem);
                 if (aContainer != nullptr){
                     contents = aContainer->getAllContents();
                     for (auto content : contents){
-                        nounAliases = content->getNounAliases();
-                        verbAliases = content->getVerbAliases();
-
-                        for (auto noun : nounAliases){
-                            location->unregisterAlias(false, noun, content);
-                        }
-                        for (auto verb : verbAliases){
-                            location->unregisterAlias(true, verb, content);
-                        }
+                        batch.removeObject(content);
                     }
                 }
             }
+            if (location != nullptr){
+                location->applyLexicalBatch(batch);
+            }
         }
     }
     return success;
@@ -0,0 +1,129 @@
+/*********************************************************************//**
+ * \author      agent
+ * \created     10/19/2026
+ * \modified    10/19/2026
+ * \file        ObjectIndex.hpp
+ *
+ * \details     Header file for ObjectIndex class template. Defines the
+ *              members and functions needed to look up game objects by
+ *              the value of one of their attributes.
+ ************************************************************************/
+
+#ifndef OBJECT_INDEX_HPP
+#define OBJECT_INDEX_HPP
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+namespace legacymud { namespace engine {
+
+/*!
+ * \details     This class maps an attribute value (the key) to the objects
+ *              that currently have that value, such as the items of an
+ *              ItemType. It also remembers the key each object was added
+ *              with, so an object can be moved or removed without knowing
+ *              its old value.
+ *
+ *              Looking up a key is O(1) plus the number of objects found.
+ *              Updating or removing an object is O(k), where k is the
+ *              number of objects with the same key.
+ *
+ *              This class is not thread-safe. GameObjectManager locks its
+ *              indexes before using them.
+ */
+template <typename Key, typename Object>
+class ObjectIndex {
+    public:
+        /*!
+         * \brief   Adds the object under the specified key, or moves it there
+         *          if it was added under a different key.
+         *
+         * \param[in] anObject  Specifies the object to add.
+         * \param[in] aKey      Specifies the current value of the attribute.
+         */
+        void update(Object anObject, const Key &aKey){
+            auto found = keys.find(anObject);
+
+            if (found != keys.end()){
+                if (found->second == aKey){
+                    return;
+                }
+                eraseFromKey(anObject, found->second);
+                found->second = aKey;
+            } else {
+                keys[anObject] = aKey;
+            }
+            objects[aKey].push_back(anObject);
+        }
+
+        /*!
+         * \brief   Removes the object from the index.
+         *
+         * \param[in] anObject  Specifies the object to remove.
+         *
+         * \return  Returns a bool indicating whether the object was in the index.
+         */
+        bool remove(Object anObject){
+            auto found = keys.find(anObject);
+
+            if (found == keys.end()){
+                return false;
+            }
+            eraseFromKey(anObject, found->second);
+            keys.erase(found);
+            return true;
+        }
+
+        /*!
+         * \brief   Gets the objects added under the specified key.
+         *
+         * \param[in] aKey  Specifies the key to look up.
+         *
+         * \return  Returns the objects in the order they were added.
+         */
+        std::vector<Object> find(const Key &aKey) const{
+            auto found = objects.find(aKey);
+
+            if (found != objects.end()){
+                return found->second;
+            }
+            return std::vector<Object>();
+        }
+
+        /*!
+         * \brief   Gets the number of objects in the index.
+         *
+         * \return  Returns the number of objects.
+         */
+        size_t size() const{
+            return keys.size();
+        }
+
+        /*!
+         * \brief   Removes all objects from the index.
+         */
+        void clear(){
+            objects.clear();
+            keys.clear();
+        }
+    private:
+        void eraseFromKey(Object anObject, const Key &aKey){
+            auto found = objects.find(aKey);
+
+            if (found != objects.end()){
+                std::vector<Object> &keyObjects = found->second;
+                keyObjects.erase(std::remove(keyObjects.begin(), keyObjects.end(), anObject), keyObjects.end());
+                if (keyObjects.empty()){
+                    objects.erase(found);
+                }
+            }
+        }
+
+        std::unordered_map<Key, std::vector<Object>> objects;
+        std::unordered_map<Object, Key> keys;
+};
+
+}}
+
+#endif
@@ -0,0 +1,129 @@
+/*********************************************************************//**
+ * \author      agent
+ * \created     10/19/2026
+ * \modified    10/19/2026
+ * \file        ObjectRegistry.cpp
+ *
+ * \details     Implementation file for ObjectRegistry class. 
+ ************************************************************************/
+
+#include "ObjectRegistry.hpp"
+
+namespace legacymud { namespace engine {
+
+const int ObjectRegistry::SEGMENT_SIZE;
+const int ObjectRegistry::MAX_SEGMENTS;
+
+ObjectRegistry::ObjectRegistry(){
+    for (int i = 0; i < MAX_SEGMENTS; i++){
+        segments[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+
+ObjectRegistry::~ObjectRegistry(){
+    for (int i = 0; i < MAX_SEGMENTS; i++){
+        delete segments[i].load(std::memory_order_relaxed);
+    }
+}
+
+
+bool ObjectRegistry::inRange(int ID){
+    return (ID >= 0) && (ID / SEGMENT_SIZE < MAX_SEGMENTS);
+}
+
+
+bool ObjectRegistry::setObject(int ID, InteractiveNoun *anObject){
+    if (!inRange(ID)){
+        return false;
+    }
+
+    std::atomic<Segment*> &slot = segments[ID / SEGMENT_SIZE];
+    Segment *aSegment = slot.load(std::memory_order_acquire);
+    if (aSegment == nullptr){
+        if (anObject == nullptr){
+            // nothing to clear
+            return true;
+        }
+
+        // allocate the segment, unless another thread did it first
+        std::lock_guard<std::mutex> segmentsLock(segmentsMutex);
+        aSegment = slot.load(std::memory_order_acquire);
+        if (aSegment == nullptr){
+            aSegment = new Segment;
+            for (int i = 0; i < SEGMENT_SIZE; i++){
+                aSegment->objects[i].store(nullptr, std::memory_order_relaxed);
+                aSegment->generations[i].store(0, std::memory_order_relaxed);
+            }
+            slot.store(aSegment, std::memory_order_release);
+        }
+    }
+
+    // a different object gets a new generation before it becomes visible
+    int index = ID % SEGMENT_SIZE;
+    if ((anObject != nullptr) && (aSegment->objects[index].load(std::memory_order_acquire) != anObject)){
+        aSegment->generations[index].fetch_add(1, std::memory_order_acq_rel);
+    }
+    aSegment->objects[index].store(anObject, std::memory_order_release);
+    return true;
+}
+
+
+InteractiveNoun* ObjectRegistry::getObject(int ID) const{
+    if (!inRange(ID)){
+        return nullptr;
+    }
+
+    Segment *aSegment = segments[ID / SEGMENT_SIZE].load(std::memory_order_acquire);
+    if (aSegment == nullptr){
+        return nullptr;
+    }
+    return aSegment->objects[ID % SEGMENT_SIZE].load(std::memory_order_acquire);
+}
+
+
+ObjectHandle ObjectRegistry::getHandle(int ID) const{
+    if (!inRange(ID)){
+        return ObjectHandle(ID, 0);
+    }
+
+    Segment *aSegment = segments[ID / SEGMENT_SIZE].load(std::memory_order_acquire);
+    if (aSegment == nullptr){
+        return ObjectHandle(ID, 0);
+    }
+    return ObjectHandle(ID, aSegment->generations[ID % SEGMENT_SIZE].load(std::memory_order_acquire));
+}
+
+
+InteractiveNoun* ObjectRegistry::getObject(ObjectHandle aHandle) const{
+    if (!inRange(aHandle.ID) || (aHandle.generation == 0)){
+        return nullptr;
+    }
+
+    Segment *aSegment = segments[aHandle.ID / SEGMENT_SIZE].load(std::memory_order_acquire);
+    if (aSegment == nullptr){
+        return nullptr;
+    }
+
+    // the generation is updated before the object, so a replaced object fails the check
+    int index = aHandle.ID % SEGMENT_SIZE;
+    InteractiveNoun *anObject = aSegment->objects[index].load(std::memory_order_acquire);
+    if (aSegment->generations[index].load(std::memory_order_acquire) != aHandle.generation){
+        return nullptr;
+    }
+    return anObject;
+}
+
+
+void ObjectRegistry::clear(){
+    for (int i = 0; i < MAX_SEGMENTS; i++){
+        Segment *aSegment = segments[i].load(std::memory_order_acquire);
+        if (aSegment != nullptr){
+            for (int j = 0; j < SEGMENT_SIZE; j++){
+                aSegment->objects[j].store(nullptr, std::memory_order_release);
+            }
+        }
+    }
+}
+
+}}
@@ -0,0 +1,128 @@
+/*********************************************************************//**
+ * \author      agent
+ * \created     10/19/2026
+ * \modified    10/19/2026
+ * \file        ObjectRegistry.hpp
+ *
+ * \details     Header file for ObjectRegistry class and ObjectHandle struct.
+ *              Defines the members and functions needed to find game
+ *              objects by ID or handle without locking.
+ ************************************************************************/
+
+#ifndef OBJECT_REGISTRY_HPP
+#define OBJECT_REGISTRY_HPP
+
+#include <atomic>
+#include <mutex>
+
+namespace legacymud { namespace engine {
+
+class InteractiveNoun;
+
+/*!
+ * \details     This struct identifies one game object. The generation
+ *              changes whenever a different object is stored under the
+ *              same ID, such as when a paged-out zone is loaded again, so
+ *              a handle to the old object does not find the new one.
+ */
+struct ObjectHandle {
+    int ID;
+    unsigned int generation;
+
+    ObjectHandle() : ID(-1), generation(0) { }
+    ObjectHandle(int anID, unsigned int aGeneration) : ID(anID), generation(aGeneration) { }
+};
+
+/*!
+ * \details     This class maps object IDs to objects with a table indexed
+ *              by ID. IDs come from InteractiveNoun::nextID, so they are
+ *              small and dense. The table is split into segments that are
+ *              allocated the first time an ID in their range is set, and
+ *              are not freed until the registry is destroyed.
+ *
+ *              Each ID also has a generation that is incremented when a
+ *              different object is set, so ObjectHandles can be checked.
+ *
+ *              Looking up an ID is wait-free: it is two atomic loads and
+ *              never takes a lock. Setting an ID only locks to allocate a
+ *              new segment. IDs outside of the range returned by inRange()
+ *              cannot be stored, and the caller must keep them elsewhere.
+ */
+class ObjectRegistry {
+    public:
+        static const int SEGMENT_SIZE = 1024;
+        static const int MAX_SEGMENTS = 16384;
+
+        ObjectRegistry();
+        ObjectRegistry(const ObjectRegistry &otherRegistry) = delete;
+        ObjectRegistry & operator=(const ObjectRegistry &otherRegistry) = delete;
+        ~ObjectRegistry();
+
+        /*!
+         * \brief   Gets whether the specified ID can be stored in the registry.
+         *
+         * \param[in] ID    Specifies the ID to check.
+         *
+         * \return  Returns a bool indicating whether the ID is in range.
+         */
+        static bool inRange(int ID);
+
+        /*!
+         * \brief   Sets the object with the specified ID.
+         *
+         * \param[in] ID        Specifies the ID of the object.
+         * \param[in] anObject  Specifies the object, or nullptr to clear the ID.
+         *
+         * \return  Returns a bool indicating whether the ID is in range and
+         *          was set.
+         */
+        bool setObject(int ID, InteractiveNoun *anObject);
+
+        /*!
+         * \brief   Gets the object with the specified ID.
+         *
+         * \param[in] ID    Specifies the ID of the object.
+         *
+         * \return  Returns the object, or nullptr if no object has the ID
+         *          or the ID is out of range.
+         */
+        InteractiveNoun* getObject(int ID) const;
+
+        /*!
+         * \brief   Gets the handle of the object with the specified ID.
+         *
+         * \param[in] ID    Specifies the ID of the object.
+         *
+         * \return  Returns the handle, with generation 0 if no object has
+         *          been set for the ID or the ID is out of range.
+         */
+        ObjectHandle getHandle(int ID) const;
+
+        /*!
+         * \brief   Gets the object with the specified handle.
+         *
+         * \param[in] aHandle   Specifies the handle of the object.
+         *
+         * \return  Returns the object, or nullptr if the object was removed
+         *          or replaced by another object with the same ID.
+         */
+        InteractiveNoun* getObject(ObjectHandle aHandle) const;
+
+        /*!
+         * \brief   Clears all IDs in the registry.
+         */
+        void clear();
+
+    private:
+        struct Segment {
+            std::atomic<InteractiveNoun*> objects[SEGMENT_SIZE];
+            std::atomic<unsigned int> generations[SEGMENT_SIZE];
+        };
+
+        std::atomic<Segment*> segments[MAX_SEGMENTS];
+        std::mutex segmentsMutex;
+};
+
+}}
+
+#endif
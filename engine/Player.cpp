@@ -184,20 +184,17 @@ CharacterSize Player::getSize() const{
 
 
 std::string Player::getUser() const{
-    std::lock_guard<std::mutex> usernameLock(usernameMutex);
-    return username;
+    return username.get();
 }  
 
 
 PlayerClass* Player::getPlayerClass() const{
-    std::lock_guard<std::mutex> playerClassLock(playerClassMutex);
-    return playerClass;
+    return playerClass.load();
 }
 
 
 NonCombatant* Player::getInConversation() const{
-    std::lock_guard<std::mutex> inConversationLock(inConversationMutex);
-    return inConversation;
+    return inConversation.load();
 }
 
 
@@ -247,6 +244,11 @@ const parser::LexicalData& Player::getLexicalData() const{
 }
 
 
+parser::ParseCache& Player::getParseCache(){
+    return parseCache;
+}
+
+
 int Player::getSizeModifier() const{
     int modifier = 0;
     CharacterSize aSize = getSize();
@@ -371,12 +373,11 @@ bool Player::setSize(CharacterSize size){
 
 
 bool Player::setPlayerClass(PlayerClass *aClass){
-    std::lock_guard<std::mutex> playerClassLock(playerClassMutex);
-    removeAllLexicalData(playerClass);
-    removeAllLexicalData(playerClass->getSpecialSkill());
-    playerClass = aClass;
-    addAllLexicalData(playerClass);
-    addAllLexicalData(playerClass->getSpecialSkill());
+    PlayerClass *oldClass = playerClass.exchange(aClass);
+    removeAllLexicalData(oldClass);
+    removeAllLexicalData(oldClass->getSpecialSkill());
+    addAllLexicalData(aClass);
+    addAllLexicalData(aClass->getSpecialSkill());
 
     return true;
 }
@@ -405,8 +406,7 @@ bool Player::activate(int FD){
 
 
 bool Player::setInConversation(NonCombatant *anNPC){
-    std::lock_guard<std::mutex> inConversationLock(inConversationMutex);
-    inConversation = anNPC;
+    inConversation.store(anNPC);
 
     return true;
 }
@@ -467,22 +467,24 @@ bool Player::addToInventory(Item *anItem){
     bool success = false; 
     Container *aContainer = nullptr;
     std::vector<Item*> contents;
+    parser::LexicalBatch batch;
 
     if (anItem != nullptr){
         success = Character::addToInventory(anItem);
 
         if (success){
-            addAllLexicalData(anItem);
+            batch.addObject(anItem);
 
             if (anItem->getObjectType() == ObjectType::CONTAINER){
                 aContainer = dynamic_cast<Container*>(anItem);
                 if (aContainer != nullptr){
                     contents = aContainer->getAllContents();
                     for (auto content : contents){
-                        addAllLexicalData(content);
+                        batch.addObject(content);
                     }
                 }
             }
+            applyLexicalBatch(batch);
         }
     }
     return success;
@@ -493,22 +495,24 @@ bool Player::removeFromInventory(Item *anItem){
     bool success = false;  
     Container *aContainer = nullptr;
     std::vector<Item*> contents;
+    parser::LexicalBatch batch;
 
     if (anItem != nullptr){
         success = Character::removeFromInventory(anItem);
 
         if (success){
-            removeAllLexicalData(anItem);
+            batch.removeObject(anItem);
 
             if (anItem->getObjectType() == ObjectType::CONTAINER){
                 aContainer = dynamic_cast<Container*>(anItem);
                 if (aContainer != nullptr){
                     contents = aContainer->getAllContents();
                     for (auto content : contents){
-                        removeAllLexicalData(content);
+                        batch.removeObject(content);
                     }
                 }
             }
+            applyLexicalBatch(batch);
         }
     }
     return success;
@@ -516,38 +520,21 @@ bool Player::removeFromInventory(Item *anItem){
 
 
 void Player::addAllLexicalData(InteractiveNoun *anObject){
-    std::vector<std::string> nounAliases, verbAliases;
+    parser::LexicalBatch batch;
 
     if (anObject != nullptr){
-        std::lock_guard<std::mutex> lexicalLock(lexicalMutex);
-        nounAliases = anObject->getNounAliases();
-        verbAliases = anObject->getVerbAliases();
-
-        for (auto noun : nounAliases){
-            inventoryLexicalData.addNoun(noun, anObject);
-        }
-        for (auto verb : verbAliases){
-            inventoryLexicalData.addVerb(verb, anObject);
-        }
+        batch.addObject(anObject);
+        applyLexicalBatch(batch);
     }
-    
 }
 
 
 void Player::removeAllLexicalData(InteractiveNoun *anObject){
-    std::vector<std::string> nounAliases, verbAliases;
+    parser::LexicalBatch batch;
 
     if (anObject != nullptr){
-        std::lock_guard<std::mutex> lexicalLock(lexicalMutex);
-        nounAliases = anObject->getNounAliases();
-        verbAliases = anObject->getVerbAliases();
-
-        for (auto noun : nounAliases){
-            inventoryLexicalData.removeNoun(noun, anObject);
-        }
-        for (auto verb : verbAliases){
-            inventoryLexicalData.removeVerb(verb, anObject);
-        }
+        batch.removeObject(anObject);
+        applyLexicalBatch(batch);
     }
 }
 
@@ -646,6 +633,19 @@ bool Player::unregisterAlias(bool isVerb, std::string alias, InteractiveNoun *an
 }
 
 
+bool Player::applyLexicalBatch(const parser::LexicalBatch &batch){
+    std::lock_guard<std::mutex> lexicalLock(lexicalMutex);
+    inventoryLexicalData.apply(batch);
+    return true;
+}
+
+
+void Player::clearLexicalData(){
+    std::lock_guard<std::mutex> lexicalLock(lexicalMutex);
+    inventoryLexicalData.clear();
+}
+
+
 ObjectType Player::getObjectType() const{
     return ObjectType::PLAYER;
 }
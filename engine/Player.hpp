@@ -21,6 +21,7 @@
 #include <utility>
 #include <atomic>
 #include <mutex>
+#include "SharedString.hpp"
 #include "parser.hpp"
 #include "Combatant.hpp"
 #include "CharacterSize.hpp"
@@ -167,6 +168,13 @@ class Player: public Combatant {
          */
         const parser::LexicalData & getLexicalData() const;
 
+        /*!
+         * \brief   Gets the cache of this player's recent parse results.
+         *
+         * \return  Returns a reference to the parser::ParseCache of this player.
+         */
+        parser::ParseCache & getParseCache();
+
         virtual int getSizeModifier() const;
 
         virtual int getArmorBonus() const;
@@ -394,6 +402,24 @@ class Player: public Combatant {
          */
         virtual bool unregisterAlias(bool isVerb, std::string alias, InteractiveNoun *anObject);
 
+        /*!
+         * \brief   Applies a batch of alias changes to this player's lexical data.
+         * 
+         * \param[in] batch     Specifies the alias changes to apply.
+         *
+         * \return  Returns a bool indicating whether or not applying the
+         *          batch succeeded.
+         */
+        virtual bool applyLexicalBatch(const parser::LexicalBatch &batch);
+
+        /*!
+         * \brief   Unregisters every alias in this player's lexical data.
+         *
+         * This function is used when a player is removed from the game, so
+         * that the parser does not keep the inventory aliases alive.
+         */
+        void clearLexicalData();
+
         /*!
          * \brief   Gets the object type.
          *
@@ -688,12 +714,9 @@ class Player: public Combatant {
         std::atomic<int> experiencePoints;
         std::atomic<int> level;
         std::atomic<CharacterSize> size;
-        PlayerClass *playerClass;
-        mutable std::mutex playerClassMutex;
-        NonCombatant *inConversation;
-        mutable std::mutex inConversationMutex;
-        std::string username;
-        mutable std::mutex usernameMutex;
+        std::atomic<PlayerClass*> playerClass;
+        std::atomic<NonCombatant*> inConversation;
+        SharedString username;
         std::atomic<bool> active;
         std::atomic<int> fileDescriptor;
         std::queue<Command> combatQueue;
@@ -703,6 +726,7 @@ class Player: public Combatant {
         mutable std::mutex questListMutex;
         parser::LexicalData inventoryLexicalData;
         mutable std::mutex lexicalMutex;
+        parser::ParseCache parseCache;
         static std::map<int, int> xpLevelMap;
 };
 
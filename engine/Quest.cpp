@@ -77,14 +77,12 @@ Quest::~Quest(){
 
 
 std::string Quest::getName() const{
-    std::lock_guard<std::mutex> nameLock(nameMutex);
-    return name;
+    return name.get();
 }
 
 
 std::string Quest::getDescription() const{
-    std::lock_guard<std::mutex> descriptionLock(descriptionMutex);
-    return description;
+    return description.get();
 }
 
 
@@ -94,14 +92,12 @@ int Quest::getRewardMoney() const{
 
 
 Item* Quest::getRewardItem() const{
-    std::lock_guard<std::mutex> rewardItemLock(rewardItemMutex);
-    return rewardItem;
+    return rewardItem.load();
 }
 
 
 Item* Quest::getUniqueRewardItem() const{
-    std::lock_guard<std::mutex> rewardItemLock(rewardItemMutex);
-    Item *anItem = new Item(*rewardItem);
+    Item *anItem = new Item(*rewardItem.load());
     manager->addObject(anItem, -1);
 
     return anItem;
@@ -180,18 +176,14 @@ QuestStep* Quest::isGiverOrReceiver(NonCombatant *aNPC) const{
 
 
 bool Quest::setName(std::string name){
-    std::lock_guard<std::mutex> nameLock(nameMutex);
-    removeNounAlias(this->name);
-    addNounAlias(name);
-    this->name = name;
+    replaceName(this->name, name);
 
     return true;
 }
 
 
 bool Quest::setDescription(std::string description){
-    std::lock_guard<std::mutex> descriptionLock(descriptionMutex);
-    this->description = description;
+    this->description.set(description);
 
     return true;
 }
@@ -205,8 +197,7 @@ bool Quest::setRewardMoney(int money){
 
 
 bool Quest::setRewardItem(Item *rewardItem){
-    std::lock_guard<std::mutex> rewardItemLock(rewardItemMutex);
-    this->rewardItem = rewardItem;
+    this->rewardItem.store(rewardItem);
 
     return true;
 }
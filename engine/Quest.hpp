@@ -18,6 +18,7 @@
 #include <utility>
 #include <mutex>
 #include <atomic>
+#include "SharedString.hpp"
 #include "InteractiveNoun.hpp"
 #include "DataType.hpp"
 #include "ObjectType.hpp"
@@ -297,13 +298,10 @@ class Quest: public InteractiveNoun {
          */
         static std::map<std::string, DataType> getAttributeSignature();
     private:
-        std::string name;
-        mutable std::mutex nameMutex;
-        std::string description;
-        mutable std::mutex descriptionMutex;
+        SharedString name;
+        SharedString description;
         std::atomic<int> rewardMoney;
-        Item *rewardItem;
-        mutable std::mutex rewardItemMutex;
+        std::atomic<Item*> rewardItem;
         std::map<int, QuestStep*> steps;
         mutable std::mutex stepsMutex;
         GameObjectManager *manager;
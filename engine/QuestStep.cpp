@@ -83,32 +83,27 @@ int QuestStep::getOrdinalNumber() const{
 
 
 std::string QuestStep::getDescription() const{
-    std::lock_guard<std::mutex> descriptionLock(descriptionMutex);
-    return description;
+    return description.get();
 }
 
 
 ItemType* QuestStep::getFetchItem() const{
-    std::lock_guard<std::mutex> fetchItemLock(fetchItemMutex);
-    return fetchItem;
+    return fetchItem.load();
 }
 
 
 NonCombatant* QuestStep::getGiver() const{
-    std::lock_guard<std::mutex> giverLock(giverMutex);
-    return giver;
+    return giver.load();
 }
 
 
 NonCombatant* QuestStep::getReceiver() const{
-    std::lock_guard<std::mutex> receiverLock(receiverMutex);
-    return receiver;
+    return receiver.load();
 }
 
 
 std::string QuestStep::getCompletionText() const{
-    std::lock_guard<std::mutex> completionTextLock(completionTextMutex);
-    return completionText;
+    return completionText.get();
 }
 
 
@@ -124,17 +119,15 @@ bool QuestStep::setOrdinalNumber(int number){
 
 
 bool QuestStep::setDescription(std::string description){
-    std::lock_guard<std::mutex> descriptionLock(descriptionMutex);
-    this->description = description;
+    this->description.set(description);
 
     return true;
 }
 
 
 bool QuestStep::setFetchItem(ItemType *anItemType){
-    std::lock_guard<std::mutex> fetchItemLock(fetchItemMutex);
     if (anItemType != nullptr){
-        fetchItem = anItemType;
+        fetchItem.store(anItemType);
         return true;
     }
 
@@ -143,9 +136,8 @@ bool QuestStep::setFetchItem(ItemType *anItemType){
 
 
 bool QuestStep::setGiver(NonCombatant *giver){
-    std::lock_guard<std::mutex> giverLock(giverMutex);
     if (giver != nullptr){
-        this->giver = giver;
+        this->giver.store(giver);
         return true;
     }
 
@@ -154,9 +146,8 @@ bool QuestStep::setGiver(NonCombatant *giver){
 
 
 bool QuestStep::setReceiver(NonCombatant *receiver){
-    std::lock_guard<std::mutex> receiverLock(receiverMutex);
     if (receiver != nullptr){
-        this->receiver = receiver;
+        this->receiver.store(receiver);
         return true;
     }
 
@@ -165,16 +156,14 @@ bool QuestStep::setReceiver(NonCombatant *receiver){
 
 
 bool QuestStep::setCompletionText(std::string completionText){
-    std::lock_guard<std::mutex> completionTextLock(completionTextMutex);
-    this->completionText = completionText;
+    this->completionText.set(completionText);
 
     return true;
 } 
 
 
 std::string QuestStep::getName() const{
-    std::lock_guard<std::mutex> descriptionLock(descriptionMutex);
-    return description;
+    return description.get();
 }
 
 
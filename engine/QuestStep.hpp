@@ -16,6 +16,7 @@
 #include <string>
 #include <mutex>
 #include <atomic>
+#include "SharedString.hpp"
 #include "InteractiveNoun.hpp"
 #include "DataType.hpp"
 #include "ObjectType.hpp"
@@ -238,16 +239,11 @@ class QuestStep: public InteractiveNoun {
         static std::map<std::string, DataType> getAttributeSignature();
     private:
         std::atomic<int> ordinalNumber;
-        std::string description;
-        mutable std::mutex descriptionMutex;
-        ItemType *fetchItem;
-        mutable std::mutex fetchItemMutex;
-        NonCombatant *giver;
-        mutable std::mutex giverMutex;
-        NonCombatant *receiver;
-        mutable std::mutex receiverMutex;
-        std::string completionText;
-        mutable std::mutex completionTextMutex;
+        SharedString description;
+        std::atomic<ItemType*> fetchItem;
+        std::atomic<NonCombatant*> giver;
+        std::atomic<NonCombatant*> receiver;
+        SharedString completionText;
 };
 
 }}
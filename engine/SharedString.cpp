@@ -0,0 +1,139 @@
+/*********************************************************************//**
+ * \author      agent
+ * \created     10/19/2026
+ * \modified    10/19/2026
+ * \file        SharedString.cpp
+ *
+ * \details     Implementation file for SharedString class.
+ ************************************************************************/
+
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+#include "SharedString.hpp"
+
+namespace legacymud { namespace engine {
+
+namespace {
+
+// Hashes and compares the text the pointers point to, so the table can be
+// searched by value without storing a second copy of each string.
+struct TextHash {
+    std::size_t operator()(const std::string *text) const{
+        return std::hash<std::string>()(*text);
+    }
+};
+
+struct TextEqual {
+    bool operator()(const std::string *text, const std::string *otherText) const{
+        return *text == *otherText;
+    }
+};
+
+struct InternTable {
+    std::mutex lock;
+    std::unordered_map<const std::string*, std::weak_ptr<const std::string>, TextHash, TextEqual> strings;
+};
+
+// The table is never destroyed, so strings released during static
+// destruction can still remove themselves.
+InternTable& getInternTable(){
+    static InternTable *aTable = new InternTable;
+    return *aTable;
+}
+
+// Removes a string from the table when the last SharedString using it
+// releases it. The string stays in the table until it is deleted, so the
+// key pointers in the table are always valid.
+struct ReleaseText {
+    void operator()(const std::string *text) const{
+        InternTable &aTable = getInternTable();
+        std::unique_lock<std::mutex> tableLock(aTable.lock);
+        auto found = aTable.strings.find(text);
+
+        // a newer string with the same text may have replaced this one
+        if ((found != aTable.strings.end()) && (found->first == text)){
+            aTable.strings.erase(found);
+        }
+        tableLock.unlock();
+        delete text;
+    }
+};
+
+// all empty strings share one value, so default construction doesn't allocate
+std::shared_ptr<const std::string> getEmptyString(){
+    static std::shared_ptr<const std::string> *emptyString = new std::shared_ptr<const std::string>(std::make_shared<const std::string>());
+    return *emptyString;
+}
+
+}
+
+SharedString::SharedString() : value(getEmptyString()) { }
+
+
+SharedString::SharedString(std::string value) : value(intern(std::move(value))) { }
+
+
+SharedString::SharedString(const SharedString &otherString) : value(otherString.share()) { }
+
+
+SharedString & SharedString::operator=(const SharedString &otherString){
+    if (this != &otherString){
+        std::atomic_store(&value, otherString.share());
+    }
+    return *this;
+}
+
+
+std::string SharedString::get() const{
+    return *share();
+}
+
+
+std::shared_ptr<const std::string> SharedString::share() const{
+    return std::atomic_load(&value);
+}
+
+
+void SharedString::set(std::string value){
+    std::atomic_store(&this->value, intern(std::move(value)));
+}
+
+
+std::string SharedString::exchange(std::string value){
+    return *std::atomic_exchange(&this->value, intern(std::move(value)));
+}
+
+
+std::size_t SharedString::getNumInterned(){
+    InternTable &aTable = getInternTable();
+    std::lock_guard<std::mutex> tableLock(aTable.lock);
+    return aTable.strings.size();
+}
+
+
+std::shared_ptr<const std::string> SharedString::intern(std::string value){
+    if (value.empty()){
+        return getEmptyString();
+    }
+
+    InternTable &aTable = getInternTable();
+    std::lock_guard<std::mutex> tableLock(aTable.lock);
+    auto found = aTable.strings.find(&value);
+
+    if (found != aTable.strings.end()){
+        std::shared_ptr<const std::string> existing = found->second.lock();
+        if (existing != nullptr){
+            return existing;
+        }
+        // the last user released it and it is waiting to be removed
+        aTable.strings.erase(found);
+    }
+
+    const std::string *text = new const std::string(std::move(value));
+    std::shared_ptr<const std::string> shared(text, ReleaseText());
+    aTable.strings[text] = shared;
+    return shared;
+}
+
+}}
@@ -0,0 +1,95 @@
+/*********************************************************************//**
+ * \author      agent
+ * \created     10/19/2026
+ * \modified    10/19/2026
+ * \file        SharedString.hpp
+ *
+ * \details     Header file for SharedString class. Defines the members
+ *              and functions needed to share a string field between
+ *              threads without a mutex per field.
+ ************************************************************************/
+
+#ifndef SHARED_STRING_HPP
+#define SHARED_STRING_HPP
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace legacymud { namespace engine {
+
+/*!
+ * \details     This class holds an immutable, interned string through a 
+ *              shared pointer. Setting the value replaces the pointer instead of
+ *              changing the string, so readers never see a partial write
+ *              and do not need a lock. A reader that keeps the pointer
+ *              from share() keeps its version of the string alive even
+ *              if the value is set again.
+ *
+ *              Strings are interned: every SharedString set to the same
+ *              text shares one copy of it, and copying a SharedString only
+ *              copies the pointer. A world built by copying the same item
+ *              stores its name and description once. The text is freed when
+ *              the last SharedString using it changes or is destroyed.
+ *
+ *              It is meant for fields like names and descriptions, which
+ *              are read on every look or describe but rarely change. It
+ *              takes 16 bytes, compared to 32 for a std::string plus 40
+ *              for the std::mutex that used to guard it.
+ */
+class SharedString {
+    public:
+        SharedString();
+        SharedString(std::string value);
+        SharedString(const SharedString &otherString);
+        SharedString & operator=(const SharedString &otherString);
+
+        /*!
+         * \brief   Gets a copy of the value.
+         *
+         * \return  Returns the value.
+         */
+        std::string get() const;
+
+        /*!
+         * \brief   Gets the value without copying it.
+         *
+         * \return  Returns a pointer to the value. The string does not
+         *          change, even if the value is set again.
+         */
+        std::shared_ptr<const std::string> share() const;
+
+        /*!
+         * \brief   Sets the value.
+         *
+         * \param[in] value     Specifies the new value.
+         */
+        void set(std::string value);
+
+        /*!
+         * \brief   Sets the value and gets the value it replaced as one
+         *          atomic operation.
+         *
+         * \param[in] value     Specifies the new value.
+         *
+         * \return  Returns the old value.
+         */
+        std::string exchange(std::string value);
+
+        /*!
+         * \brief   Gets the number of distinct non-empty strings in use.
+         *
+         * \return  Returns the number of interned strings.
+         */
+        static std::size_t getNumInterned();
+    private:
+        // Gets the shared copy of the text, adding it if it is not in use.
+        static std::shared_ptr<const std::string> intern(std::string value);
+
+        // only accessed through the std::atomic_* functions for shared_ptr
+        std::shared_ptr<const std::string> value;
+};
+
+}}
+
+#endif
@@ -0,0 +1,181 @@
+/*********************************************************************//**
+ * \author      agent
+ * \created     10/19/2026
+ * \modified    10/19/2026
+ * \file        SlabAllocator.cpp
+ *
+ * \details     Implementation file for SlabAllocator class.
+ ************************************************************************/
+
+#include <algorithm>
+#include <mutex>
+#include <new>
+#include <vector>
+#include "SlabAllocator.hpp"
+
+namespace legacymud { namespace engine {
+
+namespace {
+
+// Each block starts with a pointer to its slab, padded to the alignment,
+// so deallocate() can find the slab without searching.
+struct Slab {
+    char *memory;
+    std::size_t stride;
+    std::size_t capacity;
+    std::size_t used;
+    std::size_t live;
+    char *freeList;
+    bool isPartial;
+};
+
+// The slabs of one size class. Slabs that had a block released while they
+// were not the current slab are kept in partial, so allocate() can reuse
+// their blocks before it allocates a new slab.
+struct Pool {
+    std::mutex lock;
+    std::vector<Slab*> slabs;
+    std::vector<Slab*> partial;
+    Slab *current = nullptr;
+};
+
+const std::size_t NUM_POOLS = SlabAllocator::MAX_BLOCK_SIZE / SlabAllocator::ALIGNMENT + 1;
+
+// The pools are never destroyed, so objects deleted during static
+// destruction can still be released.
+Pool* getPools(){
+    static Pool *pools = new Pool[NUM_POOLS];
+    return pools;
+}
+
+std::size_t getSizeClass(std::size_t size){
+    return (std::max(size, static_cast<std::size_t>(1)) + SlabAllocator::ALIGNMENT - 1) / SlabAllocator::ALIGNMENT;
+}
+
+char*& getNextFree(char *block){
+    return *reinterpret_cast<char**>(block + SlabAllocator::ALIGNMENT);
+}
+
+}
+
+const std::size_t SlabAllocator::SLAB_SIZE;
+const std::size_t SlabAllocator::MAX_BLOCK_SIZE;
+const std::size_t SlabAllocator::ALIGNMENT;
+
+void* SlabAllocator::allocate(std::size_t size){
+    if (size > MAX_BLOCK_SIZE){
+        return ::operator new(size);
+    }
+
+    std::size_t sizeClass = getSizeClass(size);
+    Pool &pool = getPools()[sizeClass];
+    std::lock_guard<std::mutex> poolLock(pool.lock);
+    Slab *aSlab = pool.current;
+
+    if ((aSlab == nullptr) || (aSlab->live == aSlab->capacity)){
+        aSlab = nullptr;
+        while ((aSlab == nullptr) && !pool.partial.empty()){
+            Slab *candidate = pool.partial.back();
+            pool.partial.pop_back();
+            candidate->isPartial = false;
+            if (candidate->live < candidate->capacity){
+                aSlab = candidate;
+            }
+        }
+        if (aSlab == nullptr){
+            aSlab = new Slab;
+            aSlab->memory = static_cast<char*>(::operator new(SLAB_SIZE));
+            aSlab->stride = ALIGNMENT + sizeClass * ALIGNMENT;
+            aSlab->capacity = SLAB_SIZE / aSlab->stride;
+            aSlab->used = 0;
+            aSlab->live = 0;
+            aSlab->freeList = nullptr;
+            aSlab->isPartial = false;
+            pool.slabs.push_back(aSlab);
+        }
+        pool.current = aSlab;
+    }
+
+    // reuse a released block, otherwise take the next unused one
+    char *block = aSlab->freeList;
+    if (block != nullptr){
+        aSlab->freeList = getNextFree(block);
+    } else {
+        block = aSlab->memory + aSlab->used * aSlab->stride;
+        aSlab->used++;
+    }
+    aSlab->live++;
+
+    *reinterpret_cast<Slab**>(block) = aSlab;
+    return block + ALIGNMENT;
+}
+
+
+void SlabAllocator::deallocate(void *ptr, std::size_t size){
+    if (ptr == nullptr){
+        return;
+    }
+    if (size > MAX_BLOCK_SIZE){
+        ::operator delete(ptr);
+        return;
+    }
+
+    char *block = static_cast<char*>(ptr) - ALIGNMENT;
+    Slab *aSlab = *reinterpret_cast<Slab**>(block);
+    Pool &pool = getPools()[getSizeClass(size)];
+    std::lock_guard<std::mutex> poolLock(pool.lock);
+
+    getNextFree(block) = aSlab->freeList;
+    aSlab->freeList = block;
+    aSlab->live--;
+
+    if ((aSlab != pool.current) && !aSlab->isPartial){
+        aSlab->isPartial = true;
+        pool.partial.push_back(aSlab);
+    }
+}
+
+
+std::size_t SlabAllocator::trim(){
+    std::size_t numFreed = 0;
+    Pool *pools = getPools();
+
+    for (std::size_t i = 0; i < NUM_POOLS; i++){
+        std::lock_guard<std::mutex> poolLock(pools[i].lock);
+        auto it = pools[i].slabs.begin();
+        while (it != pools[i].slabs.end()){
+            Slab *aSlab = *it;
+            if (aSlab->live == 0){
+                if (aSlab->isPartial){
+                    pools[i].partial.erase(std::remove(pools[i].partial.begin(), pools[i].partial.end(), aSlab), pools[i].partial.end());
+                }
+                if (pools[i].current == aSlab){
+                    pools[i].current = nullptr;
+                }
+                ::operator delete(aSlab->memory);
+                delete aSlab;
+                it = pools[i].slabs.erase(it);
+                numFreed++;
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    return numFreed;
+}
+
+
+std::size_t SlabAllocator::getNumSlabs(){
+    std::size_t numSlabs = 0;
+    Pool *pools = getPools();
+
+    for (std::size_t i = 0; i < NUM_POOLS; i++){
+        std::lock_guard<std::mutex> poolLock(pools[i].lock);
+        numSlabs += pools[i].slabs.size();
+    }
+
+    return numSlabs;
+}
+
+}}
@@ -0,0 +1,79 @@
+/*********************************************************************//**
+ * \author      agent
+ * \created     10/19/2026
+ * \modified    10/19/2026
+ * \file        SlabAllocator.hpp
+ *
+ * \details     Header file for SlabAllocator class. Defines the members
+ *              and functions needed to allocate game objects from large
+ *              blocks of memory instead of one heap allocation per object.
+ ************************************************************************/
+
+#ifndef SLAB_ALLOCATOR_HPP
+#define SLAB_ALLOCATOR_HPP
+
+#include <cstddef>
+
+namespace legacymud { namespace engine {
+
+/*!
+ * \details     This class allocates objects of the same size class from
+ *              shared slabs of SLAB_SIZE bytes. Objects of a class are
+ *              then stored next to each other, and loading a world only
+ *              makes one heap allocation for every slab that fills up.
+ *
+ *              Classes use it by declaring a class-specific operator new
+ *              and operator delete that call allocate() and deallocate().
+ *              Sizes over MAX_BLOCK_SIZE use the global operator new.
+ *
+ *              Slabs stay allocated while they have any live objects.
+ *              trim() frees the empty ones, for example after a zone is
+ *              paged out and its objects are reclaimed.
+ *
+ *              All functions are thread-safe. Each size class has its own
+ *              lock.
+ */
+class SlabAllocator {
+    public:
+        static const std::size_t SLAB_SIZE = 64 * 1024;
+        static const std::size_t MAX_BLOCK_SIZE = 4096;
+        static const std::size_t ALIGNMENT = 16;
+
+        SlabAllocator() = delete;
+
+        /*!
+         * \brief   Allocates memory for an object of the specified size.
+         *
+         * \param[in] size  Specifies the size of the object in bytes.
+         *
+         * \return  Returns a pointer to the memory. Throws std::bad_alloc
+         *          if no memory is available.
+         */
+        static void* allocate(std::size_t size);
+
+        /*!
+         * \brief   Releases memory returned by allocate().
+         *
+         * \param[in] ptr   Specifies the memory to release. nullptr is ignored.
+         * \param[in] size  Specifies the size that was passed to allocate().
+         */
+        static void deallocate(void *ptr, std::size_t size);
+
+        /*!
+         * \brief   Frees all slabs that have no live objects.
+         *
+         * \return  Returns the number of slabs that were freed.
+         */
+        static std::size_t trim();
+
+        /*!
+         * \brief   Gets the number of slabs that are allocated.
+         *
+         * \return  Returns the number of slabs in all size classes.
+         */
+        static std::size_t getNumSlabs();
+};
+
+}}
+
+#endif
@@ -64,8 +64,7 @@ SpecialSkill::SpecialSkill(std::string name, int damage, DamageType type, int co
 
 
 std::string SpecialSkill::getName() const{
-    std::lock_guard<std::mutex> nameLock(nameMutex);
-    return name;
+    return name.get();
 }
 
 
@@ -90,10 +89,7 @@ time_t SpecialSkill::getCooldown() const{
 
 
 bool SpecialSkill::setName(std::string name){
-    std::lock_guard<std::mutex> nameLock(nameMutex);
-    removeNounAlias(this->name);
-    addNounAlias(name);
-    this->name = name;
+    replaceName(this->name, name);
 
     return true;
 }
@@ -18,6 +18,7 @@
 #include <atomic>
 #include <vector>
 #include <ctime>
+#include "SharedString.hpp"
 #include "InteractiveNoun.hpp"
 #include "DamageType.hpp"
 #include "DataType.hpp"
@@ -250,8 +251,7 @@ class SpecialSkill: public InteractiveNoun {
          */
         static std::map<std::string, DataType> getAttributeSignature();
     private:
-        std::string name;
-        mutable std::mutex nameMutex;
+        SharedString name;
         std::atomic<int> damage;
         std::atomic<DamageType> damageType;
         std::atomic<int> cost;
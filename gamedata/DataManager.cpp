@@ -2,16 +2,28 @@
   \file     DataManager.cpp
   \author   Keith Adkins
   \created  2/20/2017
-  \modified 3/7/2017
+  \modified 10/19/2026
   \course   CS467, Winter 2017
  
   \details  Implementation file for the DataManager class.
 */
 
 #include <fstream>
+#include <cstdio>
 #include <string>
 #include <vector>
 #include <map>
+#include <set>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <deque>
+#include <sys/stat.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
 #include <rapidjson/document.h>
 #include <rapidjson/writer.h>
 #include <rapidjson/prettywriter.h>
@@ -36,20 +48,748 @@
 #include <WeaponType.hpp>
 #include <ItemPosition.hpp>
 #include "DataManager.hpp"
+#include "Journal.hpp"
 
 #include <iostream>
 
 namespace legacymud { namespace gamedata {
 
+namespace {
+    // Maps an object ID to its class array and position in a game data document.
+    typedef std::map<int, std::pair<std::string, rapidjson::SizeType>> ObjectIndex;
+
+    // A player file queued by savePlayer that has not been written yet.
+    struct PendingPlayerFile {
+        std::string directory;
+        std::string contents;
+        unsigned long generation = 0;
+        bool queued = false;
+    };
+
+    // Player files queued by savePlayer, written in order by one writer thread.
+    // Saving a player again before its file is written replaces the contents, so
+    // only the newest version reaches the disk.  The mutex only guards this
+    // bookkeeping; the writer does not hold it while writing.
+    struct PlayerFiles {
+        std::mutex lock;
+        std::condition_variable queueCond;
+        std::condition_variable doneCond;
+        std::map<std::string, PendingPlayerFile> pending;
+        std::deque<std::string> queue;
+        unsigned long lastGeneration = 0;
+    };
+
+    void playerFileWriterLoop();
+
+    // Never destroyed, so the writer thread never uses it after static destruction.
+    PlayerFiles& getPlayerFiles() {
+        static PlayerFiles *playerFiles = new PlayerFiles;
+        static std::once_flag writerStarted;
+        std::call_once(writerStarted, []{ std::thread(playerFileWriterLoop).detach(); });
+        return *playerFiles;
+    }
+
+    /*!
+      \brief Indexes every object in a game data document by ID.
+    */
+    ObjectIndex indexObjects(rapidjson::Document &dom) {
+        ObjectIndex objectIndex;
+        for (auto& member : dom.GetObject()) {
+            if (!member.value.IsArray())
+                continue;
+            std::string className = member.name.GetString();
+            for (rapidjson::SizeType i = 0; i < member.value.Size(); i++) {
+                objectIndex[member.value[i]["interactive_noun_data"]["id"].GetInt()] = std::make_pair(className, i);
+            }
+        }
+        return objectIndex;
+    }
+
+    /*!
+      \brief Replaces the object with the same ID or appends it to its class array.
+    */
+    void putObject(rapidjson::Document &dom, ObjectIndex &objectIndex, const rapidjson::Value &object) {
+        std::string className = object["class"].GetString();
+        int id = object["interactive_noun_data"]["id"].GetInt();
+        if (!dom.HasMember(className.c_str()))
+            return;
+
+        auto found = objectIndex.find(id);
+        if ((found != objectIndex.end()) && (found->second.first == className)) {
+            dom[className.c_str()][found->second.second].CopyFrom(object, dom.GetAllocator());
+        }
+        else {
+            if (found != objectIndex.end())
+                dom[found->second.first.c_str()][found->second.second].SetNull();
+            rapidjson::Value &classArray = dom[className.c_str()];
+            classArray.PushBack(rapidjson::Value(object, dom.GetAllocator()), dom.GetAllocator());
+            objectIndex[id] = std::make_pair(className, classArray.Size() - 1);
+        }
+    }
+
+    /*!
+      \brief Marks an object as removed.  dropRemovedObjects deletes it later so
+             that the positions held in the index stay valid.
+    */
+    void removeObject(rapidjson::Document &dom, ObjectIndex &objectIndex, int id) {
+        auto found = objectIndex.find(id);
+        if (found != objectIndex.end()) {
+            dom[found->second.first.c_str()][found->second.second].SetNull();
+            objectIndex.erase(found);
+        }
+    }
+
+    /*!
+      \brief Deletes every object marked as removed.
+    */
+    void dropRemovedObjects(rapidjson::Document &dom) {
+        for (auto& member : dom.GetObject()) {
+            if (!member.value.IsArray())
+                continue;
+            for (auto element = member.value.Begin(); element != member.value.End(); ) {
+                if (element->IsNull())
+                    element = member.value.Erase(element);
+                else
+                    element++;
+            }
+        }
+    }
+
+    /*!
+      \brief Raises the document's nextID to at least the given value.
+    */
+    void raiseNextID(rapidjson::Document &dom, int nextID) {
+        if (nextID > dom["nextID"].GetInt())
+            dom["nextID"].SetInt(nextID);
+    }
+
+    /*!
+      \brief Writes a temporary file and flushes it to disk.
+    */
+    bool writeTempFile(std::string tempFilename, const std::string &contents) {
+        int fd = ::open(tempFilename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd == -1)
+            return false;       // error opening file
+
+        bool success = Journal::writeAll(fd, contents) && (::fsync(fd) == 0);
+        if ((::close(fd) != 0) || !success) {
+            std::remove(tempFilename.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    /*!
+      \brief Writes a file through a temporary file so a crash never leaves it truncated.
+    */
+    bool writeFile(std::string filename, const std::string &contents) {
+        std::string tempFilename = filename + ".tmp";
+        if (!writeTempFile(tempFilename, contents))
+            return false;
+
+        if (std::rename(tempFilename.c_str(), filename.c_str()) != 0) {
+            std::remove(tempFilename.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    /*!
+      \brief Writes the player files queued by savePlayer, one at a time.
+
+      The file is written and flushed without holding the lock.  It only replaces
+      the player file if it is still the newest version and saveGame has not made
+      it obsolete in the meantime.
+    */
+    void playerFileWriterLoop() {
+        PlayerFiles &playerFiles = getPlayerFiles();
+        std::unique_lock<std::mutex> playerFileLock(playerFiles.lock);
+
+        while (true) {
+            playerFiles.queueCond.wait(playerFileLock, [&]{ return !playerFiles.queue.empty(); });
+            std::string playerFilename = playerFiles.queue.front();
+            playerFiles.queue.pop_front();
+            auto next = playerFiles.pending.find(playerFilename);
+            if ((next == playerFiles.pending.end()) || !next->second.queued)
+                continue;       // cancelled by saveGame
+            next->second.queued = false;
+            std::string directory = next->second.directory;
+            std::string contents = next->second.contents;
+            unsigned long generation = next->second.generation;
+            playerFileLock.unlock();
+
+            mkdir(directory.c_str(), 0755);
+            std::string tempFilename = playerFilename + ".tmp";
+            bool written = writeTempFile(tempFilename, contents);
+
+            playerFileLock.lock();
+            auto newest = playerFiles.pending.find(playerFilename);
+            if ((newest != playerFiles.pending.end()) && (newest->second.generation == generation)) {
+                if (!written || (std::rename(tempFilename.c_str(), playerFilename.c_str()) != 0)) {
+                    std::cerr << "Failed to save player file " << playerFilename << std::endl;
+                    std::remove(tempFilename.c_str());
+                }
+                playerFiles.pending.erase(newest);
+                playerFiles.doneCond.notify_all();
+            }
+            else if (written) {
+                // replaced by a newer save or made obsolete by saveGame
+                std::remove(tempFilename.c_str());
+            }
+        }
+    }
+
+    /*!
+      \brief Writes a JSON value to a string for the deserialize functions.
+    */
+    std::string toJsonString(const rapidjson::Value &jsonObject) {
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);  
+        jsonObject.Accept(writer);    
+        return buffer.GetString();
+    }
+
+    /*!
+      \brief Adds a deserialized item to the area, character or container that holds it.
+    */
+    void placeItem(engine::Item *anItem) {
+        switch (anItem->getPosition()) {
+        case engine::ItemPosition::NONE :
+            break;
+        case engine::ItemPosition::GROUND :     // adds item to an area            
+            static_cast<engine::Area*>(anItem->getLocation())->addItem(anItem);         
+            break;
+        case engine::ItemPosition::INVENTORY :  // adds item to a character             
+            static_cast<engine::Character*>(anItem->getLocation())->addToInventory(anItem);  
+            break;
+        case engine::ItemPosition::EQUIPPED :   // adds item to a character                                        
+            static_cast<engine::Character*>(anItem->getLocation())->equipItem(anItem);       
+            break;    
+        case engine::ItemPosition::IN :         // adds item to a container
+            static_cast<engine::Container*>(anItem->getLocation())->place(anItem, engine::ItemPosition::IN); 
+            break; 
+        case engine::ItemPosition::ON :         // adds item to a container                        
+            static_cast<engine::Container*>(anItem->getLocation())->place(anItem, engine::ItemPosition::ON); 
+            break; 
+        case engine::ItemPosition::UNDER :      // adds item to a container                  
+            static_cast<engine::Container*>(anItem->getLocation())->place(anItem, engine::ItemPosition::UNDER); 
+            break;             
+        } 
+    }
+
+    /*!
+      \brief Deserializes containers and items and places them in their locations.
+
+      Containers can sit inside other containers, so the containers are loaded in
+      passes until all of them are loaded or a pass makes no progress.  If loaded
+      is not null, every object loaded is appended to it.
+    */
+    void loadItems(rapidjson::Value &containers, rapidjson::Value &items, engine::GameObjectManager *gom,
+                   std::vector<engine::InteractiveNoun*> *loaded = nullptr) {
+        std::vector<bool> placed(containers.Size(), false);
+        bool progress = true;
+        while (progress) {
+            progress = false;
+            for (rapidjson::SizeType i = 0; i < containers.Size(); i++) {
+                if (placed[i])
+                    continue;
+
+                // Deserialize the data and rebuild it's object.
+                engine::Container *rebuiltContainer = engine::Container::deserialize(toJsonString(containers[i]), gom);
+                if (rebuiltContainer != nullptr) {  
+                    placeItem(rebuiltContainer);
+                    gom->addObject(rebuiltContainer,-1);  
+                    if (loaded != nullptr)
+                        loaded->push_back(rebuiltContainer);
+                    placed[i] = true;
+                    progress = true;
+                }
+            }
+        }
+
+        for (auto& jsonObject : items.GetArray()) {          
+            // Deserialize the data and rebuild it's object.
+            engine::Item *rebuiltItem = engine::Item::deserialize(toJsonString(jsonObject), gom);
+            placeItem(rebuiltItem);
+            gom->addObject(rebuiltItem,-1);      
+            if (loaded != nullptr)
+                loaded->push_back(rebuiltItem);
+        }
+    }
+
+    /*!
+      \brief Checks that the objects a player or zone file refers to exist.
+
+      A file is skipped if the player classes, areas, item types or creature
+      types it refers to were deleted from the world after it was written.
+    */
+    bool fileResolves(const rapidjson::Document &fileDoc, std::function<bool(int)> exists) {
+        static const char *referenceFields[] = { "player_class_id", "location_area_id", "spawn_location_id",
+                                                 "item_type_id", "location", "creature_type_id", "location_id",
+                                                 "connect_area_id", "condition_itemtype_id" };
+        std::set<int> fileIds;
+        for (auto& member : fileDoc.GetObject()) {
+            if (!member.value.IsArray())
+                continue;
+            for (auto& object : member.value.GetArray()) {
+                if (object.IsObject())
+                    fileIds.insert(object["interactive_noun_data"]["id"].GetInt());
+            }
+        }
+        auto resolves = [&](int id) { return exists(id) || (fileIds.count(id) > 0); };
+
+        for (auto& member : fileDoc.GetObject()) {
+            if (!member.value.IsArray())
+                continue;
+            for (auto& object : member.value.GetArray()) {
+                if (!object.IsObject())
+                    continue;
+                for (const char *field : referenceFields) {
+                    if (object.HasMember(field) && !resolves(object[field].GetInt()))
+                        return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    /*!
+      \brief Lists the .json files in a directory.
+    */
+    std::vector<std::string> listJsonFiles(std::string directoryName) {
+        std::vector<std::string> filenames;
+        DIR *directory = opendir(directoryName.c_str());
+        if (directory == nullptr)
+            return filenames;
+
+        struct dirent *entry;
+        while ((entry = readdir(directory)) != nullptr) {
+            std::string name = entry->d_name;
+            if ((name.size() > 5) && (name.compare(name.size() - 5, 5, ".json") == 0))
+                filenames.push_back(directoryName + "/" + name);
+        }
+        closedir(directory);
+
+        return filenames;
+    }
+
+    /*!
+      \brief Reads and parses a JSON file.
+
+      \post Returns true if the file was read and holds a JSON object.  Otherwise, it returns false.
+    */
+    bool readDocument(std::string filename, rapidjson::Document &fileDoc) {
+        std::ifstream inFile(filename);
+        if (!inFile.is_open())
+            return false;       // error opening file
+        std::string fileData((std::istreambuf_iterator<char>(inFile)), std::istreambuf_iterator<char>());
+        inFile.close();
+
+        fileDoc.Parse(fileData.c_str());
+        return !fileDoc.HasParseError() && fileDoc.IsObject();
+    }
+
+    /*!
+      \brief Merges the per-player files written by savePlayer into a game data document.
+
+      \param[in]     playerDirectory   directory holding the player files
+      \param[in,out] dom               game data document to update
+      \param[in,out] objectIndex       index of the objects in dom
+
+      \post Returns the number of player files merged.
+    */
+    int mergePlayerFiles(std::string playerDirectory, rapidjson::Document &dom, ObjectIndex &objectIndex) {
+        int merged = 0;
+        for (auto& filename : listJsonFiles(playerDirectory)) {
+            rapidjson::Document playerDoc;
+            if (!readDocument(filename, playerDoc) || !playerDoc.HasMember("PLAYER") ||
+                !fileResolves(playerDoc, [&](int id) { return objectIndex.count(id) > 0; })) {
+                std::cerr << "Skipping player file " << filename << std::endl;
+                continue;
+            }
+
+            for (auto& member : playerDoc.GetObject()) {
+                if (!member.value.IsArray())
+                    continue;
+                for (auto& object : member.value.GetArray()) {
+                    putObject(dom, objectIndex, object);
+                }
+            }
+            raiseNextID(dom, playerDoc["nextID"].GetInt());
+            merged++;
+        }
+
+        return merged;
+    }
+
+    /*!
+      \brief Drops the objects held in zone files from a game data document.
+
+      A paged out zone's contents live only in its zone file until the zone is
+      paged back in, so the zone file wins over anything the save or the
+      journal holds for the same objects.
+
+      \param[in]     zoneDirectory     directory holding the zone files
+      \param[in,out] dom               game data document to update
+      \param[in,out] objectIndex       index of the objects in dom
+
+      \post Returns the number of zone files applied.
+    */
+    int dropZoneObjects(std::string zoneDirectory, rapidjson::Document &dom, ObjectIndex &objectIndex) {
+        int applied = 0;
+        for (auto& filename : listJsonFiles(zoneDirectory)) {
+            rapidjson::Document zoneDoc;
+            if (!readDocument(filename, zoneDoc) || !zoneDoc.HasMember("areas")) {
+                std::cerr << "Skipping zone file " << filename << std::endl;
+                continue;
+            }
+
+            for (auto& member : zoneDoc.GetObject()) {
+                if (!member.value.IsArray() || (std::string(member.name.GetString()) == "areas"))
+                    continue;
+                for (auto& object : member.value.GetArray()) {
+                    removeObject(dom, objectIndex, object["interactive_noun_data"]["id"].GetInt());
+                }
+            }
+            raiseNextID(dom, zoneDoc["nextID"].GetInt());
+            applied++;
+        }
+
+        return applied;
+    }
+
+    /*!
+      \brief Applies the records in a journal file to a loaded game data document.
+
+      Upserts replace the object with the same ID or append it to its class array,
+      and removals drop the object.  Replay stops at the first record that cannot
+      be parsed.
+
+      \param[in]     journalFilename   journal file to replay
+      \param[in,out] dom               game data document to update
+      \param[in,out] objectIndex       index of the objects in dom
+
+      \post Returns the number of records applied.
+    */
+    int replayJournal(std::string journalFilename, rapidjson::Document &dom, ObjectIndex &objectIndex) {
+        std::vector<std::string> records;
+        if (!Journal::readRecords(journalFilename, records))
+            return 0;
+
+        int applied = 0;
+        for (auto& record : records) {
+            rapidjson::Document recordDoc;
+            recordDoc.Parse(record.c_str());
+            if (recordDoc.HasParseError() || !recordDoc.IsObject() || !recordDoc.HasMember("op"))
+                break;
+
+            std::string op = recordDoc["op"].GetString();
+            raiseNextID(dom, recordDoc["next_id"].GetInt());
+            if (op == "put")
+                putObject(dom, objectIndex, recordDoc["object"]);
+            else if (op == "remove")
+                removeObject(dom, objectIndex, recordDoc["id"].GetInt());
+            applied++;
+        }
+
+        return applied;
+    }
+}
+
+/******************************************************************************
+* Function:    getJournalFilename
+*****************************************************************************/
+std::string DataManager::getJournalFilename(std::string filename) {
+    return filename + ".journal";
+}
+
+
+/******************************************************************************
+* Function:    getPlayerDirectory
+*****************************************************************************/
+std::string DataManager::getPlayerDirectory(std::string filename) {
+    return filename + ".players";
+}
+
+
+/******************************************************************************
+* Function:    getPlayerFilename
+*****************************************************************************/
+std::string DataManager::getPlayerFilename(std::string filename, int playerId) {
+    return getPlayerDirectory(filename) + "/" + std::to_string(playerId) + ".json";
+}
+
+
+/******************************************************************************
+* Function:    savePlayer
+*****************************************************************************/
+bool DataManager::savePlayer(std::string filename, engine::Player *aPlayer) {
+    if (aPlayer == nullptr)
+        return false;
+
+    // Gather the player's items, including the contents of any containers.
+    std::vector<engine::Item*> items;
+    for (auto item : aPlayer->getInventory()) {
+        items.push_back(item.second);
+    }
+    for (size_t i = 0; i < items.size(); i++) {
+        if (items[i]->getObjectType() == engine::ObjectType::CONTAINER) {
+            std::vector<engine::Item*> contents = static_cast<engine::Container*>(items[i])->getAllContents();
+            items.insert(items.end(), contents.begin(), contents.end());
+        }
+    }
+
+    // Serialize everything now, while the player's state is consistent.
+    rapidjson::Document playerDoc;
+    playerDoc.SetObject();
+    rapidjson::Document::AllocatorType &allocator = playerDoc.GetAllocator();
+    playerDoc.AddMember("nextID", engine::InteractiveNoun::getStaticID(), allocator);
+    playerDoc.AddMember("PLAYER", rapidjson::Value(rapidjson::kArrayType), allocator);
+    playerDoc.AddMember("CONTAINER", rapidjson::Value(rapidjson::kArrayType), allocator);
+    playerDoc.AddMember("ITEM", rapidjson::Value(rapidjson::kArrayType), allocator);
+
+    rapidjson::Document objectDoc;
+    objectDoc.Parse(aPlayer->serialize().c_str());
+    playerDoc["PLAYER"].PushBack(rapidjson::Value(objectDoc["object"], allocator), allocator);
+    for (auto item : items) {
+        objectDoc.Parse(item->serialize().c_str());
+        if (item->getObjectType() == engine::ObjectType::CONTAINER)
+            playerDoc["CONTAINER"].PushBack(rapidjson::Value(objectDoc["object"], allocator), allocator);
+        else
+            playerDoc["ITEM"].PushBack(rapidjson::Value(objectDoc["object"], allocator), allocator);
+    }
+
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    playerDoc.Accept(writer);
+    std::string contents = buffer.GetString();
+
+    std::string playerFilename = getPlayerFilename(filename, aPlayer->getID());
+
+    // Queue the file for the writer thread so the caller never waits on the disk.
+    PlayerFiles &playerFiles = getPlayerFiles();
+    std::lock_guard<std::mutex> playerFileLock(playerFiles.lock);
+    PendingPlayerFile &pendingFile = playerFiles.pending[playerFilename];
+    pendingFile.directory = getPlayerDirectory(filename);
+    pendingFile.contents = std::move(contents);
+    pendingFile.generation = ++playerFiles.lastGeneration;
+    if (!pendingFile.queued) {
+        pendingFile.queued = true;
+        playerFiles.queue.push_back(playerFilename);
+        playerFiles.queueCond.notify_one();
+    }
+
+    return true;
+}
+
+
+/******************************************************************************
+* Function:    loadPlayer
+*****************************************************************************/
+engine::Player* DataManager::loadPlayer(std::string filename, int playerId, engine::GameObjectManager* gameObjectManagerPtr) {
+    std::string playerFilename = getPlayerFilename(filename, playerId);
+    std::string playerData = "";
+    bool isPending = false;
+    {
+        // a save queued by savePlayer is newer than the file on disk
+        PlayerFiles &playerFiles = getPlayerFiles();
+        std::lock_guard<std::mutex> playerFileLock(playerFiles.lock);
+        auto pendingFile = playerFiles.pending.find(playerFilename);
+        if (pendingFile != playerFiles.pending.end()) {
+            playerData = pendingFile->second.contents;
+            isPending = true;
+        }
+    }
+    if (!isPending) {
+        std::ifstream inFile(playerFilename);
+        if (!inFile.is_open())
+            return nullptr;     // error opening file
+        playerData.assign(std::istreambuf_iterator<char>(inFile), std::istreambuf_iterator<char>());
+        inFile.close();
+    }
+
+    rapidjson::Document playerDoc;
+    playerDoc.Parse(playerData.c_str());
+    auto exists = [&](int id) { return gameObjectManagerPtr->getPointer(id) != nullptr; };
+    if (playerDoc.HasParseError() || !playerDoc.IsObject() || !playerDoc.HasMember("PLAYER") ||
+        (playerDoc["PLAYER"].Size() != 1) || exists(playerId) || !fileResolves(playerDoc, exists))
+        return nullptr;
+
+    // Deserialize the player followed by everything it carries.
+    rapidjson::Value &jsonPlayer = playerDoc["PLAYER"][0];
+    engine::Player *rebuiltPlayer = engine::Player::deserialize(toJsonString(jsonPlayer), gameObjectManagerPtr);
+    gameObjectManagerPtr->addObject(rebuiltPlayer,-1);
+    loadItems(playerDoc["CONTAINER"], playerDoc["ITEM"], gameObjectManagerPtr);
+
+    // Restore the player's quest data for quests that still exist.
+    for (auto& aQuest : jsonPlayer["quest_list"].GetArray()) {  
+        engine::InteractiveNoun *quest = gameObjectManagerPtr->getPointer(aQuest["quest_id"].GetInt());
+        if ((quest != nullptr) && (quest->getObjectType() == engine::ObjectType::QUEST)) {
+            rebuiltPlayer->addOrUpdateQuest(static_cast<engine::Quest*>(quest),
+                                            aQuest["step"].GetInt(),
+                                            aQuest["complete"].GetBool());
+        }
+    }
+
+    if (playerDoc["nextID"].GetInt() > engine::InteractiveNoun::getStaticID())
+        engine::InteractiveNoun::setStaticID(playerDoc["nextID"].GetInt());
+
+    return rebuiltPlayer;
+}
+
+
+/******************************************************************************
+* Function:    waitForPlayerSaves
+*****************************************************************************/
+void DataManager::waitForPlayerSaves() {
+    PlayerFiles &playerFiles = getPlayerFiles();
+    std::unique_lock<std::mutex> playerFileLock(playerFiles.lock);
+    playerFiles.doneCond.wait(playerFileLock, [&]{ return playerFiles.pending.empty(); });
+}
+
+
+/******************************************************************************
+* Function:    getZoneDirectory
+*****************************************************************************/
+std::string DataManager::getZoneDirectory(std::string filename) {
+    return filename + ".zones";
+}
+
+
+/******************************************************************************
+* Function:    getZoneFilename
+*****************************************************************************/
+std::string DataManager::getZoneFilename(std::string filename, int zoneId) {
+    return getZoneDirectory(filename) + "/" + std::to_string(zoneId) + ".json";
+}
+
+
+/******************************************************************************
+* Function:    saveZone
+*****************************************************************************/
+bool DataManager::saveZone(std::string filename, int zoneId, const std::vector<engine::Area*> &areas,
+                           const std::vector<engine::InteractiveNoun*> &contents) {
+    rapidjson::Document zoneDoc;
+    zoneDoc.SetObject();
+    rapidjson::Document::AllocatorType &allocator = zoneDoc.GetAllocator();
+    zoneDoc.AddMember("nextID", engine::InteractiveNoun::getStaticID(), allocator);
+    zoneDoc.AddMember("zone_id", zoneId, allocator);
+    zoneDoc.AddMember("areas", rapidjson::Value(rapidjson::kArrayType), allocator);
+    zoneDoc.AddMember("CONTAINER", rapidjson::Value(rapidjson::kArrayType), allocator);
+    zoneDoc.AddMember("CREATURE", rapidjson::Value(rapidjson::kArrayType), allocator);
+    zoneDoc.AddMember("EXIT", rapidjson::Value(rapidjson::kArrayType), allocator);
+    zoneDoc.AddMember("FEATURE", rapidjson::Value(rapidjson::kArrayType), allocator);
+    zoneDoc.AddMember("ITEM", rapidjson::Value(rapidjson::kArrayType), allocator);
+
+    for (auto area : areas) {
+        zoneDoc["areas"].PushBack(area->getID(), allocator);
+    }
+
+    rapidjson::Document objectDoc;
+    for (auto object : contents) {
+        objectDoc.Parse(object->serialize().c_str());
+        std::string className = objectDoc["object"]["class"].GetString();
+        if (!zoneDoc.HasMember(className.c_str()))
+            return false;       // not something a zone holds
+        zoneDoc[className.c_str()].PushBack(rapidjson::Value(objectDoc["object"], allocator), allocator);
+    }
+
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    zoneDoc.Accept(writer);
+
+    // The zone's objects are dropped from memory once this returns, so the
+    // file is written before returning rather than in the background.
+    mkdir(getZoneDirectory(filename).c_str(), 0755);
+    return writeFile(getZoneFilename(filename, zoneId), buffer.GetString());
+}
+
+
+/******************************************************************************
+* Function:    loadZone
+*****************************************************************************/
+bool DataManager::loadZone(std::string filename, int zoneId, engine::GameObjectManager* gameObjectManagerPtr,
+                           std::vector<engine::InteractiveNoun*> &loaded) {
+    rapidjson::Document zoneDoc;
+    if (!readDocument(getZoneFilename(filename, zoneId), zoneDoc) || !zoneDoc.HasMember("areas"))
+        return false;
+
+    // None of the zone's objects should be resident, and everything they refer
+    // to outside the zone should be.
+    auto exists = [&](int id) { return gameObjectManagerPtr->getPointer(id) != nullptr; };
+    for (const char *className : {"CONTAINER", "CREATURE", "EXIT", "FEATURE", "ITEM"}) {
+        for (auto& object : zoneDoc[className].GetArray()) {
+            if (exists(object["interactive_noun_data"]["id"].GetInt()))
+                return false;
+        }
+    }
+    if (!fileResolves(zoneDoc, exists))
+        return false;
+
+    for (auto& jsonObject : zoneDoc["EXIT"].GetArray()) {
+        engine::Exit *rebuiltExit = engine::Exit::deserialize(toJsonString(jsonObject), gameObjectManagerPtr);
+        rebuiltExit->getLocation()->addExit(rebuiltExit);
+        gameObjectManagerPtr->addObject(rebuiltExit,-1);
+        loaded.push_back(rebuiltExit);
+    }
+    for (auto& jsonObject : zoneDoc["FEATURE"].GetArray()) {
+        engine::Feature *rebuiltFeature = engine::Feature::deserialize(toJsonString(jsonObject), gameObjectManagerPtr);
+        rebuiltFeature->getLocation()->addFeature(rebuiltFeature);
+        gameObjectManagerPtr->addObject(rebuiltFeature,-1);
+        loaded.push_back(rebuiltFeature);
+    }
+    for (auto& jsonObject : zoneDoc["CREATURE"].GetArray()) {
+        engine::Creature *rebuiltCreature = engine::Creature::deserialize(toJsonString(jsonObject), gameObjectManagerPtr);
+        rebuiltCreature->getLocation()->addCharacter(rebuiltCreature);
+        gameObjectManagerPtr->addObject(rebuiltCreature,-1);
+        loaded.push_back(rebuiltCreature);
+    }
+    loadItems(zoneDoc["CONTAINER"], zoneDoc["ITEM"], gameObjectManagerPtr, &loaded);
+
+    if (zoneDoc["nextID"].GetInt() > engine::InteractiveNoun::getStaticID())
+        engine::InteractiveNoun::setStaticID(zoneDoc["nextID"].GetInt());
+
+    return true;
+}
+
+
+/******************************************************************************
+* Function:    deleteZone
+*****************************************************************************/
+bool DataManager::deleteZone(std::string filename, int zoneId) {
+    return std::remove(getZoneFilename(filename, zoneId).c_str()) == 0;
+}
+
+
+/******************************************************************************
+* Function:    getSavedZones
+*****************************************************************************/
+std::map<int, std::vector<int>> DataManager::getSavedZones(std::string filename) {
+    std::map<int, std::vector<int>> zones;
+
+    for (auto& zoneFilename : listJsonFiles(getZoneDirectory(filename))) {
+        rapidjson::Document zoneDoc;
+        if (!readDocument(zoneFilename, zoneDoc) || !zoneDoc.HasMember("zone_id") || !zoneDoc.HasMember("areas"))
+            continue;
+
+        std::vector<int> &areaIds = zones[zoneDoc["zone_id"].GetInt()];
+        for (auto& areaId : zoneDoc["areas"].GetArray()) {
+            areaIds.push_back(areaId.GetInt());
+        }
+    }
+
+    return zones;
+}
+
 
 /******************************************************************************
 * Function:    saveGame               
 *****************************************************************************/
 bool DataManager::saveGame(std::string filename, legacymud::engine::GameObjectManager* gameObjectManagerPtr, int startAreaId) {
 
-    // Get all the game objects
-    std::map<int, engine::InteractiveNoun*> gameObjectMap;
-    gameObjectMap = gameObjectManagerPtr->getAllObjects();
+    // Get all the game objects (a shared read-only view, so the map is not copied)
+    std::shared_ptr<const std::map<int, engine::InteractiveNoun*>> gameObjectView = gameObjectManagerPtr->getAllObjectsView();
+    const std::map<int, engine::InteractiveNoun*> &gameObjectMap = *gameObjectView;
     
     // Create the document object model structure.
     rapidjson::StringBuffer buffer;
@@ -183,15 +923,24 @@ bool DataManager::saveGame(std::string filename, legacymud::engine::GameObjectMa
     rapidjson::PrettyWriter<rapidjson::StringBuffer> outWriter(buffer);  
     allDataDoc.Accept(outWriter);
     
-    // Open the file and save the data to disk. 
-    std::ofstream outFile(filename); 
-    if (outFile.is_open() ) {      
-        outFile << buffer.GetString();
-        outFile.close();    // close file
-        return true;
+    // Save the data to disk.
+    if (!writeFile(filename, buffer.GetString()))
+        return false;
+
+    // The save now covers every resident player, so their own files are out of
+    // date.  Dropping the pending file also cancels any write still in flight.
+    PlayerFiles &playerFiles = getPlayerFiles();
+    std::lock_guard<std::mutex> playerFileLock(playerFiles.lock);
+    for (auto object = gameObjectMap.begin(); object != gameObjectMap.end(); object++ ) {
+        if (object->second->getObjectType() == engine::ObjectType::PLAYER) {
+            std::string playerFilename = getPlayerFilename(filename, object->first);
+            if (playerFiles.pending.erase(playerFilename) > 0)
+                playerFiles.doneCond.notify_all();
+            std::remove(playerFilename.c_str());
+        }
     }
-    else 
-        return false;       // error opening file
+
+    return true;
       
 }
 
@@ -218,6 +967,16 @@ bool DataManager::loadGame(std::string filename, legacymud::engine::GameObjectMa
     // parse the data to recover each objects json string
     rapidjson::Document dom;
     dom.Parse(gameData.c_str()); 
+    if (dom.HasParseError() || !dom.IsObject())
+        return false;
+
+    // Bring the data up to date with the players saved on their own and any
+    // changes journaled since it was saved.
+    ObjectIndex objectIndex = indexObjects(dom);
+    mergePlayerFiles(getPlayerDirectory(filename), dom, objectIndex);
+    replayJournal(getJournalFilename(filename), dom, objectIndex);
+    dropZoneObjects(getZoneDirectory(filename), dom, objectIndex);
+    dropRemovedObjects(dom);
        
     rapidjson::StringBuffer inBuffer;
     // Deserialize starting area ID
@@ -415,94 +1174,8 @@ bool DataManager::loadGame(std::string filename, legacymud::engine::GameObjectMa
         gameObjectManagerPtr->addObject(rebuiltNonCombatant,-1);      
     }         
 
-    // Deserialize all CONTAINER objects.
-    bool isComplete = false;
-    int countOfCompleteObjects = 0;
-    int sizeOfArray = dom["CONTAINER"].GetArray().Size();
-    // Loop needed to account for containers in containers
-    while (!isComplete && sizeOfArray>0 ) {       
-        for (auto& jsonObject : dom["CONTAINER"].GetArray()) {          
-
-           // Write object to a buffer and convert to a string for deserialization
-            inBuffer.Clear();
-            rapidjson::Writer<rapidjson::StringBuffer> inWriter(inBuffer);  
-            jsonObject.Accept(inWriter);    
-
-            // Deserialize the data and rebuild it's object.
-            engine::Container *rebuiltContainer = engine::Container::deserialize(inBuffer.GetString(), gameObjectManagerPtr);
-            
-            if (rebuiltContainer != nullptr) {  
-                // Add this container to it's location
-                switch (rebuiltContainer->getPosition()) {
-                case engine::ItemPosition::NONE :
-                    break;
-                case engine::ItemPosition::GROUND :     // adds container to an area            
-                    static_cast<engine::Area*>(rebuiltContainer->getLocation())->addItem(rebuiltContainer); 
-                    break;
-                case engine::ItemPosition::INVENTORY :  // adds container to a character             
-                    static_cast<engine::Character*>(rebuiltContainer->getLocation())->addToInventory(rebuiltContainer);  
-                    break;
-                case engine::ItemPosition::EQUIPPED :   // adds container to a character                                        
-                    static_cast<engine::Character*>(rebuiltContainer->getLocation())->equipItem(rebuiltContainer);       
-                    break;    
-                case engine::ItemPosition::IN :         // adds container to a container
-                    static_cast<engine::Container*>(rebuiltContainer->getLocation())->place(rebuiltContainer, engine::ItemPosition::IN); 
-                    break; 
-                case engine::ItemPosition::ON :         // adds container to a container                        
-                    static_cast<engine::Container*>(rebuiltContainer->getLocation())->place(rebuiltContainer, engine::ItemPosition::ON); 
-                    break; 
-                case engine::ItemPosition::UNDER :      // adds container to a container                  
-                    static_cast<engine::Container*>(rebuiltContainer->getLocation())->place(rebuiltContainer, engine::ItemPosition::UNDER); 
-                    break;             
-                } 
-                
-                // Add the object to the GameObjectManager.
-                gameObjectManagerPtr->addObject(rebuiltContainer,-1);  
-                countOfCompleteObjects ++;  
-                if (countOfCompleteObjects == sizeOfArray)
-                    isComplete = true;
-            }   
-        } 
-    }
-  
-    // Deserialize all ITEM objects
-    for (auto& jsonObject : dom["ITEM"].GetArray()) {          
-
-       // Write object to a buffer and convert to a string for deserialization
-        inBuffer.Clear();
-        rapidjson::Writer<rapidjson::StringBuffer> inWriter(inBuffer);  
-        jsonObject.Accept(inWriter);    
-
-        // Deserialize the data and rebuild it's object.
-        engine::Item *rebuiltItem = engine::Item::deserialize(inBuffer.GetString(), gameObjectManagerPtr);
-
-        // Add this item to it's location
-        switch (rebuiltItem->getPosition()) {
-        case engine::ItemPosition::NONE :
-            break;
-        case engine::ItemPosition::GROUND :     // adds item to an area            
-            static_cast<engine::Area*>(rebuiltItem->getLocation())->addItem(rebuiltItem);         
-            break;
-        case engine::ItemPosition::INVENTORY :  // adds item to a character             
-            static_cast<engine::Character*>(rebuiltItem->getLocation())->addToInventory(rebuiltItem);  
-            break;
-        case engine::ItemPosition::EQUIPPED :   // adds item to a character                                        
-            static_cast<engine::Character*>(rebuiltItem->getLocation())->equipItem(rebuiltItem);       
-            break;    
-        case engine::ItemPosition::IN :         // adds item to a container
-            static_cast<engine::Container*>(rebuiltItem->getLocation())->place(rebuiltItem, engine::ItemPosition::IN); 
-            break; 
-        case engine::ItemPosition::ON :         // adds item to a container                        
-            static_cast<engine::Container*>(rebuiltItem->getLocation())->place(rebuiltItem, engine::ItemPosition::ON); 
-            break; 
-        case engine::ItemPosition::UNDER :      // adds item to a container                  
-            static_cast<engine::Container*>(rebuiltItem->getLocation())->place(rebuiltItem, engine::ItemPosition::UNDER); 
-            break;             
-        } 
-        
-        // Add the object to the GameObjectManager.
-        gameObjectManagerPtr->addObject(rebuiltItem,-1);      
-    }     
+    // Deserialize all CONTAINER and ITEM objects
+    loadItems(dom["CONTAINER"], dom["ITEM"], gameObjectManagerPtr);
     
     // Deserialize all QUEST_STEP objects
     for (auto& jsonObject : dom["QUEST_STEP"].GetArray()) {          
@@ -555,6 +1228,7 @@ bool DataManager::loadGame(std::string filename, legacymud::engine::GameObjectMa
             thisNonCombatant->setQuest(nullptr);
         else
             thisNonCombatant->setQuest(static_cast<engine::Quest*>(gameObjectManagerPtr->getPointer(jsonObject["quest_id"].GetInt())));         
+        gameObjectManagerPtr->updateIndexes(thisNonCombatant);
     }
     
     // after all objects are created, reset the staticId
@@ -2,7 +2,7 @@
   \file     DataManager.hpp
   \author   Keith Adkins
   \created  2/20/2017
-  \modified 3/8/2017
+  \modified 10/19/2026
   \course   CS467, Winter 2017
  
   \details  Declaration file for the DataManager class.
@@ -13,11 +13,16 @@
 #define LEGACYMUD_DATA_MANAGER_HPP
 
 #include <string>
+#include <vector>
+#include <map>
 
 
 namespace legacymud {
     namespace engine{
         class GameObjectManager;    // forward declaration
+        class Player;               // forward declaration
+        class Area;                 // forward declaration
+        class InteractiveNoun;      // forward declaration
     }
     namespace gamedata {
 
@@ -59,7 +64,9 @@ namespace legacymud {
           
           The function loads the game data from disk and populates all the game data needed by the engine.
           It is meant to be executed only during game launch and expects to be passed an instantiated GameObjectManager
-          that does not contain any objects.
+          that does not contain any objects.  Players saved to their own files by savePlayer and any changes recorded
+          in the journal file for this game data file are applied on top of the saved data.  Objects held in zone
+          files by saveZone are left out.
           
           \param[in]  filename              file containing data to be loaded
           \param[in]  gameObjectManagerPtr  pointer to the game object manager
@@ -70,6 +77,150 @@ namespace legacymud {
         */        
         bool loadGame(std::string filename, legacymud::engine::GameObjectManager* gameObjectManagerPtr, int &startAreaId);                 
 
+        /*!
+          \brief Gets the name of the journal file that belongs to a game data file.
+          
+          loadGame replays the changes recorded in this file on top of the saved data.
+          
+          \param[in]  filename              game data file
+          
+          \post Returns the journal filename.
+        */        
+        static std::string getJournalFilename(std::string filename);
+
+        /*!
+          \brief Saves a single player to its own file.
+          
+          The player and every item it carries are serialized right away and queued for a single writer
+          thread, so the cost does not depend on the size of the world.  If the player is saved again
+          before the file is written, only the newest version is written.  Each file is flushed to disk
+          before it replaces the old one.  loadGame merges these files, and saveGame deletes the files of
+          the players it saved.
+          
+          \param[in]  filename              game data file the player belongs to
+          \param[in]  aPlayer               player to save
+          \pre The location pointers of the player and its items should not be null.
+          
+          \post Returns true if the player was queued for saving.  Otherwise, it returns false.
+        */        
+        bool savePlayer(std::string filename, legacymud::engine::Player *aPlayer);
+
+        /*!
+          \brief Loads a single player from its own file.
+          
+          The player and every item it carries are added to the GameObjectManager, and the player's quest
+          data is restored.  The player is added as an inactive player.  A save that is still queued is
+          loaded instead of the file on disk.
+          
+          \param[in]  filename              game data file the player belongs to
+          \param[in]  playerId              ID of the player to load
+          \param[in]  gameObjectManagerPtr  pointer to the game object manager
+          \pre gameObjectManagerPtr         Should not be null.
+          
+          \post Returns a pointer to the loaded player.  Returns nullptr if the player has no file, is
+                already loaded, or refers to objects that no longer exist.
+        */        
+        legacymud::engine::Player* loadPlayer(std::string filename, int playerId, legacymud::engine::GameObjectManager* gameObjectManagerPtr);
+
+        /*!
+          \brief Blocks until every player file queued by savePlayer has been written.
+        */        
+        static void waitForPlayerSaves();
+
+        /*!
+          \brief Gets the directory that holds the player files of a game data file.
+          
+          \param[in]  filename              game data file
+          
+          \post Returns the directory name.
+        */        
+        static std::string getPlayerDirectory(std::string filename);
+
+        /*!
+          \brief Gets the name of a player's own file.
+          
+          \param[in]  filename              game data file the player belongs to
+          \param[in]  playerId              ID of the player
+          
+          \post Returns the player filename.
+        */        
+        static std::string getPlayerFilename(std::string filename, int playerId);
+
+        /*!
+          \brief Saves the contents of a zone to the zone's own file.
+          
+          A zone is a group of areas whose exits, features, items and creatures are paged out of memory
+          together.  The areas themselves stay loaded.  The file is written before this returns, so the
+          caller can remove the contents from the game as soon as it succeeds.  loadGame leaves the
+          objects in zone files out of the game until they are paged back in with loadZone.
+          
+          \param[in]  filename              game data file the zone belongs to
+          \param[in]  zoneId                ID of the zone
+          \param[in]  areas                 areas that make up the zone
+          \param[in]  contents              exits, features, containers, items and creatures in the zone
+          
+          \post Returns true if the zone file was written.  Otherwise, it returns false.
+        */        
+        bool saveZone(std::string filename, int zoneId, const std::vector<legacymud::engine::Area*> &areas,
+                      const std::vector<legacymud::engine::InteractiveNoun*> &contents);
+
+        /*!
+          \brief Loads the contents of a zone from the zone's own file.
+          
+          Each object is added to the GameObjectManager and placed in its area, character or container.
+          The zone file is left in place so the caller can delete it with deleteZone once the loaded
+          objects are recorded elsewhere.
+          
+          \param[in]  filename              game data file the zone belongs to
+          \param[in]  zoneId                ID of the zone
+          \param[in]  gameObjectManagerPtr  pointer to the game object manager
+          \param[out] loaded                every object loaded
+          \pre gameObjectManagerPtr         Should not be null.
+          
+          \post Returns true if the zone was loaded.  Returns false if the zone has no file, any of its
+                objects is already loaded, or it refers to objects that no longer exist.
+        */        
+        bool loadZone(std::string filename, int zoneId, legacymud::engine::GameObjectManager* gameObjectManagerPtr,
+                      std::vector<legacymud::engine::InteractiveNoun*> &loaded);
+
+        /*!
+          \brief Deletes a zone's own file.
+          
+          \param[in]  filename              game data file the zone belongs to
+          \param[in]  zoneId                ID of the zone
+          
+          \post Returns true if the file was deleted.  Otherwise, it returns false.
+        */        
+        bool deleteZone(std::string filename, int zoneId);
+
+        /*!
+          \brief Gets the zones of a game data file that are paged out.
+          
+          \param[in]  filename              game data file
+          
+          \post Returns a map of zone IDs to the IDs of the areas in each zone.
+        */        
+        static std::map<int, std::vector<int>> getSavedZones(std::string filename);
+
+        /*!
+          \brief Gets the directory that holds the zone files of a game data file.
+          
+          \param[in]  filename              game data file
+          
+          \post Returns the directory name.
+        */        
+        static std::string getZoneDirectory(std::string filename);
+
+        /*!
+          \brief Gets the name of a zone's own file.
+          
+          \param[in]  filename              game data file the zone belongs to
+          \param[in]  zoneId                ID of the zone
+          
+          \post Returns the zone filename.
+        */        
+        static std::string getZoneFilename(std::string filename, int zoneId);
+
 };
 
 }}
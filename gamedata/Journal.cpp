@@ -0,0 +1,343 @@
+/*!
+  \file     Journal.cpp
+  \author   agent
+  \created  10/19/2026
+  \modified 10/19/2026
+
+  \details  Implementation file for the Journal class.
+*/
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <chrono>
+#include <iterator>
+#include <cerrno>
+#include <cstdio>
+#include <fcntl.h>
+#include <unistd.h>
+#include <InteractiveNoun.hpp>
+#include "Journal.hpp"
+
+namespace legacymud { namespace gamedata {
+
+// Time the commit thread waits after the first queued record so that records
+// from other threads can share the same fsync.
+const int COMMIT_WINDOW_MS = 2;
+
+
+/******************************************************************************
+* Function:    Journal
+*****************************************************************************/
+Journal::Journal()
+: _filename("")
+, _fd(-1)
+, _stop(false)
+, _failed(false)
+, _pending("")
+, _appended(0)
+, _durable(0)
+{ }
+
+
+/******************************************************************************
+* Function:    ~Journal
+*****************************************************************************/
+Journal::~Journal() {
+    close();
+}
+
+
+/******************************************************************************
+* Function:    open
+*****************************************************************************/
+bool Journal::open(std::string filename) {
+    close();
+
+    int fd = ::open(filename.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+    if (fd == -1)
+        return false;       // error opening file
+
+    {
+        std::lock_guard<std::mutex> fileLock(_fileMutex);
+        _fd = fd;
+        _filename = filename;
+    }
+    {
+        std::lock_guard<std::mutex> queueLock(_queueMutex);
+        _stop = false;
+        _failed = false;
+        _pending.clear();
+        _appended = 0;
+        _durable = 0;
+    }
+    _committer = std::thread(&Journal::commitLoop, this);
+
+    return true;
+}
+
+
+/******************************************************************************
+* Function:    close
+*****************************************************************************/
+void Journal::close() {
+    if (_committer.joinable()) {
+        {
+            std::lock_guard<std::mutex> queueLock(_queueMutex);
+            _stop = true;
+        }
+        _pendingCond.notify_one();
+        _committer.join();
+    }
+
+    std::lock_guard<std::mutex> fileLock(_fileMutex);
+    if (_fd != -1) {
+        ::close(_fd);
+        _fd = -1;
+    }
+}
+
+
+/******************************************************************************
+* Function:    isOpen
+*****************************************************************************/
+bool Journal::isOpen() {
+    std::lock_guard<std::mutex> fileLock(_fileMutex);
+    return _fd != -1;
+}
+
+
+/******************************************************************************
+* Function:    getFilename
+*****************************************************************************/
+std::string Journal::getFilename() {
+    std::lock_guard<std::mutex> fileLock(_fileMutex);
+    return _filename;
+}
+
+
+/******************************************************************************
+* Function:    recordObject
+*****************************************************************************/
+bool Journal::recordObject(engine::InteractiveNoun *anObject) {
+    if (anObject == nullptr)
+        return false;
+
+    // The serialized object is already a single-line JSON object of the form
+    // {"object":{...}}, so the record header is spliced in front of it.
+    std::string jsonStr = anObject->serialize();
+    if (jsonStr.empty() || jsonStr[0] != '{')
+        return false;
+
+    std::string record = "{\"op\":\"put\",\"next_id\":";
+    record += std::to_string(engine::InteractiveNoun::getStaticID());
+    record += ",";
+    record += jsonStr.substr(1);
+
+    return append(record);
+}
+
+
+/******************************************************************************
+* Function:    recordRemoval
+*****************************************************************************/
+bool Journal::recordRemoval(engine::InteractiveNoun *anObject) {
+    if (anObject == nullptr)
+        return false;
+
+    std::string record = "{\"op\":\"remove\",\"next_id\":";
+    record += std::to_string(engine::InteractiveNoun::getStaticID());
+    record += ",\"id\":";
+    record += std::to_string(anObject->getID());
+    record += "}";
+
+    return append(record);
+}
+
+
+/******************************************************************************
+* Function:    sync
+*****************************************************************************/
+bool Journal::sync() {
+    std::unique_lock<std::mutex> queueLock(_queueMutex);
+    if (!_committer.joinable())
+        return false;
+
+    unsigned long target = _appended;
+    _durableCond.wait(queueLock, [this, target]{ return _durable >= target; });
+
+    return !_failed;
+}
+
+
+/******************************************************************************
+* Function:    checkpoint
+*****************************************************************************/
+long Journal::checkpoint() {
+    if (!sync())
+        return -1;
+
+    std::lock_guard<std::mutex> fileLock(_fileMutex);
+    if (_fd == -1)
+        return -1;
+
+    return static_cast<long>(::lseek(_fd, 0, SEEK_END));
+}
+
+
+/******************************************************************************
+* Function:    compact
+*****************************************************************************/
+bool Journal::compact(long mark) {
+    if ((mark < 0) || !sync())
+        return false;
+
+    // Holding the file lock keeps the commit thread from writing while the
+    // file is swapped.  Records queued meanwhile go to the new file.
+    std::lock_guard<std::mutex> fileLock(_fileMutex);
+    if (_fd == -1)
+        return false;
+
+    // Copy everything after the mark into a temporary file.
+    std::string tail = "";
+    std::ifstream inFile(_filename, std::ios::binary);
+    if (!inFile.is_open())
+        return false;       // error opening file
+    inFile.seekg(mark);
+    if (inFile.good())
+        tail.assign(std::istreambuf_iterator<char>(inFile), std::istreambuf_iterator<char>());
+    inFile.close();
+
+    std::string tempName = _filename + ".tmp";
+    int tempFd = ::open(tempName.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (tempFd == -1)
+        return false;       // error opening file
+
+    bool success = writeAll(tempFd, tail) && (::fsync(tempFd) == 0);
+    ::close(tempFd);
+
+    // Replace the journal with the compacted copy and reopen it for appending.
+    if (success && (std::rename(tempName.c_str(), _filename.c_str()) == 0)) {
+        int newFd = ::open(_filename.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+        if (newFd != -1) {
+            ::close(_fd);
+            _fd = newFd;
+            return true;
+        }
+    }
+    std::remove(tempName.c_str());
+
+    return false;
+}
+
+
+/******************************************************************************
+* Function:    readRecords
+*****************************************************************************/
+bool Journal::readRecords(std::string filename, std::vector<std::string> &records) {
+    std::ifstream inFile(filename, std::ios::binary);
+    if (!inFile.is_open())
+        return false;       // error opening file
+
+    std::string contents((std::istreambuf_iterator<char>(inFile)), std::istreambuf_iterator<char>());
+    inFile.close();
+
+    // Only newline-terminated records are complete.  Anything after the last
+    // newline is a torn write and is dropped.
+    size_t start = 0;
+    size_t end = contents.find('\n', start);
+    while (end != std::string::npos) {
+        if (end > start)
+            records.push_back(contents.substr(start, end - start));
+        start = end + 1;
+        end = contents.find('\n', start);
+    }
+
+    return true;
+}
+
+
+/******************************************************************************
+* Function:    append
+*****************************************************************************/
+bool Journal::append(std::string record) {
+    {
+        std::lock_guard<std::mutex> queueLock(_queueMutex);
+        if (!_committer.joinable() || _stop)
+            return false;
+        _pending += record;
+        _pending += '\n';
+        _appended++;
+    }
+    _pendingCond.notify_one();
+
+    return true;
+}
+
+
+/******************************************************************************
+* Function:    writeAll
+*****************************************************************************/
+bool Journal::writeAll(int fd, const std::string &data) {
+    size_t written = 0;
+
+    while (written < data.size()) {
+        ssize_t result = ::write(fd, data.data() + written, data.size() - written);
+        if (result == -1) {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        written += static_cast<size_t>(result);
+    }
+
+    return true;
+}
+
+
+/******************************************************************************
+* Function:    commitLoop
+*****************************************************************************/
+void Journal::commitLoop() {
+    std::string batch;
+    unsigned long batchEnd;
+    bool success;
+    std::unique_lock<std::mutex> queueLock(_queueMutex);
+
+    while (true) {
+        _pendingCond.wait(queueLock, [this]{ return _stop || !_pending.empty(); });
+        if (_pending.empty())
+            break;          // stopped with nothing left to commit
+
+        // Give other threads a moment to join this commit.
+        if (!_stop) {
+            queueLock.unlock();
+            std::this_thread::sleep_for(std::chrono::milliseconds(COMMIT_WINDOW_MS));
+            queueLock.lock();
+        }
+        batch.swap(_pending);
+        _pending.clear();
+        batchEnd = _appended;
+        queueLock.unlock();
+
+        // One write and one fsync for the whole batch.
+        {
+            std::lock_guard<std::mutex> fileLock(_fileMutex);
+            success = (_fd != -1) && writeAll(_fd, batch) && (::fsync(_fd) == 0);
+        }
+        batch.clear();
+
+        queueLock.lock();
+        if (!success)
+            _failed = true;
+        _durable = batchEnd;
+        _durableCond.notify_all();
+    }
+
+    // Release anyone still waiting in sync().
+    _durable = _appended;
+    _durableCond.notify_all();
+}
+
+
+}}
@@ -0,0 +1,168 @@
+/*!
+  \file     Journal.hpp
+  \author   agent
+  \created  10/19/2026
+  \modified 10/19/2026
+
+  \details  Declaration file for the Journal class.
+*/
+
+
+#ifndef LEGACYMUD_JOURNAL_HPP
+#define LEGACYMUD_JOURNAL_HPP
+
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+
+namespace legacymud {
+    namespace engine{
+        class InteractiveNoun;      // forward declaration
+    }
+    namespace gamedata {
+
+    /*!
+      \brief Write-ahead mutation journal for legacyMUD.
+
+      The journal records every change to a game object as one line of JSON appended
+      to a journal file that sits next to the game data file.  Each line holds either
+      the object's full serialization (an upsert) or a removal record.  Records are
+      queued by the game threads and written by a background thread that commits
+      everything queued so far with a single write and a single fsync (group commit).
+
+      On startup the DataManager replays the journal on top of the last full save,
+      and the journal is then compacted by taking a new full save and discarding the
+      records that save covers.
+    */
+    class Journal {
+    public:
+
+        /*!
+          \brief Journal class default constructor.
+        */
+        Journal();
+
+        /*!
+          \brief Journal class destructor.  Commits any queued records and closes the file.
+        */
+        ~Journal();
+
+        /*!
+          \brief Opens a journal file for appending and starts the commit thread.
+
+          \param[in]  filename      journal file to append records to
+
+          \post Returns true if the file was opened.  Otherwise, it returns false.
+        */
+        bool open(std::string filename);
+
+        /*!
+          \brief Commits any queued records, stops the commit thread and closes the file.
+        */
+        void close();
+
+        /*!
+          \brief Returns true if the journal file is open.
+        */
+        bool isOpen();
+
+        /*!
+          \brief Returns the name of the open journal file.
+        */
+        std::string getFilename();
+
+        /*!
+          \brief Queues an upsert record holding the current state of an object.
+
+          \param[in]  anObject      object that was created or changed
+
+          \post Returns true if the record was queued.  Otherwise, it returns false.
+        */
+        bool recordObject(engine::InteractiveNoun *anObject);
+
+        /*!
+          \brief Queues a removal record for an object.
+
+          \param[in]  anObject      object that is being deleted
+
+          \post Returns true if the record was queued.  Otherwise, it returns false.
+        */
+        bool recordRemoval(engine::InteractiveNoun *anObject);
+
+        /*!
+          \brief Blocks until every record queued so far is durable on disk.
+
+          \post Returns true if all queued records were written and synced.  Otherwise,
+                it returns false.
+        */
+        bool sync();
+
+        /*!
+          \brief Marks the current end of the journal.
+
+          Call this just before taking a full save.  Every record before the mark is
+          covered by that save and can be discarded by compact().
+
+          \post Returns the byte offset of the mark, or -1 if the journal is not open.
+        */
+        long checkpoint();
+
+        /*!
+          \brief Discards all records before a checkpoint mark.
+
+          Records appended after the mark are kept.  They are idempotent upserts, so
+          replaying them on top of the new save is always safe.
+
+          \param[in]  mark          byte offset returned by checkpoint()
+
+          \post Returns true if the journal was compacted.  Otherwise, it returns false.
+        */
+        bool compact(long mark);
+
+        /*!
+          \brief Reads all complete records from a journal file.
+
+          A trailing record that was only partly written when the server stopped
+          is ignored.
+
+          \param[in]  filename      journal file to read
+          \param[out] records       one JSON string per record, in journal order
+
+          \post Returns true if the file exists and was read.  Otherwise, it returns false.
+        */
+        static bool readRecords(std::string filename, std::vector<std::string> &records);
+
+        /*!
+          \brief Writes all of the data to a file descriptor, retrying short writes.
+
+          \param[in]  fd            file descriptor to write to
+          \param[in]  data          data to write
+
+          \post Returns true if all of the data was written.  Otherwise, it returns false.
+        */
+        static bool writeAll(int fd, const std::string &data);
+
+    private:
+        bool append(std::string record);
+        void commitLoop();
+
+        std::string _filename;
+        int _fd;
+        bool _stop;
+        bool _failed;
+        std::string _pending;           // records queued but not yet written
+        unsigned long _appended;        // sequence number of the last queued record
+        unsigned long _durable;         // sequence number of the last synced record
+        std::mutex _queueMutex;         // guards the queue and the sequence numbers
+        std::mutex _fileMutex;          // guards the file descriptor
+        std::condition_variable _pendingCond;
+        std::condition_variable _durableCond;
+        std::thread _committer;
+};
+
+}}
+
+#endif
@@ -18,6 +18,7 @@
 #include <thread>
 #include <cstdlib>
 #include <ctime>
+#include <chrono>
 
 namespace parser = legacymud::parser;
 namespace engine = legacymud::engine;
@@ -26,6 +27,12 @@ namespace engine = legacymud::engine;
 const int MAX_PLAYERS = 10;
 // Server timeout period in seconds
 const int SERVER_TIMEOUT = 300;
+// Time in seconds a player must be logged out before it is evicted from memory
+const int PLAYER_EVICTION_TIMEOUT = 1800;
+// Time in seconds an area must be empty of players before its zone is paged out
+const int ZONE_EVICTION_TIMEOUT = 600;
+// Time in seconds between checks for idle players and zones to evict
+const int EVICTION_INTERVAL = 60;
 
 int main(int argc, char *argv[]) {
     legacymud::telnet::Server ts;
@@ -72,11 +79,19 @@ int main(int argc, char *argv[]) {
     
     // start logic
     logic.startGame(true, file, &ts, &accountM);
+    logic.setPlayerEvictionTimeout(PLAYER_EVICTION_TIMEOUT);
+    logic.setZoneEvictionTimeout(ZONE_EVICTION_TIMEOUT);
+    auto nextEviction = std::chrono::steady_clock::now() + std::chrono::seconds(EVICTION_INTERVAL);
     
     while (true) {
         logic.processInput(1);
         logic.updateCreatures();
         logic.updatePlayersInCombat();
+        if (std::chrono::steady_clock::now() >= nextEviction) {
+            logic.evictIdlePlayers();
+            logic.evictIdleZones();
+            nextEviction = std::chrono::steady_clock::now() + std::chrono::seconds(EVICTION_INTERVAL);
+        }
     }
 
     return 0;
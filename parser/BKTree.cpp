@@ -0,0 +1,82 @@
+/*!
+  \file     BKTree.cpp
+  \author   agent
+  \created  10/19/2026
+  \modified 10/19/2026
+
+  \details  This file contains the implementation of the BKTree class.
+*/
+
+#include "BKTree.hpp"
+
+#include "EditDistance.hpp"
+
+namespace legacymud { namespace parser {
+
+void BKTree::insert(const std::string &word) {
+    if (_nodes.empty()) {
+        _nodes.push_back(Node());
+        _nodes.back().word = word;
+        return;
+    }
+
+    size_t index = 0;
+    while (true) {
+        size_t distance = EditDistance::getDistance(word, _nodes[index].word);
+        if (distance == 0)
+            return;
+
+        size_t child = 0;
+        for (auto it = _nodes[index].children.begin(); it != _nodes[index].children.end(); ++it) {
+            if (it->first == distance) {
+                child = it->second;
+                break;
+            }
+        }
+
+        if (child == 0) {
+            // No child at this distance yet; add the word here
+            _nodes[index].children.emplace_back(distance, _nodes.size());
+            _nodes.push_back(Node());
+            _nodes.back().word = word;
+            return;
+        }
+        index = child;
+    }
+}
+
+void BKTree::find(const std::string &word, size_t maxDistance, std::vector<WordMatch> &matches) const {
+    if (_nodes.empty())
+        return;
+
+    std::vector<size_t> pending(1, 0);
+    while (!pending.empty()) {
+        const Node &node = _nodes[pending.back()];
+        pending.pop_back();
+
+        size_t distance = EditDistance::getDistance(word, node.word);
+        if (distance <= maxDistance) {
+            WordMatch match = { node.word, distance };
+            matches.push_back(match);
+        }
+
+        // Only children within maxDistance of this distance can match
+        size_t low = distance > maxDistance ? distance - maxDistance : 0;
+        size_t high = distance + maxDistance;
+        for (auto it = node.children.begin(); it != node.children.end(); ++it) {
+            if (it->first >= low && it->first <= high) {
+                pending.push_back(it->second);
+            }
+        }
+    }
+}
+
+size_t BKTree::size() const {
+    return _nodes.size();
+}
+
+void BKTree::clear() {
+    _nodes.clear();
+}
+
+} }
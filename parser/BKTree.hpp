@@ -0,0 +1,84 @@
+/*!
+  \file     BKTree.hpp
+  \author   agent
+  \created  10/19/2026
+  \modified 10/19/2026
+
+  \details  This file contains the declarations for the BKTree class.
+            The BKTree class finds words that are within a given edit
+            distance of a misspelled word.
+*/
+#ifndef LEGACYMUD_PARSER_BKTREE_HPP
+#define LEGACYMUD_PARSER_BKTREE_HPP
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace legacymud { namespace parser {
+
+/*!
+  \brief Stores a word that is similar to a misspelled word.
+*/
+struct WordMatch {
+    std::string word;   //!< Stores the similar word.
+    size_t distance;    //!< Stores the edit distance from the misspelled word.
+};
+
+/*!
+  \brief Represents a Burkhard-Keller tree of words.
+
+  Each child of a node is stored with its edit distance from the node.
+  Because the edit distance satisfies the triangle inequality, a search
+  for words within distance \a d of a word \a w that is at distance \a k
+  from a node only needs to visit the children at distance \a k - \a d
+  through \a k + \a d. Most of the tree is skipped, so the expensive
+  distance calculation only runs on a small part of the words.
+
+  This class does not do any locking. The owning container is responsible
+  for synchronizing access.
+*/
+class BKTree {
+public:
+    /*!
+      \brief Adds a word to the tree.
+
+      \param[in]  word    Specifies the word to add. Words that are already
+                          in the tree are ignored.
+    */
+    void insert(const std::string &word);
+
+    /*!
+      \brief Finds all words within the specified edit distance.
+
+      \param[in]  word        Specifies the word to compare against.
+      \param[in]  maxDistance Specifies the largest edit distance to include.
+      \param[out] matches     Receives the matching words and their distances.
+    */
+    void find(const std::string &word, size_t maxDistance, std::vector<WordMatch> &matches) const;
+
+    /*!
+      \brief Gets the number of words in the tree.
+
+      \return Returns the number of words.
+    */
+    size_t size() const;
+
+    /*!
+      \brief Removes all words from the tree.
+    */
+    void clear();
+
+private:
+    struct Node {
+        std::string word;
+        // Stores the distance and node index of each child
+        std::vector<std::pair<size_t, size_t>> children;
+    };
+
+    // The root is the first node. Nodes are never removed.
+    std::vector<Node> _nodes;
+};
+
+} }
+#endif
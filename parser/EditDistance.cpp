@@ -0,0 +1,91 @@
+/*!
+  \file     EditDistance.cpp
+  \author   agent
+  \created  10/19/2026
+  \modified 10/19/2026
+
+  \details  This file contains the implementation of the EditDistance class.
+*/
+
+#include "EditDistance.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace legacymud { namespace parser {
+
+const size_t EditDistance::MAX_BIT_PARALLEL;
+
+size_t EditDistance::getDistance(const std::string &first, const std::string &second) {
+    // Use the shorter string as the pattern
+    const std::string &pattern = first.size() <= second.size() ? first : second;
+    const std::string &text = first.size() <= second.size() ? second : first;
+
+    if (pattern.empty())
+        return text.size();
+    if (pattern.size() <= MAX_BIT_PARALLEL)
+        return getBitParallelDistance(pattern, text);
+    return getMatrixDistance(pattern, text);
+}
+
+// Myers' algorithm as formulated by Hyyro. Bit i of each vector describes
+// row i of the current column of the distance matrix: Pv and Mv hold the
+// positive and negative vertical differences, and Ph and Mh hold the
+// horizontal differences. The score tracks the value in the last row.
+size_t EditDistance::getBitParallelDistance(const std::string &pattern, const std::string &text) {
+    uint64_t peq[256] = {};
+    for (size_t i = 0; i < pattern.size(); ++i) {
+        peq[static_cast<unsigned char>(pattern[i])] |= uint64_t(1) << i;
+    }
+
+    const uint64_t last = uint64_t(1) << (pattern.size() - 1);
+    uint64_t pv = ~uint64_t(0);
+    uint64_t mv = 0;
+    size_t score = pattern.size();
+
+    for (size_t j = 0; j < text.size(); ++j) {
+        uint64_t eq = peq[static_cast<unsigned char>(text[j])];
+        uint64_t xv = eq | mv;
+        uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+        uint64_t ph = mv | ~(xh | pv);
+        uint64_t mh = pv & xh;
+
+        if (ph & last) {
+            ++score;
+        }
+        else if (mh & last) {
+            --score;
+        }
+
+        // The first row of the matrix increases by one in every column
+        ph = (ph << 1) | 1;
+        mh <<= 1;
+        pv = mh | ~(xv | ph);
+        mv = ph & xv;
+    }
+
+    return score;
+}
+
+size_t EditDistance::getMatrixDistance(const std::string &pattern, const std::string &text) {
+    std::vector<size_t> row(pattern.size() + 1);
+    for (size_t i = 0; i <= pattern.size(); ++i) {
+        row[i] = i;
+    }
+
+    for (size_t j = 1; j <= text.size(); ++j) {
+        size_t diagonal = row[0];
+        row[0] = j;
+        for (size_t i = 1; i <= pattern.size(); ++i) {
+            size_t above = row[i];
+            size_t cost = pattern[i - 1] == text[j - 1] ? 0 : 1;
+            row[i] = std::min(std::min(row[i] + 1, row[i - 1] + 1), diagonal + cost);
+            diagonal = above;
+        }
+    }
+
+    return row[pattern.size()];
+}
+
+} }
@@ -0,0 +1,60 @@
+/*!
+  \file     EditDistance.hpp
+  \author   agent
+  \created  10/19/2026
+  \modified 10/19/2026
+
+  \details  This file contains the declarations for the EditDistance class.
+            The EditDistance class calculates how many single-character
+            edits it takes to change one word into another.
+*/
+#ifndef LEGACYMUD_PARSER_EDITDISTANCE_HPP
+#define LEGACYMUD_PARSER_EDITDISTANCE_HPP
+
+#include <string>
+
+namespace legacymud { namespace parser {
+
+/*!
+  \brief Calculates the Levenshtein distance between two strings.
+
+  The distance is the number of insertions, deletions and substitutions
+  needed to turn one string into the other. If the shorter string has at
+  most 64 characters, this class uses Myers' bit-parallel algorithm, which
+  processes a whole column of the distance matrix in a few word operations.
+  Longer strings fall back to the standard dynamic programming algorithm.
+
+  The comparison is case-sensitive. Callers should normalize the strings.
+
+  This class should not be instantiated. All member functions are static.
+*/
+class EditDistance {
+public:
+    /*!
+      \brief The longest pattern supported by the bit-parallel algorithm.
+    */
+    static const size_t MAX_BIT_PARALLEL = 64;
+
+    /*!
+      \brief Gets the edit distance between two strings.
+
+      \param[in]  first   Specifies the first string.
+      \param[in]  second  Specifies the second string.
+
+      \return Returns the number of edits needed to turn \a first into \a second.
+    */
+    static size_t getDistance(const std::string &first, const std::string &second);
+
+private:
+    // Use a private constructor to prevent instantiation.
+    EditDistance() {}
+
+    // Bit-parallel distance. The pattern must have 1-64 characters.
+    static size_t getBitParallelDistance(const std::string &pattern, const std::string &text);
+
+    // Dynamic programming distance for patterns of any length.
+    static size_t getMatrixDistance(const std::string &pattern, const std::string &text);
+};
+
+} }
+#endif
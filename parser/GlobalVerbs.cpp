@@ -2,404 +2,202 @@
   \file     GlobalVerbs.cpp
   \author   David Rigert
   \created  02/26/2017
-  \modified 02/26/2017
+  \modified 10/19/2026
   \course   CS467, Winter 2017
  
   \details This file contains the actual grammar definitions and aliases for all global verbs.
+           The definitions are stored in constant tables, and each table is
+           added to the WordManager in one step.
 */
 #include "GlobalVerbs.hpp"
 #include <WordManager.hpp>
 
 namespace legacymud {
 
-// Set up the edit mode verbs
-void setEditModeVerbs() {
-    parser::VerbInfo vi;
-    vi.grammar = parser::Grammar(parser::Grammar::NO, false, parser::Grammar::NO);
-    vi.command = engine::CommandEnum::EDIT_MODE;
-    vi.description = "editmode";
-    parser::WordManager::addEditModeVerb("editmode", vi);
-}
-
-void setGlobalVerbs() {
-    parser::VerbInfo vi;
-
+namespace {
+
+// Prepositions for placing an object relative to another object
+constexpr parser::PrepositionDefinition PLACE_PREPOSITIONS[] = {
+    { "on", parser::PrepositionType::ON },
+    { "under", parser::PrepositionType::UNDER },
+    { "in", parser::PrepositionType::IN },
+    { nullptr, parser::PrepositionType::NONE }
+};
+
+// Prepositions for taking an object from another object
+constexpr parser::PrepositionDefinition TAKE_PREPOSITIONS[] = {
+    { "on", parser::PrepositionType::ON },
+    { "under", parser::PrepositionType::UNDER },
+    { "in", parser::PrepositionType::IN },
+    { "from", parser::PrepositionType::FROM },
+    { nullptr, parser::PrepositionType::NONE }
+};
+
+// Prepositions for verbs directed at another object
+constexpr parser::PrepositionDefinition TO_PREPOSITIONS[] = {
+    { "to", parser::PrepositionType::TO },
+    { nullptr, parser::PrepositionType::NONE }
+};
+
+// Prepositions for verbs that use another object
+constexpr parser::PrepositionDefinition WITH_PREPOSITIONS[] = {
+    { "with", parser::PrepositionType::WITH },
+    { "using", parser::PrepositionType::WITH },
+    { nullptr, parser::PrepositionType::NONE }
+};
+
+// Prepositions for using a skill on another object
+constexpr parser::PrepositionDefinition USE_PREPOSITIONS[] = {
+    { "on", parser::PrepositionType::TO },
+    { nullptr, parser::PrepositionType::NONE }
+};
+
+// Prepositions for attributes of an object
+constexpr parser::PrepositionDefinition OF_PREPOSITIONS[] = {
+    { "of", parser::PrepositionType::OF },
+    { nullptr, parser::PrepositionType::NONE }
+};
+
+// Columns: alias, description, command, direct object, preposition, indirect object, prepositions
+
+// Edit mode verbs
+constexpr parser::VerbDefinition EDIT_MODE_VERBS[] = {
+    { "editmode", "editmode", engine::CommandEnum::EDIT_MODE, parser::Grammar::NO, false, parser::Grammar::NO, nullptr },
+};
+
+// Global verbs
+constexpr parser::VerbDefinition GLOBAL_VERBS[] = {
     // HELP command
-    vi.command = engine::CommandEnum::HELP;
-    vi.description = "help";
-    parser::WordManager::addGlobalVerb("help", vi);
-
+    { "help", "help", engine::CommandEnum::HELP, parser::Grammar::NO, false, parser::Grammar::NO, nullptr },
     // LOOK command
-    vi = parser::VerbInfo();
-    vi.command = engine::CommandEnum::LOOK;
-    vi.description = "look";
-    parser::WordManager::addGlobalVerb("look", vi);
-    vi.grammar = parser::Grammar(parser::Grammar::YES, false, parser::Grammar::NO);
-    parser::WordManager::addGlobalVerb("look", vi);
-    vi.description = "look at";
-    parser::WordManager::addGlobalVerb("look at", vi);
-
+    { "look", "look", engine::CommandEnum::LOOK, parser::Grammar::NO, false, parser::Grammar::NO, nullptr },
+    { "look", "look", engine::CommandEnum::LOOK, parser::Grammar::YES, false, parser::Grammar::NO, nullptr },
+    { "look at", "look at", engine::CommandEnum::LOOK, parser::Grammar::YES, false, parser::Grammar::NO, nullptr },
     // LISTEN command
-    vi = parser::VerbInfo();
-    vi.command = engine::CommandEnum::LISTEN;
-    vi.description = "listen";
-    parser::WordManager::addGlobalVerb("listen", vi);
-
+    { "listen", "listen", engine::CommandEnum::LISTEN, parser::Grammar::NO, false, parser::Grammar::NO, nullptr },
     // TAKE command
-    vi = parser::VerbInfo();
-    vi.command = engine::CommandEnum::TAKE;
-    vi.grammar = parser::Grammar(parser::Grammar::YES, false, parser::Grammar::NO);
-    vi.description = "pick up";
-    parser::WordManager::addGlobalVerb("pick up", vi);
-    vi.description = "take";
-    parser::WordManager::addGlobalVerb("take", vi);
-    
-    vi.grammar = parser::Grammar(parser::Grammar::YES, true, parser::Grammar::YES);
-    vi.grammar.addPreposition("on", parser::PrepositionType::ON);
-    vi.grammar.addPreposition("under", parser::PrepositionType::UNDER);
-    vi.grammar.addPreposition("in", parser::PrepositionType::IN);
-    // "pick up" alias
-    vi.description = "pick up";
-    parser::WordManager::addGlobalVerb("pick up", vi);
+    { "pick up", "pick up", engine::CommandEnum::TAKE, parser::Grammar::YES, false, parser::Grammar::NO, nullptr },
+    { "take", "take", engine::CommandEnum::TAKE, parser::Grammar::YES, false, parser::Grammar::NO, nullptr },
+    { "pick up", "pick up", engine::CommandEnum::TAKE, parser::Grammar::YES, true, parser::Grammar::YES, PLACE_PREPOSITIONS },
     // "take" additionally supports "from"
-    vi.grammar.addPreposition("from", parser::PrepositionType::FROM);
-    vi.description = "take";
-    parser::WordManager::addGlobalVerb("take", vi);
-
+    { "take", "take", engine::CommandEnum::TAKE, parser::Grammar::YES, true, parser::Grammar::YES, TAKE_PREPOSITIONS },
     // PUT command
-    vi = parser::VerbInfo();
-    vi.command = engine::CommandEnum::PUT;
-    vi.grammar = parser::Grammar(parser::Grammar::YES, true, parser::Grammar::YES);
-    vi.grammar.addPreposition("on", parser::PrepositionType::ON);
-    vi.grammar.addPreposition("under", parser::PrepositionType::UNDER);
-    vi.grammar.addPreposition("in", parser::PrepositionType::IN);
-    vi.description = "put";
-    parser::WordManager::addGlobalVerb("put", vi);
-
+    { "put", "put", engine::CommandEnum::PUT, parser::Grammar::YES, true, parser::Grammar::YES, PLACE_PREPOSITIONS },
     // DROP command
-    vi = parser::VerbInfo();
-    vi.command = engine::CommandEnum::DROP;
-    vi.grammar = parser::Grammar(parser::Grammar::YES, false, parser::Grammar::NO);
-    vi.description = "drop";
-    parser::WordManager::addGlobalVerb("drop", vi);
-
+    { "drop", "drop", engine::CommandEnum::DROP, parser::Grammar::YES, false, parser::Grammar::NO, nullptr },
     // INVENTORY command
-    vi = parser::VerbInfo();
-    vi.command = engine::CommandEnum::INVENTORY;
-    vi.description = "inventory";
-    parser::WordManager::addGlobalVerb("inventory", vi);
-    vi.description = "inv";
-    parser::WordManager::addGlobalVerb("inv", vi);
-
+    { "inventory", "inventory", engine::CommandEnum::INVENTORY, parser::Grammar::NO, false, parser::Grammar::NO, nullptr },
+    { "inv", "inv", engine::CommandEnum::INVENTORY, parser::Grammar::NO, false, parser::Grammar::NO, nullptr },
     // MORE command
-    vi = parser::VerbInfo();
-    vi.command = engine::CommandEnum::MORE;
-    vi.grammar = parser::Grammar(parser::Grammar::YES, false, parser::Grammar::NO);
-    vi.description = "more";
-    parser::WordManager::addGlobalVerb("more", vi);
-
+    { "more", "more", engine::CommandEnum::MORE, parser::Grammar::YES, false, parser::Grammar::NO, nullptr },
     // EQUIPMENT command
-    vi = parser::VerbInfo();
-    vi.command = engine::CommandEnum::EQUIPMENT;
-    vi.description = "eq";
-    parser::WordManager::addGlobalVerb("eq", vi);
-    vi.description = "equipment";
-    parser::WordManager::addGlobalVerb("equipment", vi);
-
+    { "eq", "eq", engine::CommandEnum::EQUIPMENT, parser::Grammar::NO, false, parser::Grammar::NO, nullptr },
+    { "equipment", "equipment", engine::CommandEnum::EQUIPMENT, parser::Grammar::NO, false, parser::Grammar::NO, nullptr },
     // EQUIP command
-    vi = parser::VerbInfo();
-    vi.command = engine::CommandEnum::EQUIP;
-    vi.grammar = parser::Grammar(parser::Grammar::YES, false, parser::Grammar::NO);
-    vi.description = "wear";
-    parser::WordManager::addGlobalVerb("wear", vi);
-    vi.description = "put on";
-    parser::WordManager::addGlobalVerb("put on", vi);
-    vi.description = "equip";
-    parser::WordManager::addGlobalVerb("equip", vi);
-
+    { "wear", "wear", engine::CommandEnum::EQUIP, parser::Grammar::YES, false, parser::Grammar::NO, nullptr },
+    { "put on", "put on", engine::CommandEnum::EQUIP, parser::Grammar::YES, false, parser::Grammar::NO, nullptr },
+    { "equip", "equip", engine::CommandEnum::EQUIP, parser::Grammar::YES, false, parser::Grammar::NO, nullptr },
     // UNEQUIP command
-    vi = parser::VerbInfo();
-    vi.command = engine::CommandEnum::UNEQUIP;
-    vi.grammar = parser::Grammar(parser::Grammar::YES, false, parser::Grammar::NO);
-    vi.description = "remove";
-    parser::WordManager::addGlobalVerb("remove", vi);
-    vi.description = "take off";
-    parser::WordManager::addGlobalVerb("take off", vi);
-    vi.description = "unequip";
-    parser::WordManager::addGlobalVerb("unequip", vi);
-
+    { "remove", "remove", engine::CommandEnum::UNEQUIP, parser::Grammar::YES, false, parser::Grammar::NO, nullptr },
+    { "take off", "take off", engine::CommandEnum::UNEQUIP, parser::Grammar::YES, false, parser::Grammar::NO, nullptr },
+    { "unequip", "unequip", engine::CommandEnum::UNEQUIP, parser::Grammar::YES, false, parser::Grammar::NO, nullptr },
     // TRANSFER command
-    vi = parser::VerbInfo();
-    vi.command = engine::CommandEnum::TRANSFER;
-    vi.grammar = parser::Grammar(parser::Grammar::YES, true, parser::Grammar::YES);
-    vi.grammar.addPreposition("to", parser::PrepositionType::TO);
-    vi.description = "give";
-    parser::WordManager::addGlobalVerb("give", vi);
-
+    { "give", "give", engine::CommandEnum::TRANSFER, parser::Grammar::YES, true, parser::Grammar::YES, TO_PREPOSITIONS },
     // SPEAK command
-    vi = parser::VerbInfo();
-    vi.command = engine::CommandEnum::SPEAK;
-    vi.grammar = parser::Grammar(parser::Grammar::TEXT, false, parser::Grammar::NO);
-    vi.description = "say";
-    parser::WordManager::addGlobalVerb("say", vi);
-
+    { "say", "say", engine::CommandEnum::SPEAK, parser::Grammar::TEXT, false, parser::Grammar::NO, nullptr },
     // SHOUT command
-    vi = parser::VerbInfo();
-    vi.command = engine::CommandEnum::SHOUT;
-    vi.grammar = parser::Grammar(parser::Grammar::TEXT, false, parser::Grammar::NO);
-    vi.description = "shout";
-    parser::WordManager::addGlobalVerb("shout", vi);
-    vi.description = "yell";
-    parser::WordManager::addGlobalVerb("yell", vi);
-
+    { "shout", "shout", engine::CommandEnum::SHOUT, parser::Grammar::TEXT, false, parser::Grammar::NO, nullptr },
+    { "yell", "yell", engine::CommandEnum::SHOUT, parser::Grammar::TEXT, false, parser::Grammar::NO, nullptr },
     // WHISPER command
-    vi = parser::VerbInfo();
-    vi.command = engine::CommandEnum::WHISPER;
-    vi.grammar = parser::Grammar(parser::Grammar::TEXT, true, parser::Grammar::YES);
-    vi.grammar.addPreposition("to", parser::PrepositionType::TO);
-    vi.description = "whisper";
-    parser::WordManager::addGlobalVerb("whisper", vi);
-
+    { "whisper", "whisper", engine::CommandEnum::WHISPER, parser::Grammar::TEXT, true, parser::Grammar::YES, TO_PREPOSITIONS },
     // QUIT command
-    vi = parser::VerbInfo();
-    vi.command = engine::CommandEnum::QUIT;
-    vi.description = "quit";
-    parser::WordManager::addGlobalVerb("quit", vi);
-    vi.description = "exit";
-    parser::WordManager::addGlobalVerb("exit", vi);
-    vi.description = "logout";
-    parser::WordManager::addGlobalVerb("logout", vi);
-
+    { "quit", "quit", engine::CommandEnum::QUIT, parser::Grammar::NO, false, parser::Grammar::NO, nullptr },
+    { "exit", "exit", engine::CommandEnum::QUIT, parser::Grammar::NO, false, parser::Grammar::NO, nullptr },
+    { "logout", "logout", engine::CommandEnum::QUIT, parser::Grammar::NO, false, parser::Grammar::NO, nullptr },
     // GO command
-    vi = parser::VerbInfo();
-    vi.command = engine::CommandEnum::GO;
-    vi.grammar = parser::Grammar(parser::Grammar::YES, false, parser::Grammar::NO);
-    vi.description = "go";
-    parser::WordManager::addGlobalVerb("go", vi);
-    vi.description = "go to";
-    parser::WordManager::addGlobalVerb("go to", vi);
-
+    { "go", "go", engine::CommandEnum::GO, parser::Grammar::YES, false, parser::Grammar::NO, nullptr },
+    { "go to", "go to", engine::CommandEnum::GO, parser::Grammar::YES, false, parser::Grammar::NO, nullptr },
     // STATS command
-    vi = parser::VerbInfo();
-    vi.command = engine::CommandEnum::STATS;
-    vi.description = "stats";
-    parser::WordManager::addGlobalVerb("stats", vi);
-
+    { "stats", "stats", engine::CommandEnum::STATS, parser::Grammar::NO, false, parser::Grammar::NO, nullptr },
     // QUESTS command
-    vi = parser::VerbInfo();
-    vi.command = engine::CommandEnum::QUESTS;
-    vi.description = "quests";
-    parser::WordManager::addGlobalVerb("quests", vi);
-
+    { "quests", "quests", engine::CommandEnum::QUESTS, parser::Grammar::NO, false, parser::Grammar::NO, nullptr },
     // SKILLS command
-    vi = parser::VerbInfo();
-    vi.command = engine::CommandEnum::SKILLS;
-    vi.description = "skills";
-    parser::WordManager::addGlobalVerb("skills", vi);
-
+    { "skills", "skills", engine::CommandEnum::SKILLS, parser::Grammar::NO, false, parser::Grammar::NO, nullptr },
     // ATTACK command
-    vi = parser::VerbInfo();
-    vi.command = engine::CommandEnum::ATTACK;
-    vi.grammar = parser::Grammar(parser::Grammar::YES, false, parser::Grammar::NO);
-    vi.description = "attack";
-    parser::WordManager::addGlobalVerb("attack", vi);
-
-    vi.grammar = parser::Grammar(parser::Grammar::YES, true, parser::Grammar::YES);
-    vi.grammar.addPreposition("with", parser::PrepositionType::WITH);
-    vi.grammar.addPreposition("using", parser::PrepositionType::WITH);
-    vi.description = "attack with";
-    parser::WordManager::addGlobalVerb("attack", vi);
-
+    { "attack", "attack", engine::CommandEnum::ATTACK, parser::Grammar::YES, false, parser::Grammar::NO, nullptr },
+    { "attack", "attack with", engine::CommandEnum::ATTACK, parser::Grammar::YES, true, parser::Grammar::YES, WITH_PREPOSITIONS },
     // TALK command
-    vi = parser::VerbInfo();
-    vi.command = engine::CommandEnum::TALK;
-    vi.grammar = parser::Grammar(parser::Grammar::NO, true, parser::Grammar::YES);
-    vi.grammar.addPreposition("to", parser::PrepositionType::TO);
-    vi.description = "talk";
-    parser::WordManager::addGlobalVerb("talk", vi);
-
+    { "talk", "talk", engine::CommandEnum::TALK, parser::Grammar::NO, true, parser::Grammar::YES, TO_PREPOSITIONS },
     // SHOP command
-    vi = parser::VerbInfo();
-    vi.command = engine::CommandEnum::SHOP;
-    vi.description = "shop";
-    parser::WordManager::addGlobalVerb("shop", vi);
-
+    { "shop", "shop", engine::CommandEnum::SHOP, parser::Grammar::NO, false, parser::Grammar::NO, nullptr },
     // BUY command
-    vi = parser::VerbInfo();
-    vi.command = engine::CommandEnum::BUY;
-    vi.grammar = parser::Grammar(parser::Grammar::YES, false, parser::Grammar::NO);
-    vi.description = "buy";
-    parser::WordManager::addGlobalVerb("buy", vi);
-
+    { "buy", "buy", engine::CommandEnum::BUY, parser::Grammar::YES, false, parser::Grammar::NO, nullptr },
     // SELL command
-    vi = parser::VerbInfo();
-    vi.command = engine::CommandEnum::SELL;
-    vi.grammar = parser::Grammar(parser::Grammar::YES, false, parser::Grammar::NO);
-    vi.description = "sell";
-    parser::WordManager::addGlobalVerb("sell", vi);
-
+    { "sell", "sell", engine::CommandEnum::SELL, parser::Grammar::YES, false, parser::Grammar::NO, nullptr },
     // SEARCH command
-    vi = parser::VerbInfo();
-    vi.command = engine::CommandEnum::SEARCH;
-    vi.grammar = parser::Grammar(parser::Grammar::YES, false, parser::Grammar::NO);
-    vi.description = "search";
-    parser::WordManager::addGlobalVerb("search", vi);
-    vi.description = "open";
-    parser::WordManager::addGlobalVerb("open", vi);
-    vi.description = "look in";
-    parser::WordManager::addGlobalVerb("look in", vi);
-    vi.description = "look inside";
-    parser::WordManager::addGlobalVerb("look inside", vi);
-
+    { "search", "search", engine::CommandEnum::SEARCH, parser::Grammar::YES, false, parser::Grammar::NO, nullptr },
+    { "open", "open", engine::CommandEnum::SEARCH, parser::Grammar::YES, false, parser::Grammar::NO, nullptr },
+    { "look in", "look in", engine::CommandEnum::SEARCH, parser::Grammar::YES, false, parser::Grammar::NO, nullptr },
+    { "look inside", "look inside", engine::CommandEnum::SEARCH, parser::Grammar::YES, false, parser::Grammar::NO, nullptr },
     // USE_SKILL command
-    vi = parser::VerbInfo();
-    vi.command = engine::CommandEnum::USE_SKILL;
-    vi.grammar = parser::Grammar(parser::Grammar::YES, false, parser::Grammar::NO);
-    vi.description = "use";
-    parser::WordManager::addGlobalVerb("use", vi);
-    
-    vi.grammar = parser::Grammar(parser::Grammar::YES, true, parser::Grammar::YES);
-    vi.grammar.addPreposition("on", parser::PrepositionType::TO);
-    vi.description = "use on";
-    parser::WordManager::addGlobalVerb("use", vi);
-
+    { "use", "use", engine::CommandEnum::USE_SKILL, parser::Grammar::YES, false, parser::Grammar::NO, nullptr },
+    { "use", "use on", engine::CommandEnum::USE_SKILL, parser::Grammar::YES, true, parser::Grammar::YES, USE_PREPOSITIONS },
     // EAT command
-    vi = parser::VerbInfo();
-    vi.command = engine::CommandEnum::EAT;
-    vi.grammar = parser::Grammar(parser::Grammar::YES, false, parser::Grammar::NO);
-    vi.description = "eat";
-    parser::WordManager::addGlobalVerb("eat", vi);
-
+    { "eat", "eat", engine::CommandEnum::EAT, parser::Grammar::YES, false, parser::Grammar::NO, nullptr },
     // DRINK command
-    vi = parser::VerbInfo();
-    vi.command = engine::CommandEnum::DRINK;
-    vi.grammar = parser::Grammar(parser::Grammar::YES, false, parser::Grammar::NO);
-    vi.description = "drink";
-    parser::WordManager::addGlobalVerb("drink", vi);
-
+    { "drink", "drink", engine::CommandEnum::DRINK, parser::Grammar::YES, false, parser::Grammar::NO, nullptr },
     // PUSH command
-    vi = parser::VerbInfo();
-    vi.command = engine::CommandEnum::PUSH;
-    vi.grammar = parser::Grammar(parser::Grammar::YES, false, parser::Grammar::NO);
-    vi.description = "push";
-    parser::WordManager::addGlobalVerb("push", vi);
-
+    { "push", "push", engine::CommandEnum::PUSH, parser::Grammar::YES, false, parser::Grammar::NO, nullptr },
     // PULL command
-    vi = parser::VerbInfo();
-    vi.command = engine::CommandEnum::PULL;
-    vi.grammar = parser::Grammar(parser::Grammar::YES, false, parser::Grammar::NO);
-    vi.description = "pull";
-    parser::WordManager::addGlobalVerb("pull", vi);
-
+    { "pull", "pull", engine::CommandEnum::PULL, parser::Grammar::YES, false, parser::Grammar::NO, nullptr },
     // CLIMB command
-    vi = parser::VerbInfo();
-    vi.command = engine::CommandEnum::CLIMB;
-    vi.grammar = parser::Grammar(parser::Grammar::YES, false, parser::Grammar::NO);
-    vi.description = "climb";
-    parser::WordManager::addGlobalVerb("climb", vi);
-
+    { "climb", "climb", engine::CommandEnum::CLIMB, parser::Grammar::YES, false, parser::Grammar::NO, nullptr },
     // BREAK command
-    vi = parser::VerbInfo();
-    vi.command = engine::CommandEnum::BREAK;
-    vi.grammar = parser::Grammar(parser::Grammar::YES, false, parser::Grammar::NO);
-    vi.description = "break";
-    parser::WordManager::addGlobalVerb("break", vi);
-
+    { "break", "break", engine::CommandEnum::BREAK, parser::Grammar::YES, false, parser::Grammar::NO, nullptr },
     // READ command
-    vi = parser::VerbInfo();
-    vi.command = engine::CommandEnum::READ;
-    vi.grammar = parser::Grammar(parser::Grammar::YES, false, parser::Grammar::NO);
-    vi.description = "read";
-    parser::WordManager::addGlobalVerb("read", vi);
-
+    { "read", "read", engine::CommandEnum::READ, parser::Grammar::YES, false, parser::Grammar::NO, nullptr },
     // TURN command
-    vi = parser::VerbInfo();
-    vi.command = engine::CommandEnum::TURN;
-    vi.grammar = parser::Grammar(parser::Grammar::YES, false, parser::Grammar::NO);
-    vi.description = "turn";
-    parser::WordManager::addGlobalVerb("turn", vi);
-}
-
-void setBuilderVerbs() {
-    parser::VerbInfo vi;
+    { "turn", "turn", engine::CommandEnum::TURN, parser::Grammar::YES, false, parser::Grammar::NO, nullptr },
+};
 
+// World builder verbs
+constexpr parser::VerbDefinition BUILDER_VERBS[] = {
     // WARP command
-    vi = parser::VerbInfo();
-    vi.command = engine::CommandEnum::WARP;
-    vi.grammar = parser::Grammar(parser::Grammar::YES, false, parser::Grammar::NO);
-    vi.description = "warp";
-    parser::WordManager::addBuilderVerb("warp", vi);
-    vi.description = "warp to";
-    parser::WordManager::addBuilderVerb("warp to", vi);
-
+    { "warp", "warp", engine::CommandEnum::WARP, parser::Grammar::YES, false, parser::Grammar::NO, nullptr },
+    { "warp to", "warp to", engine::CommandEnum::WARP, parser::Grammar::YES, false, parser::Grammar::NO, nullptr },
     // COPY command
-    vi = parser::VerbInfo();
-    vi.command = engine::CommandEnum::COPY;
-    vi.grammar = parser::Grammar(parser::Grammar::YES, false, parser::Grammar::NO);
-    vi.description = "copy";
-    parser::WordManager::addBuilderVerb("copy", vi);
-
+    { "copy", "copy", engine::CommandEnum::COPY, parser::Grammar::YES, false, parser::Grammar::NO, nullptr },
     // CREATE command
-    vi = parser::VerbInfo();
-    vi.command = engine::CommandEnum::CREATE;
-    vi.grammar = parser::Grammar(parser::Grammar::TEXT, false, parser::Grammar::NO);
-    vi.description = "create";
-    parser::WordManager::addBuilderVerb("create", vi);
-    vi.description = "new";
-    parser::WordManager::addBuilderVerb("new", vi);
-    vi.description = "add";
-    parser::WordManager::addBuilderVerb("add", vi);
-
+    { "create", "create", engine::CommandEnum::CREATE, parser::Grammar::TEXT, false, parser::Grammar::NO, nullptr },
+    { "new", "new", engine::CommandEnum::CREATE, parser::Grammar::TEXT, false, parser::Grammar::NO, nullptr },
+    { "add", "add", engine::CommandEnum::CREATE, parser::Grammar::TEXT, false, parser::Grammar::NO, nullptr },
     // EDIT_ATTRIBUTE command
-    vi = parser::VerbInfo();
-    vi.command = engine::CommandEnum::EDIT_ATTRIBUTE;
-    vi.grammar = parser::Grammar(parser::Grammar::YES, false, parser::Grammar::TEXT);
-    vi.description = "edit (object) (attrib)";
-    parser::WordManager::addBuilderVerb("edit", vi);
-
-    //vi.grammar = parser::Grammar(parser::Grammar::TEXT, false, parser::Grammar::NO);
-    //vi.description = "edit (attrib)";
-    //parser::WordManager::addBuilderVerb("edit", vi);
-    
-    vi.grammar = parser::Grammar(parser::Grammar::TEXT, true, parser::Grammar::YES);
-    vi.grammar.addPreposition("of", parser::PrepositionType::OF);
-    vi.description = "edit (attrib) of (object)";
-    parser::WordManager::addBuilderVerb("edit", vi);
-
-
+    { "edit", "edit (object) (attrib)", engine::CommandEnum::EDIT_ATTRIBUTE, parser::Grammar::YES, false, parser::Grammar::TEXT, nullptr },
+    { "edit", "edit (attrib) of (object)", engine::CommandEnum::EDIT_ATTRIBUTE, parser::Grammar::TEXT, true, parser::Grammar::YES, OF_PREPOSITIONS },
     // EDIT_WIZARD command
-    vi = parser::VerbInfo();
-    vi.command = engine::CommandEnum::EDIT_WIZARD;
-    vi.grammar = parser::Grammar(parser::Grammar::YES, false, parser::Grammar::NO);
-    vi.description = "edit (object)";
-    parser::WordManager::addBuilderVerb("edit", vi);
-
+    { "edit", "edit (object)", engine::CommandEnum::EDIT_WIZARD, parser::Grammar::YES, false, parser::Grammar::NO, nullptr },
     // SAVE command
-    vi = parser::VerbInfo();
-    vi.command = engine::CommandEnum::SAVE;
-    vi.grammar = parser::Grammar(parser::Grammar::NO, false, parser::Grammar::NO);
-    vi.description = "save";
-    parser::WordManager::addBuilderVerb("save", vi);
+    { "save", "save", engine::CommandEnum::SAVE, parser::Grammar::NO, false, parser::Grammar::NO, nullptr },
+    { "save", "save filename", engine::CommandEnum::SAVE, parser::Grammar::TEXT, false, parser::Grammar::NO, nullptr },
+    // LOAD command
+    { "load", "load", engine::CommandEnum::LOAD, parser::Grammar::TEXT, false, parser::Grammar::NO, nullptr },
+    // DELETE command
+    { "delete", "delete", engine::CommandEnum::DELETE, parser::Grammar::YES, false, parser::Grammar::NO, nullptr },
+};
 
-    vi.grammar = parser::Grammar(parser::Grammar::TEXT, false, parser::Grammar::NO);
-    vi.description = "save filename";
-    parser::WordManager::addBuilderVerb("save", vi);
+}
 
-    // LOAD command
-    vi = parser::VerbInfo();
-    vi.grammar = parser::Grammar(parser::Grammar::TEXT, false, parser::Grammar::NO);
-    vi.command = engine::CommandEnum::LOAD;
-    vi.description = "load";
-    parser::WordManager::addBuilderVerb("load", vi);
+// Set up the edit mode verbs
+void setEditModeVerbs() {
+    parser::WordManager::addEditModeVerbs(EDIT_MODE_VERBS, sizeof(EDIT_MODE_VERBS) / sizeof(EDIT_MODE_VERBS[0]));
+}
 
-    // DELETE command
-    vi = parser::VerbInfo();
-    vi.grammar = parser::Grammar(parser::Grammar::YES, false, parser::Grammar::NO);
-    vi.command = engine::CommandEnum::DELETE;
-    vi.description = "delete";
-    parser::WordManager::addBuilderVerb("delete", vi);
-    
+void setGlobalVerbs() {
+    parser::WordManager::addGlobalVerbs(GLOBAL_VERBS, sizeof(GLOBAL_VERBS) / sizeof(GLOBAL_VERBS[0]));
 }
 
+void setBuilderVerbs() {
+    parser::WordManager::addBuilderVerbs(BUILDER_VERBS, sizeof(BUILDER_VERBS) / sizeof(BUILDER_VERBS[0]));
+}
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,72 @@
+/*!
+  \file     LexicalBatch.cpp
+  \author   agent
+  \created  10/19/2026
+  \modified 10/19/2026
+
+  \details  This file contains the implementation of the LexicalBatch class.
+*/
+
+#include "LexicalBatch.hpp"
+
+#include <InteractiveNoun.hpp>
+
+namespace legacymud { namespace parser {
+
+void LexicalBatch::addNoun(const std::string &alias, engine::InteractiveNoun *pObject) {
+    _nouns.emplace_back(alias, pObject, true);
+}
+
+void LexicalBatch::addVerb(const std::string &alias, engine::InteractiveNoun *pObject) {
+    _verbs.emplace_back(alias, pObject, true);
+}
+
+void LexicalBatch::removeNoun(const std::string &alias, engine::InteractiveNoun *pObject) {
+    _nouns.emplace_back(alias, pObject, false);
+}
+
+void LexicalBatch::removeVerb(const std::string &alias, engine::InteractiveNoun *pObject) {
+    _verbs.emplace_back(alias, pObject, false);
+}
+
+void LexicalBatch::addObject(engine::InteractiveNoun *pObject) {
+    if (pObject == nullptr)
+        return;
+
+    std::vector<std::string> nounAliases = pObject->getNounAliases();
+    std::vector<std::string> verbAliases = pObject->getVerbAliases();
+    for (auto &noun : nounAliases) {
+        _nouns.emplace_back(std::move(noun), pObject, true);
+    }
+    for (auto &verb : verbAliases) {
+        _verbs.emplace_back(std::move(verb), pObject, true);
+    }
+}
+
+void LexicalBatch::removeObject(engine::InteractiveNoun *pObject) {
+    if (pObject == nullptr)
+        return;
+
+    std::vector<std::string> nounAliases = pObject->getNounAliases();
+    std::vector<std::string> verbAliases = pObject->getVerbAliases();
+    for (auto &noun : nounAliases) {
+        _nouns.emplace_back(std::move(noun), pObject, false);
+    }
+    for (auto &verb : verbAliases) {
+        _verbs.emplace_back(std::move(verb), pObject, false);
+    }
+}
+
+bool LexicalBatch::empty() const {
+    return _nouns.empty() && _verbs.empty();
+}
+
+const std::vector<WordChange> &LexicalBatch::getNounChanges() const {
+    return _nouns;
+}
+
+const std::vector<WordChange> &LexicalBatch::getVerbChanges() const {
+    return _verbs;
+}
+
+} }
@@ -0,0 +1,133 @@
+/*!
+  \file     LexicalBatch.hpp
+  \author   agent
+  \created  10/19/2026
+  \modified 10/19/2026
+
+  \details  This file contains the declarations for the LexicalBatch class.
+            The LexicalBatch class collects the alias changes caused by
+            moving an object so they can be applied to a LexicalData object
+            in one step.
+*/
+#ifndef LEGACYMUD_PARSER_LEXICALBATCH_HPP
+#define LEGACYMUD_PARSER_LEXICALBATCH_HPP
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace legacymud { namespace engine {
+    class InteractiveNoun;
+}}
+
+namespace legacymud { namespace parser {
+
+/*!
+  \brief Stores a single change to a verb or noun word map.
+*/
+struct WordChange {
+    /*!
+      \brief The alias to add or remove.
+    */
+    std::string alias;
+
+    /*!
+      \brief The object with the alias.
+    */
+    engine::InteractiveNoun *pObject;
+
+    /*!
+      \brief Whether the alias-object pair is added (true) or removed (false).
+    */
+    bool isAdd;
+
+    WordChange(std::string alias, engine::InteractiveNoun *pObject, bool isAdd)
+        : alias(std::move(alias)), pObject(pObject), isAdd(isAdd) { }
+};
+
+/*!
+  \brief Collects noun and verb alias changes to apply to a LexicalData object.
+
+  Moving an object such as a full container changes the aliases of every
+  object inside it. Instead of locking the lexical data and the WordManager
+  tables once per alias, the changes are collected in a LexicalBatch and
+  applied with LexicalData::apply(), which locks each table once.
+
+  Changes are applied in the order they were added.
+*/
+class LexicalBatch {
+public:
+    /*!
+      \brief Adds a noun alias to the batch.
+
+      \param[in]  alias   Specifies the alias to add.
+      \param[in]  pObject Specifies a pointer to the InteractiveNoun with the alias.
+    */
+    void addNoun(const std::string &alias, engine::InteractiveNoun *pObject);
+
+    /*!
+      \brief Adds a verb alias to the batch.
+
+      \param[in]  alias   Specifies the alias to add.
+      \param[in]  pObject Specifies a pointer to the InteractiveNoun with the alias.
+    */
+    void addVerb(const std::string &alias, engine::InteractiveNoun *pObject);
+
+    /*!
+      \brief Removes a noun alias in the batch.
+
+      \param[in]  alias   Specifies the alias to remove.
+      \param[in]  pObject Specifies a pointer to the InteractiveNoun with the alias.
+    */
+    void removeNoun(const std::string &alias, engine::InteractiveNoun *pObject);
+
+    /*!
+      \brief Removes a verb alias in the batch.
+
+      \param[in]  alias   Specifies the alias to remove.
+      \param[in]  pObject Specifies a pointer to the InteractiveNoun with the alias.
+    */
+    void removeVerb(const std::string &alias, engine::InteractiveNoun *pObject);
+
+    /*!
+      \brief Adds all noun and verb aliases of an object to the batch.
+
+      \param[in]  pObject Specifies the object to add. Null pointers are ignored.
+    */
+    void addObject(engine::InteractiveNoun *pObject);
+
+    /*!
+      \brief Removes all noun and verb aliases of an object in the batch.
+
+      \param[in]  pObject Specifies the object to remove. Null pointers are ignored.
+    */
+    void removeObject(engine::InteractiveNoun *pObject);
+
+    /*!
+      \brief Gets whether the batch has no changes.
+
+      \return Returns whether the batch is empty.
+    */
+    bool empty() const;
+
+    /*!
+      \brief Gets the noun alias changes in the batch.
+
+      \return Returns the noun changes in the order they were added.
+    */
+    const std::vector<WordChange> &getNounChanges() const;
+
+    /*!
+      \brief Gets the verb alias changes in the batch.
+
+      \return Returns the verb changes in the order they were added.
+    */
+    const std::vector<WordChange> &getVerbChanges() const;
+
+private:
+    std::vector<WordChange> _nouns;
+    std::vector<WordChange> _verbs;
+};
+
+} }
+#endif
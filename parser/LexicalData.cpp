@@ -2,7 +2,7 @@
   \file     LexicalData.cpp
   \author   David Rigert
   \created  02/11/2017
-  \modified 03/01/2017
+  \modified 10/19/2026
   \course   CS467, Winter 2017
  
   \details  This file contains the implementation of the LexicalData class.
@@ -12,8 +12,23 @@
 
 #include "WordManager.hpp"
 
+namespace {
+
+// Source of version numbers for all LexicalData objects
+std::atomic<unsigned long> versionCounter(0);
+
+// Gets the next unused version number.
+unsigned long nextVersion() {
+    return ++versionCounter;
+}
+
+}
+
 namespace legacymud { namespace parser {
 
+LexicalData::LexicalData() : _version(nextVersion()) {
+}
+
 LexicalData::~LexicalData() {
     clear();
 }
@@ -21,6 +36,7 @@ LexicalData::~LexicalData() {
 void LexicalData::addNoun(std::string alias, engine::InteractiveNoun *pObject) {
     std::lock_guard<std::mutex> guard(_nounLock);
     if (_nouns.addWord(alias, pObject)) {
+        _version = nextVersion();
         WordManager::addNoun(alias, pObject);
     }
 }
@@ -28,6 +44,7 @@ void LexicalData::addNoun(std::string alias, engine::InteractiveNoun *pObject) {
 void LexicalData::addVerb(std::string alias, engine::InteractiveNoun *pObject) {
     std::lock_guard<std::mutex> guard(_verbLock);
     if (_verbs.addWord(alias, pObject)) {
+        _version = nextVersion();
         WordManager::addVerb(alias, pObject);
     }
 }
@@ -42,6 +59,16 @@ bool LexicalData::hasVerb(std::string alias) const {
     return _verbs.hasWord(alias);
 }
 
+std::vector<std::string> LexicalData::getNouns() const {
+    std::lock_guard<std::mutex> guard(_nounLock);
+    return _nouns.getWords();
+}
+
+std::vector<std::string> LexicalData::getVerbs() const {
+    std::lock_guard<std::mutex> guard(_verbLock);
+    return _verbs.getWords();
+}
+
 std::vector<engine::InteractiveNoun *> LexicalData::getObjectsByNoun(std::string alias) const {
     std::lock_guard<std::mutex> guard(_nounLock);
     return _nouns.getObjects(alias);
@@ -52,9 +79,20 @@ std::vector<engine::InteractiveNoun *> LexicalData::getObjectsByVerb(std::string
     return _verbs.getObjects(alias);
 }
 
+size_t LexicalData::findLongestNoun(const std::vector<Token> &tokens, const Range &range, bool &skipIgnoreWords) const {
+    std::lock_guard<std::mutex> guard(_nounLock);
+    return _nouns.findLongest(tokens, range, skipIgnoreWords);
+}
+
+size_t LexicalData::findLongestVerb(const std::vector<Token> &tokens, const Range &range, bool &skipIgnoreWords) const {
+    std::lock_guard<std::mutex> guard(_verbLock);
+    return _verbs.findLongest(tokens, range, skipIgnoreWords);
+}
+
 void LexicalData::removeNoun(std::string alias, engine::InteractiveNoun *pObject) {
     std::lock_guard<std::mutex> guard(_nounLock);
     if (_nouns.removeWord(alias, pObject)) {
+        _version = nextVersion();
         WordManager::removeNoun(alias, pObject);
     }
 }
@@ -62,16 +100,48 @@ void LexicalData::removeNoun(std::string alias, engine::InteractiveNoun *pObject
 void LexicalData::removeVerb(std::string alias, engine::InteractiveNoun *pObject) {
     std::lock_guard<std::mutex> guard(_verbLock);
     if (_verbs.removeWord(alias, pObject)) {
+        _version = nextVersion();
         WordManager::removeVerb(alias, pObject);
     }
 }
 
+void LexicalData::apply(const LexicalBatch &batch) {
+    std::vector<WordChange> changed;
+
+    if (!batch.getNounChanges().empty()) {
+        std::lock_guard<std::mutex> guard(_nounLock);
+        for (auto it = batch.getNounChanges().begin(); it != batch.getNounChanges().end(); ++it) {
+            if (it->isAdd ? _nouns.addWord(it->alias, it->pObject) : _nouns.removeWord(it->alias, it->pObject)) {
+                changed.push_back(*it);
+            }
+        }
+        if (!changed.empty()) {
+            _version = nextVersion();
+            WordManager::applyNounChanges(changed);
+        }
+    }
+
+    changed.clear();
+    if (!batch.getVerbChanges().empty()) {
+        std::lock_guard<std::mutex> guard(_verbLock);
+        for (auto it = batch.getVerbChanges().begin(); it != batch.getVerbChanges().end(); ++it) {
+            if (it->isAdd ? _verbs.addWord(it->alias, it->pObject) : _verbs.removeWord(it->alias, it->pObject)) {
+                changed.push_back(*it);
+            }
+        }
+        if (!changed.empty()) {
+            _version = nextVersion();
+            WordManager::applyVerbChanges(changed);
+        }
+    }
+}
+
 void LexicalData::clear() {
     // Remove all data from WordManager
     _nounLock.lock();
     for (auto it = _nouns.begin(); it != _nouns.end(); ++it) {
         for (auto it2 = it->second.begin(); it2 != it->second.end(); ++it2) {
-            WordManager::removeNoun(it->first, it2->first);
+            WordManager::removeNoun(SymbolTable::getWord(it->first), it2->first);
         }
     }
     _nouns.clear();
@@ -80,11 +150,17 @@ void LexicalData::clear() {
     _verbLock.lock();
     for (auto it = _verbs.begin(); it != _verbs.end(); ++it) {
         for (auto it2 = it->second.begin(); it2 != it->second.end(); ++it2) {
-            WordManager::removeVerb(it->first, it2->first);
+            WordManager::removeVerb(SymbolTable::getWord(it->first), it2->first);
         }
     }
     _verbs.clear();
     _verbLock.unlock();
+
+    _version = nextVersion();
+}
+
+unsigned long LexicalData::getVersion() const {
+    return _version;
 }
 
 // Borrowed from http://stackoverflow.com/questions/12662891/passing-a-member-function-as-an-argument-in-c
@@ -96,4 +172,12 @@ bool LexicalData::forwardHasVerb(const void *context, std::string arg) {
     return static_cast<const LexicalData*>(context)->hasVerb(arg);
 }
 
+size_t LexicalData::forwardFindLongestNoun(const void *context, const std::vector<Token> &tokens, const Range &range, bool &skipIgnoreWords) {
+    return static_cast<const LexicalData*>(context)->findLongestNoun(tokens, range, skipIgnoreWords);
+}
+
+size_t LexicalData::forwardFindLongestVerb(const void *context, const std::vector<Token> &tokens, const Range &range, bool &skipIgnoreWords) {
+    return static_cast<const LexicalData*>(context)->findLongestVerb(tokens, range, skipIgnoreWords);
+}
+
 } }
@@ -2,7 +2,7 @@
   \file     LexicalData.hpp
   \author   David Rigert
   \created  02/11/2017
-  \modified 02/16/2017
+  \modified 10/19/2026
   \course   CS467, Winter 2017
  
   \details  This file contains the declarations for the LexicalData class.
@@ -11,9 +11,11 @@
 #ifndef LEGACYMUD_PARSER_LEXICALDATA_HPP
 #define LEGACYMUD_PARSER_LEXICALDATA_HPP
 
+#include "LexicalBatch.hpp"
 #include "WordMap.hpp"
 #include <InteractiveNoun.hpp>
 
+#include <atomic>
 #include <mutex>
 
 namespace legacymud { namespace parser {
@@ -27,6 +29,14 @@ namespace legacymud { namespace parser {
 */
 class LexicalData {
 public:
+    /*!
+      \brief Default constructor.
+
+      The constructor assigns the object a version number that is unique
+      among all LexicalData objects.
+    */
+    LexicalData();
+
     /*!
       \brief Destructor.
       
@@ -93,6 +103,20 @@ public:
     */
     bool hasNoun(std::string alias) const;
 
+    /*!
+      \brief Gets all noun aliases in the lexical data.
+
+      \return Returns a vector of the lowercase noun aliases.
+    */
+    std::vector<std::string> getNouns() const;
+
+    /*!
+      \brief Gets all verb aliases in the lexical data.
+
+      \return Returns a vector of the lowercase verb aliases.
+    */
+    std::vector<std::string> getVerbs() const;
+
     /*!
       \brief Gets whether the lexical data includes the specified verb alias.
 
@@ -102,6 +126,45 @@ public:
     */
     bool hasVerb(std::string alias) const;
 
+    /*!
+      \brief Finds the longest noun alias at the start of a token range.
+
+      \param[in]  tokens          Specifies the tokenized input text.
+      \param[in]  range           Specifies the range of tokens to check.
+      \param[out] skipIgnoreWords Set to whether the alias only matched after
+                                  omitting ignore words.
+
+      \return Returns the end of the longest matching range, or
+              \a range.start if there is no match.
+    */
+    size_t findLongestNoun(const std::vector<Token> &tokens, const Range &range, bool &skipIgnoreWords) const;
+
+    /*!
+      \brief Finds the longest verb alias at the start of a token range.
+
+      \param[in]  tokens          Specifies the tokenized input text.
+      \param[in]  range           Specifies the range of tokens to check.
+      \param[out] skipIgnoreWords Set to whether the alias only matched after
+                                  omitting ignore words.
+
+      \return Returns the end of the longest matching range, or
+              \a range.start if there is no match.
+    */
+    size_t findLongestVerb(const std::vector<Token> &tokens, const Range &range, bool &skipIgnoreWords) const;
+
+    /*!
+      \brief Gets the version number of the lexical data.
+
+      The version number changes whenever a noun or verb alias is added or
+      removed. Version numbers are drawn from a counter that is shared by all
+      LexicalData objects, so two different objects never have the same
+      version number. Callers can use the version number to determine
+      whether data derived from this object is still current.
+
+      \return Returns the current version number.
+    */
+    unsigned long getVersion() const;
+
     /*!
       \brief Removes a noun alias from the lexical data.
 
@@ -128,6 +191,19 @@ public:
     */
     void removeVerb(std::string alias, engine::InteractiveNoun *pObject);
 
+    /*!
+      \brief Applies a batch of noun and verb alias changes.
+
+      This function applies every change in \a batch to the local lexical
+      data and the global tables of nouns and verbs. The noun and verb data
+      are each locked once for the whole batch, instead of once per alias.
+      Call this function instead of addNoun(), addVerb(), removeNoun() and
+      removeVerb() when moving an object changes more than one alias.
+
+      \param[in]  batch   Specifies the changes to apply.
+    */
+    void apply(const LexicalBatch &batch);
+
     /*!
       \brief Clears all of the lexical data.
 
@@ -162,11 +238,44 @@ public:
     */
     static bool forwardHasVerb(const void *context, std::string arg);
 
+    /*!
+      \brief Forwards the function call to the findLongestNoun member function.
+
+      This function forwards the caller to the findLongestNoun() member function
+      of the LexicalData instance specified in \a context.
+
+      \param[in]  context         Specifies a pointer to the LexicalData instance to use.
+      \param[in]  tokens          Specifies the tokenized input text.
+      \param[in]  range           Specifies the range of tokens to check.
+      \param[out] skipIgnoreWords Set to whether the alias only matched after
+                                  omitting ignore words.
+
+      \return Returns the result of findLongestNoun().
+    */
+    static size_t forwardFindLongestNoun(const void *context, const std::vector<Token> &tokens, const Range &range, bool &skipIgnoreWords);
+
+    /*!
+      \brief Forwards the function call to the findLongestVerb member function.
+
+      This function forwards the caller to the findLongestVerb() member function
+      of the LexicalData instance specified in \a context.
+
+      \param[in]  context         Specifies a pointer to the LexicalData instance to use.
+      \param[in]  tokens          Specifies the tokenized input text.
+      \param[in]  range           Specifies the range of tokens to check.
+      \param[out] skipIgnoreWords Set to whether the alias only matched after
+                                  omitting ignore words.
+
+      \return Returns the result of findLongestVerb().
+    */
+    static size_t forwardFindLongestVerb(const void *context, const std::vector<Token> &tokens, const Range &range, bool &skipIgnoreWords);
+
 private:
     WordMap _verbs;
     WordMap _nouns;
     mutable std::mutex _verbLock;
     mutable std::mutex _nounLock;
+    std::atomic<unsigned long> _version;
 };
 
 } }
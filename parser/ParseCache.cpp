@@ -0,0 +1,102 @@
+/*!
+  \file     ParseCache.cpp
+  \author   agent
+  \created  10/19/2026
+  \modified 10/19/2026
+
+  \details  This file contains the implementation of the ParseCache class.
+*/
+
+#include "ParseCache.hpp"
+
+#include "LexicalData.hpp"
+#include "WordManager.hpp"
+
+namespace legacymud { namespace parser {
+
+const size_t ParseCache::DEFAULT_CAPACITY;
+
+ParseCache::Key::Key(const std::string &input, const LexicalData &player, const LexicalData &area, bool isAdmin, bool editMode)
+    : input(input),
+      playerVersion(player.getVersion()),
+      areaVersion(area.getVersion()),
+      verbVersion(WordManager::getVerbVersion()),
+      localVersion(WordManager::getLocalVersion()),
+      usesLocalWords(true),
+      isAdmin(isAdmin),
+      editMode(editMode) {
+}
+
+bool ParseCache::Key::operator==(const Key &other) const {
+    return playerVersion == other.playerVersion
+        && areaVersion == other.areaVersion
+        && verbVersion == other.verbVersion
+        && localVersion == other.localVersion
+        && isAdmin == other.isAdmin
+        && editMode == other.editMode
+        && input == other.input;
+}
+
+bool ParseCache::Key::isCurrent(const Key &current) const {
+    return playerVersion == current.playerVersion
+        && areaVersion == current.areaVersion
+        && verbVersion == current.verbVersion
+        && (!usesLocalWords || localVersion == current.localVersion)
+        && isAdmin == current.isAdmin
+        && editMode == current.editMode
+        && input == current.input;
+}
+
+ParseCache::ParseCache(size_t capacity) : _capacity(capacity) {
+}
+
+// The cache is small, so a linear search is faster than hashing the input.
+bool ParseCache::find(const Key &key, std::vector<ParseResult> &results) {
+    std::lock_guard<std::mutex> guard(_lock);
+    for (auto it = _entries.begin(); it != _entries.end(); ++it) {
+        if (it->key.isCurrent(key)) {
+            // Move the entry to the front without copying it
+            _entries.splice(_entries.begin(), _entries, it);
+            results = _entries.front().results;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void ParseCache::insert(const Key &key, const std::vector<ParseResult> &results) {
+    std::lock_guard<std::mutex> guard(_lock);
+    if (_capacity == 0)
+        return;
+
+    // Replace the stale entry for the same input, if any
+    for (auto it = _entries.begin(); it != _entries.end(); ++it) {
+        if (it->key.input == key.input) {
+            it->key = key;
+            it->results = results;
+            _entries.splice(_entries.begin(), _entries, it);
+            return;
+        }
+    }
+
+    if (_entries.size() >= _capacity) {
+        _entries.pop_back();
+    }
+    Entry entry;
+    entry.key = key;
+    entry.results = results;
+    _entries.push_front(std::move(entry));
+}
+
+void ParseCache::clear() {
+    std::lock_guard<std::mutex> guard(_lock);
+    _entries.clear();
+}
+
+size_t ParseCache::size() const {
+    std::lock_guard<std::mutex> guard(_lock);
+    return _entries.size();
+}
+
+} }
@@ -0,0 +1,143 @@
+/*!
+  \file     ParseCache.hpp
+  \author   agent
+  \created  10/19/2026
+  \modified 10/19/2026
+
+  \details  This file contains the declarations for the ParseCache class.
+            The ParseCache class remembers the most recent parse results
+            of a player so repeated commands do not need to be parsed again.
+*/
+#ifndef LEGACYMUD_PARSER_PARSECACHE_HPP
+#define LEGACYMUD_PARSER_PARSECACHE_HPP
+
+#include "ParseResult.hpp"
+
+#include <list>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace legacymud { namespace parser {
+
+class LexicalData;
+
+/*!
+  \brief Stores the most recently used parse results of a player.
+
+  Each entry is keyed by the normalized input text, the version numbers of
+  the player and area LexicalData objects, the version number of the
+  WordManager verb tables, and the admin and edit mode flags. The in-use
+  alias tables of the WordManager change whenever an object anywhere in the
+  game moves, so their version number is only checked for entries whose
+  parse looked them up. Any change to the lexical data in scope changes one
+  of the checked version numbers, so a stale entry is never returned. Stale
+  entries are replaced when the same input is parsed again, or evicted when
+  the cache is full.
+
+  Each Player should have its own instance of this class.
+*/
+class ParseCache {
+public:
+    /*!
+      \brief Stores the values that a parse result depends on.
+    */
+    struct Key {
+        std::string input;
+        unsigned long playerVersion;
+        unsigned long areaVersion;
+        unsigned long verbVersion;
+        unsigned long localVersion;
+        bool usesLocalWords;
+        bool isAdmin;
+        bool editMode;
+
+        Key() : playerVersion(0), areaVersion(0), verbVersion(0), localVersion(0), usesLocalWords(true), isAdmin(false), editMode(false) { }
+
+        /*!
+          \brief Builds a key from the current state of the lexical data.
+
+          \param[in]  input     Specifies the normalized input text.
+          \param[in]  player    Specifies the lexical data of the Player.
+          \param[in]  area      Specifies the lexical data of the Area the Player is in.
+          \param[in]  isAdmin   Specifies whether the player has admin permissions.
+          \param[in]  editMode  Specifies whether the player is in edit mode.
+        */
+        Key(const std::string &input, const LexicalData &player, const LexicalData &area, bool isAdmin, bool editMode);
+
+        bool operator==(const Key &other) const;
+
+        /*!
+          \brief Gets whether results stored under this key are still valid.
+
+          The version number of the in-use alias tables is only compared
+          if \a usesLocalWords is set on this key.
+
+          \param[in]  current   Specifies the key built from the current state.
+
+          \return Returns whether the results can be used for \a current.
+        */
+        bool isCurrent(const Key &current) const;
+    };
+
+    /*!
+      \brief The number of entries stored by default.
+    */
+    static const size_t DEFAULT_CAPACITY = 8;
+
+    /*!
+      \brief Constructs an empty cache.
+
+      \param[in] capacity   Specifies the maximum number of entries to store.
+    */
+    explicit ParseCache(size_t capacity = DEFAULT_CAPACITY);
+
+    /*!
+      \brief Gets the cached results for a key.
+
+      A matching entry becomes the most recently used entry.
+
+      \param[in]  key     Specifies the key to look up.
+      \param[out] results Set to a copy of the cached results if found.
+
+      \return Returns whether an entry was found for \a key.
+    */
+    bool find(const Key &key, std::vector<ParseResult> &results);
+
+    /*!
+      \brief Stores the results for a key.
+
+      Any entry for the same input text is replaced. If the cache is full,
+      the least recently used entry is evicted.
+
+      \param[in]  key     Specifies the key to store the results under.
+      \param[in]  results Specifies the results to store.
+    */
+    void insert(const Key &key, const std::vector<ParseResult> &results);
+
+    /*!
+      \brief Removes all entries from the cache.
+    */
+    void clear();
+
+    /*!
+      \brief Gets the number of entries in the cache.
+
+      \return Returns the number of entries.
+    */
+    size_t size() const;
+
+private:
+    struct Entry {
+        Key key;
+        std::vector<ParseResult> results;
+    };
+
+    // Most recently used entry first
+    std::list<Entry> _entries;
+    size_t _capacity;
+    mutable std::mutex _lock;
+};
+
+} }
+#endif
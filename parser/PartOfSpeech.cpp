@@ -2,7 +2,7 @@
   \file     PartOfSpeech.cpp
   \author   David Rigert
   \created  02/12/2017
-  \modified 02/18/2017
+  \modified 10/19/2026
   \course   CS467, Winter 2017
  
   \details  This file contains the implementation of the PartOfSpeech class.
@@ -10,6 +10,17 @@
 
 #include "PartOfSpeech.hpp"
 
+namespace {
+
+// Gets the buffer that candidate aliases are joined into. Each thread keeps
+// its own, so repeated lookups reuse the same allocation.
+std::string &getScratch() {
+    static thread_local std::string scratch;
+    return scratch;
+}
+
+}
+
 namespace legacymud { namespace parser {
 
 PartOfSpeech::PartOfSpeech() {
@@ -19,8 +30,8 @@ PartOfSpeech::PartOfSpeech() {
 
 bool PartOfSpeech::findMatch(const std::vector<Token> &tokens, Range &range, bool (*findWord)(const void *, std::string word), const void *context) {
     if (range.end > tokens.size()) {
-        _alias = std::string();
-        _originalAlias = std::string();
+        _alias.clear();
+        _originalAlias.clear();
         _isValid = false;
         return _isValid;
     }
@@ -31,21 +42,22 @@ bool PartOfSpeech::findMatch(const std::vector<Token> &tokens, Range &range, boo
     // Search for entire range and chop one off the back each time
     for (; range.end > 0; --range.end) {
         // Try with ignore words
-        std::string substring = Tokenizer::joinNormalized(tokens, range, false);
+        std::string &substring = getScratch();
+        Tokenizer::joinNormalized(tokens, range, false, substring);
         if (!substring.empty() && findWord(context, substring)) {
             // Found a match
             _alias = substring;
-            _originalAlias = Tokenizer::joinOriginal(tokens, range);
+            Tokenizer::joinOriginal(tokens, range, _originalAlias);
             _isValid = true;
             break;
         }
         else {
             // Try without ignore words
-            substring = Tokenizer::joinNormalized(tokens, range, true);
+            Tokenizer::joinNormalized(tokens, range, true, substring);
             if (!substring.empty() && findWord(context, substring)) {
                 // Found a match
                 _alias = substring;
-                _originalAlias = Tokenizer::joinOriginal(tokens, range);
+                Tokenizer::joinOriginal(tokens, range, _originalAlias);
                 _isValid = true;
                 break;
             }
@@ -56,8 +68,8 @@ bool PartOfSpeech::findMatch(const std::vector<Token> &tokens, Range &range, boo
 
     if (!_isValid) {
         // Did not find a match.
-        _alias = std::string();
-        _originalAlias = std::string();
+        _alias.clear();
+        _originalAlias.clear();
         range = originalRange;
         _isValid = false;
     }
@@ -65,10 +77,39 @@ bool PartOfSpeech::findMatch(const std::vector<Token> &tokens, Range &range, boo
     return _isValid;
 }
 
+bool PartOfSpeech::findMatch(const std::vector<Token> &tokens, Range &range, size_t (*findLongest)(const void *, const std::vector<Token> &, const Range &, bool &), const void *context) {
+    if (range.end > tokens.size()) {
+        _alias.clear();
+        _originalAlias.clear();
+        _isValid = false;
+        return _isValid;
+    }
+
+    // Find the longest match in one pass and only join the tokens that matched
+    bool skipIgnoreWords = false;
+    size_t end = findLongest(context, tokens, range, skipIgnoreWords);
+    if (end > range.start) {
+        range.end = end;
+        Tokenizer::joinNormalized(tokens, range, skipIgnoreWords, _alias);
+        Tokenizer::joinOriginal(tokens, range, _originalAlias);
+        _range = range;
+        _isValid = true;
+    }
+    else {
+        // Did not find a match.
+        _alias.clear();
+        _originalAlias.clear();
+        _range = Range(range.start, 0);
+        _isValid = false;
+    }
+
+    return _isValid;
+}
+
 bool PartOfSpeech::findExactMatch(const std::vector<Token> &tokens, const Range &range, bool (*findWord)(const void *, std::string word), const void *context) {
     if (range.end > tokens.size()) {
-        _alias = std::string();
-        _originalAlias = std::string();
+        _alias.clear();
+        _originalAlias.clear();
         _isValid = false;
         return _isValid;
     }
@@ -76,22 +117,23 @@ bool PartOfSpeech::findExactMatch(const std::vector<Token> &tokens, const Range
     _isValid = false;
 
     // Search for a match only with the entire specified range.
-    std::string substring = Tokenizer::joinNormalized(tokens, range, false);
+    std::string &substring = getScratch();
+    Tokenizer::joinNormalized(tokens, range, false, substring);
     // Try with ignore words first
     if (!substring.empty() && findWord(context, substring)) {
         // Found a match
         _alias = substring;
-        _originalAlias = Tokenizer::joinOriginal(tokens, range);
+        Tokenizer::joinOriginal(tokens, range, _originalAlias);
         _isValid = true;
         _range = range;
     }
     else {
         // Try without ignore words if not found with
-        substring = Tokenizer::joinNormalized(tokens, range, true);
+        Tokenizer::joinNormalized(tokens, range, true, substring);
         if (!substring.empty() && findWord(context, substring)) {
             // Found a match
             _alias = substring;
-            _originalAlias = Tokenizer::joinOriginal(tokens, range);
+            Tokenizer::joinOriginal(tokens, range, _originalAlias);
             _isValid = true;
             _range = range;
         }
@@ -99,8 +141,8 @@ bool PartOfSpeech::findExactMatch(const std::vector<Token> &tokens, const Range
     
     if (!_isValid) {
         // Did not find a match.
-        _alias = std::string();
-        _originalAlias = std::string();
+        _alias.clear();
+        _originalAlias.clear();
         _range = Range(0, 0);
         _isValid = false;
     }
@@ -122,25 +164,23 @@ Range PartOfSpeech::getRange() const {
 
 bool PartOfSpeech::setAlias(const std::vector<Token> &tokens, Range range) {
     if (range.end > tokens.size()) {
-        _alias = std::string();
-        _originalAlias = std::string();
+        _alias.clear();
+        _originalAlias.clear();
         _isValid = false;
         return _isValid;
     }
 
-    std::string normalized = Tokenizer::joinNormalized(tokens, range, false);
-    std::string original = Tokenizer::joinOriginal(tokens, range);
+    Tokenizer::joinNormalized(tokens, range, false, _alias);
+    Tokenizer::joinOriginal(tokens, range, _originalAlias);
 
-    if (!normalized.empty() && !original.empty()) {
-        _alias = normalized;
-        _originalAlias = original;
+    if (!_alias.empty() && !_originalAlias.empty()) {
         _range = range;
         _isValid = true;
     }
     else {
         _range = Range(0, 0);
-        _alias = std::string();
-        _originalAlias = std::string();
+        _alias.clear();
+        _originalAlias.clear();
         _isValid = false;
     }
 
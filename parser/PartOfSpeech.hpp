@@ -2,7 +2,7 @@
   \file     PartOfSpeech.hpp
   \author   David Rigert
   \created  02/11/2017
-  \modified 02/18/2017
+  \modified 10/19/2026
   \course   CS467, Winter 2017
  
   \details  This file contains the declarations for the PartOfSpeech class and
@@ -77,6 +77,42 @@ public:
     */
     bool findMatch(const std::vector<Token> &tokens, Range &range, bool (*findWord)(const void *, std::string word)) { return findMatch(tokens, range, findWord, 0); }
 
+    /*!
+      \brief Finds the longest token sequence that matches the part of speech.
+
+      This function uses a member function \a findLongest to find the longest
+      matching sequence of words in \a tokens in a single pass over the range,
+      instead of looking up every shorter prefix of the range in turn.
+      The result is the same as the findMatch() overload that takes a 
+      \c findWord function.
+
+      \param[in]     tokens      Specifies the tokenized input text.
+      \param[in,out] range       Specifies the range of tokens to check. This is updated
+                                 to the actual range of tokens that matched the part of speech.
+      \param[in]     findLongest Specifies a pointer to the longest-match function of the
+                                 container to check for a match in.
+      \param[in]     context     Specifies the instance to use for the \a findLongest member function.
+      
+      \return Returns whether a match was found.
+    */
+    bool findMatch(const std::vector<Token> &tokens, Range &range, size_t (*findLongest)(const void *, const std::vector<Token> &, const Range &, bool &), const void *context);
+
+    /*!
+      \brief Finds the longest token sequence that matches the part of speech.
+
+      This function uses a static function \a findLongest to find the longest
+      matching sequence of words in \a tokens in a single pass over the range.
+
+      \param[in]     tokens      Specifies the tokenized input text.
+      \param[in,out] range       Specifies the range of tokens to check. This is updated
+                                 to the actual range of tokens that matched the part of speech.
+      \param[in]     findLongest Specifies a pointer to the longest-match function of the
+                                 container to check for a match in.
+      
+      \return Returns whether a match was found.
+    */
+    bool findMatch(const std::vector<Token> &tokens, Range &range, size_t (*findLongest)(const void *, const std::vector<Token> &, const Range &, bool &)) { return findMatch(tokens, range, findLongest, 0); }
+
     /*!
       \brief Finds if the specified token sequence is a part of speech.
 
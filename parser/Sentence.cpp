@@ -2,7 +2,7 @@
   \file     Sentence.cpp
   \author   David Rigert
   \created  02/12/2017
-  \modified 02/17/2017
+  \modified 10/19/2026
   \course   CS467, Winter 2017
  
   \details  This file contains the implementation of the Sentence class.
@@ -27,8 +27,22 @@
 
 namespace legacymud { namespace parser {
 
-// Finds a matching verb of VerbType and creates an instance of a Sentence subclass based on Grammar rules.
-Sentence *Sentence::makeSentence(const Grammar &rules, PartOfSpeech verb, VerbType type, engine::CommandEnum command) {
+// Selects the shared instance of the Sentence subclass based on Grammar rules.
+const Sentence *Sentence::getSentence(const Grammar &rules) {
+    // One instance of each subclass serves every parse
+    static const VDISentence vdiSentence;
+    static const VDPISentence vdpiSentence;
+    static const VDPTSentence vdptSentence;
+    static const VDSentence vdSentence;
+    static const VDTSentence vdtSentence;
+    static const VPISentence vpiSentence;
+    static const VPTSentence vptSentence;
+    static const VSentence vSentence;
+    static const VTISentence vtiSentence;
+    static const VTPISentence vtpiSentence;
+    static const VTPTSentence vtptSentence;
+    static const VTSentence vtSentence;
+
     switch (rules.takesDirectObject()) {
     case Grammar::NO:
         if (rules.takesPreposition()) {
@@ -38,17 +52,17 @@ Sentence *Sentence::makeSentence(const Grammar &rules, PartOfSpeech verb, VerbTy
                 return nullptr;
                 break;
             case Grammar::YES:
-                return new VPISentence(verb, type, command);
+                return &vpiSentence;
                 break;
             case Grammar::TEXT:
-                return new VPTSentence(verb, type, command);
+                return &vptSentence;
                 break;
             }
         }
         else {
             switch (rules.takesIndirectObject()) {
             case Grammar::NO:
-                return new VSentence(verb, type, command);
+                return &vSentence;
                 break;
             case Grammar::YES:
                 // Verb-Indirect Unsupported
@@ -69,23 +83,23 @@ Sentence *Sentence::makeSentence(const Grammar &rules, PartOfSpeech verb, VerbTy
                 return nullptr;
                 break;
             case Grammar::YES:
-                return new VDPISentence(verb, type, command);
+                return &vdpiSentence;
                 break;
             case Grammar::TEXT:
-                return new VDPTSentence(verb, type, command);
+                return &vdptSentence;
                 break;
             }
         }
         else {
             switch (rules.takesIndirectObject()) {
             case Grammar::NO:
-                return new VDSentence(verb, type, command);
+                return &vdSentence;
                 break;
             case Grammar::YES:
-                return new VDISentence(verb, type, command);
+                return &vdiSentence;
                 break;
             case Grammar::TEXT:
-                return new VDTSentence(verb, type, command);
+                return &vdtSentence;
                 break;
             }
         }
@@ -98,20 +112,20 @@ Sentence *Sentence::makeSentence(const Grammar &rules, PartOfSpeech verb, VerbTy
                 return nullptr;
                 break;
             case Grammar::YES:
-                return new VTPISentence(verb, type, command);
+                return &vtpiSentence;
                 break;
             case Grammar::TEXT:
-                return new VTPTSentence(verb, type, command);
+                return &vtptSentence;
                 break;
             }
         }
         else {
             switch (rules.takesIndirectObject()) {
             case Grammar::NO:
-                return new VTSentence(verb, type, command);
+                return &vtSentence;
                 break;
             case Grammar::YES:
-                return new VTISentence(verb, type, command);
+                return &vtiSentence;
                 break;
             case Grammar::TEXT:
                 // Verb-Direct Text-Indirect Text Unsupported
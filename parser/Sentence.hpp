@@ -2,7 +2,7 @@
   \file     Sentence.hpp
   \author   David Rigert
   \created  02/11/2017
-  \modified 02/15/2017
+  \modified 10/19/2026
   \course   CS467, Winter 2017
  
   \details  This file contains the declarations for the Sentence class and
@@ -30,26 +30,28 @@ struct Token;
 /*!
   \brief Represents one interpretation of the input string.
 
-  This abstract class holds an interpretation of the input string based on 
-  the specified VerbType.
+  This abstract class interprets the input string based on the specified 
+  VerbType. Each subclass parses one shape of Grammar and keeps no state 
+  of its own, so instances are shared.
 */
 class Sentence {
 public:
     virtual ~Sentence() { }
 
     /*!
-      \brief Creates an instance of a Sentence subclass based on Grammar rules.
+      \brief Gets the Sentence subclass that parses the specified Grammar rules.
 
-      This factory function is used to create an instance of Sentence subclass based
-      on the specified Grammar \a rules.
+      This function selects the Sentence subclass based on the shape of the
+      specified Grammar \a rules. Sentence subclasses do not store any state
+      between calls, so one shared instance of each subclass is used for every
+      parse on every thread. The returned object must not be deleted.
 
-      \param[in] rules      Specifies the Grammar rules to use when making the sentence.
-      \param[in] verb       Specifies the PartOfSpeech object used to find the verb alias.
-      \param[in] type       Specifies the type of verb (e.g. edit mode, builder, global, local, etc.)
+      \param[in] rules      Specifies the Grammar rules to use when parsing the sentence.
 
-      \return Returns a pointer to a concrete Sentence subclass object.
+      \return Returns a pointer to a concrete Sentence subclass object, or nullptr
+              if the Grammar rules are not supported.
     */
-    static Sentence *makeSentence(const Grammar &rules, PartOfSpeech verb, VerbType type, engine::CommandEnum command);
+    static const Sentence *getSentence(const Grammar &rules);
 
     /*!
       \brief Gets a ParseResult object based on the parsed input string.
@@ -58,11 +60,17 @@ public:
       \param[in] playerLex  Specifies the lexical data for objects in the player inventory.
       \param[in] areaLex    Specifies the lexical data for objects in the current area.
       \param[in] grammar    Specifies the grammar rules for the verb being processed.
+      \param[in] verb       Specifies the PartOfSpeech object used to find the verb alias.
+      \param[in] type       Specifies the type of verb (e.g. edit mode, builder, global, local, etc.)
+      \param[in] command    Specifies the command that the verb maps to.
     */
     virtual ParseResult getResult(const std::vector<Token> &tokens, 
                                   const LexicalData &playerLex, 
                                   const LexicalData &areaLex,
-                                  const Grammar &grammar) = 0;
+                                  const Grammar &grammar,
+                                  const PartOfSpeech &verb,
+                                  VerbType type,
+                                  engine::CommandEnum command) const = 0;
 };
 
 } }
@@ -0,0 +1,135 @@
+/*!
+  \file     ShardedWordMap.cpp
+  \author   agent
+  \created  10/19/2026
+  \modified 10/19/2026
+
+  \details  This file contains the implementation of the ShardedWordMap class.
+*/
+
+#include "ShardedWordMap.hpp"
+
+#include "WordManager.hpp"
+
+#include <algorithm>
+#include <cctype>
+
+namespace {
+
+// Helper function for getting the lowercase first word of an alias.
+std::string getFirstWord(const std::string &alias) {
+    std::string word = alias.substr(0, alias.find(' '));
+    std::transform(word.begin(), word.end(), word.begin(), ::tolower);
+    return word;
+}
+
+}
+
+namespace legacymud { namespace parser {
+
+const size_t ShardedWordMap::SHARD_COUNT;
+
+bool ShardedWordMap::addWord(const std::string &alias, engine::InteractiveNoun *pObject) {
+    Shard &shard = _shards[getShardIndex(alias, true)];
+    std::lock_guard<std::mutex> guard(shard.lock);
+    return shard.words.addWord(alias, pObject);
+}
+
+bool ShardedWordMap::hasWord(const std::string &alias) const {
+    const Shard &shard = _shards[getShardIndex(alias, false)];
+    std::lock_guard<std::mutex> guard(shard.lock);
+    return shard.words.hasWord(alias);
+}
+
+std::vector<engine::InteractiveNoun *> ShardedWordMap::getObjects(const std::string &alias) const {
+    const Shard &shard = _shards[getShardIndex(alias, false)];
+    std::lock_guard<std::mutex> guard(shard.lock);
+    return shard.words.getObjects(alias);
+}
+
+// An alias can only start at the first token or, when ignore words are
+// skipped, at the first token that is not an ignore word. At most two
+// shards need to be checked.
+size_t ShardedWordMap::findLongest(const std::vector<Token> &tokens, const Range &range, bool &skipIgnoreWords) const {
+    skipIgnoreWords = false;
+    if (range.start >= range.end || range.end > tokens.size())
+        return range.start;
+
+    size_t first = tokens[range.start].symbol % SHARD_COUNT;
+    size_t second = first;
+    for (size_t i = range.start; i < range.end; ++i) {
+        if (!WordManager::isIgnoreSymbol(tokens[i].symbol)) {
+            second = tokens[i].symbol % SHARD_COUNT;
+            break;
+        }
+    }
+
+    size_t longest;
+    {
+        std::lock_guard<std::mutex> guard(_shards[first].lock);
+        longest = _shards[first].words.findLongest(tokens, range, skipIgnoreWords);
+    }
+    if (second != first) {
+        bool skip = false;
+        size_t end;
+        {
+            std::lock_guard<std::mutex> guard(_shards[second].lock);
+            end = _shards[second].words.findLongest(tokens, range, skip);
+        }
+        // On a tie, keep the form that includes the ignore words
+        if (end > longest) {
+            longest = end;
+            skipIgnoreWords = skip;
+        }
+    }
+
+    return longest;
+}
+
+bool ShardedWordMap::removeWord(const std::string &alias, engine::InteractiveNoun *pObject) {
+    Shard &shard = _shards[getShardIndex(alias, false)];
+    std::lock_guard<std::mutex> guard(shard.lock);
+    return shard.words.removeWord(alias, pObject);
+}
+
+void ShardedWordMap::apply(const std::vector<WordChange> &changes, std::vector<const WordChange *> &failed) {
+    // Find the shard of every change first, so each shard is locked only once
+    std::vector<size_t> shardIndexes;
+    shardIndexes.reserve(changes.size());
+    for (auto it = changes.begin(); it != changes.end(); ++it) {
+        shardIndexes.push_back(getShardIndex(it->alias, it->isAdd));
+    }
+
+    for (size_t i = 0; i < SHARD_COUNT; ++i) {
+        std::unique_lock<std::mutex> guard(_shards[i].lock, std::defer_lock);
+        for (size_t j = 0; j < changes.size(); ++j) {
+            if (shardIndexes[j] != i)
+                continue;
+            if (!guard.owns_lock())
+                guard.lock();
+
+            const WordChange &change = changes[j];
+            bool success = change.isAdd
+                ? _shards[i].words.addWord(change.alias, change.pObject)
+                : _shards[i].words.removeWord(change.alias, change.pObject);
+            if (!success) {
+                failed.push_back(&change);
+            }
+        }
+    }
+}
+
+void ShardedWordMap::clear() {
+    for (size_t i = 0; i < SHARD_COUNT; ++i) {
+        std::lock_guard<std::mutex> guard(_shards[i].lock);
+        _shards[i].words.clear();
+    }
+}
+
+size_t ShardedWordMap::getShardIndex(const std::string &alias, bool intern) {
+    std::string word = getFirstWord(alias);
+    Symbol symbol = intern ? SymbolTable::intern(word) : SymbolTable::find(word);
+    return symbol % SHARD_COUNT;
+}
+
+} }
@@ -0,0 +1,125 @@
+/*!
+  \file     ShardedWordMap.hpp
+  \author   agent
+  \created  10/19/2026
+  \modified 10/19/2026
+
+  \details  This file contains the declarations for the ShardedWordMap class.
+            The ShardedWordMap class is a thread-safe WordMap that is split
+            into independently locked shards.
+*/
+#ifndef LEGACYMUD_PARSER_SHARDEDWORDMAP_HPP
+#define LEGACYMUD_PARSER_SHARDEDWORDMAP_HPP
+
+#include "LexicalBatch.hpp"
+#include "WordMap.hpp"
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace legacymud { namespace parser {
+
+/*!
+  \brief Represents a WordMap that is split into separately locked shards.
+
+  Each alias is stored in the shard selected by the symbol of its first word.
+  A thread that adds or removes an alias only locks that shard, so moving an
+  object only blocks the threads that are looking up aliases with the same
+  first word, rather than every thread that is parsing input.
+
+  All member functions lock the shards they use.
+*/
+class ShardedWordMap {
+public:
+    /*!
+      \brief The number of shards in the map.
+    */
+    static const size_t SHARD_COUNT = 16;
+
+    /*!
+      \brief Adds an alias-InteractiveNoun pair to the map.
+
+      \param[in]  alias   Specifies the alias to add.
+      \param[in]  pObject Specifies the InteractiveNoun with the alias.
+
+      \return Returns the result of WordMap::addWord().
+    */
+    bool addWord(const std::string &alias, engine::InteractiveNoun *pObject);
+
+    /*!
+      \brief Gets whether the map contains the specified alias.
+
+      \param[in]  alias   Specifies the alias to check for.
+
+      \return Returns whether \a alias is in the map.
+    */
+    bool hasWord(const std::string &alias) const;
+
+    /*!
+      \brief Gets all InteractiveNoun objects with the specified alias.
+
+      \param[in]  alias   Specifies the alias to get objects for.
+
+      \return Returns a vector of InteractiveNoun pointers that match \a alias.
+    */
+    std::vector<engine::InteractiveNoun *> getObjects(const std::string &alias) const;
+
+    /*!
+      \brief Finds the longest alias at the start of a token range.
+
+      This function checks the shard of the first token and the shard of the
+      first token that is not an ignore word, and gets the longer match.
+
+      \param[in]  tokens          Specifies the tokenized input text.
+      \param[in]  range           Specifies the range of tokens to check.
+      \param[out] skipIgnoreWords Set to whether the match was found only
+                                  after omitting ignore words.
+
+      \return Returns the end of the longest matching range, or
+              \a range.start if there is no match.
+    */
+    size_t findLongest(const std::vector<Token> &tokens, const Range &range, bool &skipIgnoreWords) const;
+
+    /*!
+      \brief Removes an alias-InteractiveNoun pair from the map.
+
+      \param[in]  alias   Specifies the alias to remove.
+      \param[in]  pObject Specifies the InteractiveNoun with the alias.
+
+      \return Returns the result of WordMap::removeWord().
+    */
+    bool removeWord(const std::string &alias, engine::InteractiveNoun *pObject);
+
+    /*!
+      \brief Applies a list of alias changes to the map.
+
+      The changes are grouped by shard, and each shard is locked once.
+      Changes to the same alias are applied in the order they appear
+      in \a changes.
+
+      \param[in]  changes Specifies the changes to apply.
+      \param[out] failed  Receives a pointer to each change that
+                          WordMap::addWord() or WordMap::removeWord() rejected.
+    */
+    void apply(const std::vector<WordChange> &changes, std::vector<const WordChange *> &failed);
+
+    /*!
+      \brief Removes all aliases from the map.
+    */
+    void clear();
+
+private:
+    struct Shard {
+        WordMap words;
+        mutable std::mutex lock;
+    };
+
+    // Gets the shard index for the alias, interning its first word if \a intern is true.
+    static size_t getShardIndex(const std::string &alias, bool intern);
+
+    Shard _shards[SHARD_COUNT];
+};
+
+} }
+#endif
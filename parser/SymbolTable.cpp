@@ -0,0 +1,71 @@
+/*!
+  \file     SymbolTable.cpp
+  \author   agent
+  \created  10/19/2026
+  \modified 10/19/2026
+
+  \details  This file contains the implementation of the SymbolTable class.
+*/
+
+#include "SymbolTable.hpp"
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+// Mutex for the symbol table
+std::mutex symbolLock;
+
+// Maps each interned word to its symbol
+std::unordered_map<std::string, legacymud::parser::Symbol> &getSymbols() {
+    static std::unordered_map<std::string, legacymud::parser::Symbol> symbols;
+    return symbols;
+}
+
+// Maps each symbol back to its word. Index 0 is NO_SYMBOL.
+std::vector<std::string> &getWords() {
+    static std::vector<std::string> words(1);
+    return words;
+}
+
+}
+
+namespace legacymud { namespace parser {
+
+// Gets the symbol of the word, adding the word if it is new.
+Symbol SymbolTable::intern(const std::string &word) {
+    if (word.empty())
+        return NO_SYMBOL;
+
+    std::lock_guard<std::mutex> guard(symbolLock);
+    auto &symbols = getSymbols();
+    auto it = symbols.find(word);
+    if (it != symbols.end())
+        return it->second;
+
+    auto &words = getWords();
+    Symbol symbol = static_cast<Symbol>(words.size());
+    words.push_back(word);
+    symbols.emplace(word, symbol);
+
+    return symbol;
+}
+
+// Gets the symbol of the word if it has been interned.
+Symbol SymbolTable::find(const std::string &word) {
+    std::lock_guard<std::mutex> guard(symbolLock);
+    auto &symbols = getSymbols();
+    auto it = symbols.find(word);
+    return it == symbols.end() ? NO_SYMBOL : it->second;
+}
+
+// Gets the word that the symbol was interned from.
+std::string SymbolTable::getWord(Symbol symbol) {
+    std::lock_guard<std::mutex> guard(symbolLock);
+    auto &words = getWords();
+    return symbol < words.size() ? words[symbol] : std::string();
+}
+
+} }
@@ -0,0 +1,78 @@
+/*!
+  \file     SymbolTable.hpp
+  \author   agent
+  \created  10/19/2026
+  \modified 10/19/2026
+
+  \details  This file contains the declarations for the SymbolTable class.
+            The SymbolTable class maps normalized words and aliases to
+            dense integer IDs so the parser can compare integers instead
+            of strings.
+*/
+#ifndef LEGACYMUD_PARSER_SYMBOLTABLE_HPP
+#define LEGACYMUD_PARSER_SYMBOLTABLE_HPP
+
+#include <string>
+
+namespace legacymud { namespace parser {
+
+/*!
+  \typedef Symbol
+  \brief Specifies the type of an interned word ID.
+*/
+typedef unsigned int Symbol;
+
+/*!
+  \brief The symbol of a word that has not been interned.
+*/
+const Symbol NO_SYMBOL = 0;
+
+/*!
+  \brief Stores the global table of interned words.
+
+  Every verb alias, noun alias, and ignore word is interned when it is added
+  to the WordManager or a LexicalData object, and keeps its ID for the life
+  of the process. Input text is only looked up, never interned, so words
+  that players type but that are not in use by any object do not grow the
+  table.
+
+  This class should not be instantiated. All member functions are static.
+*/
+class SymbolTable {
+public:
+    /*!
+      \brief Gets the symbol for a word, adding it to the table if needed.
+
+      \param[in] word   Specifies the normalized (lowercase) word to intern.
+
+      \return Returns the symbol of \a word, or NO_SYMBOL if \a word is empty.
+    */
+    static Symbol intern(const std::string &word);
+
+    /*!
+      \brief Gets the symbol for a word without adding it to the table.
+
+      \param[in] word   Specifies the normalized (lowercase) word to look up.
+
+      \return Returns the symbol of \a word, or NO_SYMBOL if it has not
+              been interned.
+    */
+    static Symbol find(const std::string &word);
+
+    /*!
+      \brief Gets the word that corresponds to a symbol.
+
+      \param[in] symbol Specifies the symbol to look up.
+
+      \return Returns the interned word, or an empty string if \a symbol
+              is not in the table.
+    */
+    static std::string getWord(Symbol symbol);
+
+private:
+    // Use a private constructor to prevent instantiation.
+    SymbolTable() {}
+};
+
+} }
+#endif
@@ -2,7 +2,7 @@
   \file     TextParser.cpp
   \author   David Rigert
   \created  01/29/2017
-  \modified 02/21/2017
+  \modified 10/19/2026
   \course   CS467, Winter 2017
  
   \details This file contains the implementation code for the TextParser class.
@@ -10,6 +10,8 @@
 
 #include "TextParser.hpp"
 
+#include "BKTree.hpp"
+#include "EditDistance.hpp"
 #include "LexicalData.hpp"
 #include "PartOfSpeech.hpp"
 #include "Sentence.hpp"
@@ -23,26 +25,59 @@
 #include <string.h>
 #include <sstream>
 #include <iostream>
-#include <queue>
+#include <utility>
 
 
 namespace legacymud { namespace parser {
 
+const size_t TextParser::MAX_SUGGESTION_WORDS;
+
 /*!
-  \brief Comparator class to sort ParseResult objects by ParseStatus in descending order.
+  \brief Comparator class to sort ParseResult objects by ParseStatus in ascending order.
 
-  This class is intended to be used in a priority queue to put the most complete
-  ParseResult object on top.
+  This class is intended to be used with std::max_element to find the most complete
+  ParseResult object. It compares by reference, so no ParseResult is copied.
 */
 class ComparePriority {
 public:
-    bool operator() (const ParseResult lhs, const ParseResult rhs) {
+    bool operator() (const ParseResult &lhs, const ParseResult &rhs) const {
         return static_cast<int>(lhs.status) < static_cast<int>(rhs.status);
     }
 };
 
-std::vector<ParseResult> TextParser::parse(
-    const std::string input, 
+/*!
+  \brief Moves every candidate with the specified status into the results.
+
+  The remaining candidates stay in \a candidates in their original order.
+
+  \param[in,out] candidates Specifies the candidates to take from.
+  \param[in,out] results    Specifies the results to append the matching candidates to.
+  \param[in]     status     Specifies the status of the candidates to take.
+*/
+void takeCandidates(std::vector<ParseResult> &candidates, std::vector<ParseResult> &results, ParseStatus status) {
+    size_t kept = 0;
+    for (size_t i = 0; i < candidates.size(); ++i) {
+        if (candidates[i].status == status) {
+            results.push_back(std::move(candidates[i]));
+        }
+        else {
+            if (kept != i) {
+                candidates[kept] = std::move(candidates[i]);
+            }
+            ++kept;
+        }
+    }
+    candidates.erase(candidates.begin() + kept, candidates.end());
+}
+
+/*!
+  \brief Parses tokenized input text into potential commands.
+
+  This function implements TextParser::parse() after the input text
+  has been tokenized.
+*/
+std::vector<ParseResult> parseTokens(
+    const std::vector<Token> &tokens,
     const LexicalData &player,
     const LexicalData &area,
     bool isAdmin,
@@ -50,15 +85,13 @@ std::vector<ParseResult> TextParser::parse(
     ) {
 
     // Stores the sentence parser
-    Sentence *parser = nullptr;
+    const Sentence *parser = nullptr;
     
     // Stores the parse result
-    std::priority_queue<ParseResult, std::vector<ParseResult>, ComparePriority> candidates;
+    std::vector<ParseResult> candidates;
     std::vector<ParseResult> results;
     ParseResult result;
 
-    // STEP 1: Tokenize input string
-    auto tokens = Tokenizer::tokenizeInput(input);
     Range range = Range(0, tokens.size());
 
     // STEP 2: Look for a matching verb alias
@@ -67,29 +100,23 @@ std::vector<ParseResult> TextParser::parse(
     // Check for admin privileges
     if (isAdmin) {
         // FIRST: Check for edit mode verb match
-        if (verb.findMatch(tokens, range, WordManager::hasEditModeVerb)) {
+        if (verb.findMatch(tokens, range, WordManager::findLongestEditModeVerb)) {
             // Found edit mode verb; get grammar rules
-            std::vector<VerbInfo> verbs = WordManager::getEditModeVerbs(verb.getAlias());
+            VerbSpan verbs = WordManager::getEditModeVerbs(verb.getAlias());
             // Run parser on each grammar definition and store the candidates
             for (auto it = verbs.begin(); it != verbs.end(); ++it) {
-                parser = Sentence::makeSentence(it->grammar, verb, VerbType::EDITMODE, it->command);
+                parser = Sentence::getSentence(it->grammar);
                 // Skip if unsupported grammar type
                 if (parser == nullptr) {
                     std::cerr << "Unsupported grammar type detected in " << verb.getAlias() << std::endl;
                     continue;
                 }
-                result = parser->getResult(tokens, player, area, it->grammar);
-                candidates.push(result);
-                //std::cout << "Found edit mode candidate with status of " << static_cast<int>(result.status) << std::endl;
-                
-                delete parser;
+                candidates.push_back(parser->getResult(tokens, player, area, it->grammar, verb, VerbType::EDITMODE, it->command));
+                //std::cout << "Found edit mode candidate with status of " << static_cast<int>(candidates.back().status) << std::endl;
             }
 
             // Add valid candidates to results
-            while (candidates.size() > 0 && candidates.top().status == ParseStatus::VALID) {
-                results.push_back(candidates.top());
-                candidates.pop();
-            }
+            takeCandidates(candidates, results, ParseStatus::VALID);
 
             // Do no further processing if valid edit mode verb found
             if (!results.empty())
@@ -99,29 +126,23 @@ std::vector<ParseResult> TextParser::parse(
         // SECOND: Check for world builder verb match
         verb = PartOfSpeech();
         range = Range(0, tokens.size());
-        if (verb.findMatch(tokens, range, WordManager::hasBuilderVerb)) {
+        if (verb.findMatch(tokens, range, WordManager::findLongestBuilderVerb)) {
             // Found world builder verb; get grammar rules
-            std::vector<VerbInfo> verbs = WordManager::getBuilderVerbs(verb.getAlias());
+            VerbSpan verbs = WordManager::getBuilderVerbs(verb.getAlias());
             // Run parser on each grammar definition and store the candidates
             for (auto it = verbs.begin(); it != verbs.end(); ++it) {
-                parser = Sentence::makeSentence(it->grammar, verb, VerbType::BUILDER, it->command);
+                parser = Sentence::getSentence(it->grammar);
                 // Skip if unsupported grammar type
                 if (parser == nullptr) {
                     std::cerr << "Unsupported grammar type detected in " << verb.getAlias() << std::endl;
                     continue;
                 }
-                result = parser->getResult(tokens, player, area, it->grammar);
-                //std::cout << "Found builder candidate with status of " << static_cast<int>(result.status) << std::endl;
-                candidates.push(result);
-                
-                delete parser;
+                candidates.push_back(parser->getResult(tokens, player, area, it->grammar, verb, VerbType::BUILDER, it->command));
+                //std::cout << "Found builder candidate with status of " << static_cast<int>(candidates.back().status) << std::endl;
             }
 
             // Add valid candidates to results
-            while (candidates.size() > 0 && candidates.top().status == ParseStatus::VALID) {
-                results.push_back(candidates.top());
-                candidates.pop();
-            }
+            takeCandidates(candidates, results, ParseStatus::VALID);
 
             // Do no further processing if valid builder verb found
             if (!results.empty())
@@ -132,58 +153,49 @@ std::vector<ParseResult> TextParser::parse(
     // THIRD: Check for player verb matches
     verb = PartOfSpeech();
     range = Range(0, tokens.size());
-    if (verb.findMatch(tokens, range, &LexicalData::forwardHasVerb, &player)) {
+    if (verb.findMatch(tokens, range, &LexicalData::forwardFindLongestVerb, &player)) {
         // Found local verb on player; get grammar rules
         std::vector<engine::InteractiveNoun *> ins = player.getObjectsByVerb(verb.getAlias());
        // Run parser on each grammar definition and store the results
         for (auto it = ins.begin(); it != ins.end(); ++it) {
             std::vector<engine::Action *> actions = (*it)->getActions(verb.getAlias());
             for (auto it2 = actions.begin(); it2 != actions.end(); ++it2) {
-                parser = Sentence::makeSentence(*((*it2)->getGrammar(verb.getAlias())), verb, VerbType::LOCAL, (*it2)->getCommand());
+                parser = Sentence::getSentence(*((*it2)->getGrammar(verb.getAlias())));
                 // Skip if unsupported grammar type
                 if (parser == nullptr) {
                     std::cerr << "Unsupported grammar type detected in " << verb.getAlias() << std::endl;
                     continue;
                 }
-                result = parser->getResult(tokens, player, area, *((*it2)->getGrammar(verb.getAlias())));
-                //std::cout << "Found player candidate with status of " << static_cast<int>(result.status) << std::endl;
-                candidates.push(result);
+                candidates.push_back(parser->getResult(tokens, player, area, *((*it2)->getGrammar(verb.getAlias())), verb, VerbType::LOCAL, (*it2)->getCommand()));
+                //std::cout << "Found player candidate with status of " << static_cast<int>(candidates.back().status) << std::endl;
             }
-            
-            delete parser;
         }
     }
 
     // FOURTH: Check for area verb matches
     verb = PartOfSpeech();
     range = Range(0, tokens.size());
-    if (verb.findMatch(tokens, range, &LexicalData::forwardHasVerb, &area)) {
+    if (verb.findMatch(tokens, range, &LexicalData::forwardFindLongestVerb, &area)) {
         // Found local verb in area; get grammar rules
         std::vector<engine::InteractiveNoun *> ins = area.getObjectsByVerb(verb.getAlias());
         // Run parser on each grammar definition and store the results
         for (auto it = ins.begin(); it != ins.end(); ++it) {
             std::vector<engine::Action *> actions = (*it)->getActions(verb.getAlias());
             for (auto it2 = actions.begin(); it2 != actions.end(); ++it2) {
-                parser = Sentence::makeSentence(*((*it2)->getGrammar(verb.getAlias())), verb, VerbType::LOCAL, (*it2)->getCommand());
+                parser = Sentence::getSentence(*((*it2)->getGrammar(verb.getAlias())));
                 // Skip if unsupported grammar type
                 if (parser == nullptr) {
                     std::cerr << "Unsupported grammar type detected in " << verb.getAlias() << std::endl;
                     continue;
                 }
-                result = parser->getResult(tokens, player, area, *((*it2)->getGrammar(verb.getAlias())));
-                //std::cout << "Found area candidate with status of " << static_cast<int>(result.status) << std::endl;
-                candidates.push(result);
+                candidates.push_back(parser->getResult(tokens, player, area, *((*it2)->getGrammar(verb.getAlias())), verb, VerbType::LOCAL, (*it2)->getCommand()));
+                //std::cout << "Found area candidate with status of " << static_cast<int>(candidates.back().status) << std::endl;
             }
-            
-            delete parser;
         }
     }
 
     // Add valid candidates to results
-    while (candidates.size() > 0 && candidates.top().status == ParseStatus::VALID) {
-        results.push_back(candidates.top());
-        candidates.pop();
-    }
+    takeCandidates(candidates, results, ParseStatus::VALID);
 
     // Do no further processing if valid local verb found
     if (!results.empty())
@@ -192,29 +204,23 @@ std::vector<ParseResult> TextParser::parse(
     // FIFTH: Check for global verb match
     verb = PartOfSpeech();
     range = Range(0, tokens.size());
-    if (verb.findMatch(tokens, range, WordManager::hasGlobalVerb)) {
+    if (verb.findMatch(tokens, range, WordManager::findLongestGlobalVerb)) {
         // Found global verb; get grammar rules
-        std::vector<VerbInfo> verbs = WordManager::getGlobalVerbs(verb.getAlias());
+        VerbSpan verbs = WordManager::getGlobalVerbs(verb.getAlias());
         // Run parser on each grammar definition and store the candidates
         for (auto it = verbs.begin(); it != verbs.end(); ++it) {
-            parser = Sentence::makeSentence(it->grammar, verb, VerbType::GLOBAL, it->command);
+            parser = Sentence::getSentence(it->grammar);
             // Skip if unsupported grammar type
             if (parser == nullptr) {
                 std::cerr << "Unsupported grammar type detected in " << verb.getAlias() << std::endl;
                 continue;
             }
-            result = parser->getResult(tokens, player, area, it->grammar);
-            //std::cout << "Found global candidate with status of " << static_cast<int>(result.status) << std::endl;
-            candidates.push(result);
-            
-            delete parser;
+            candidates.push_back(parser->getResult(tokens, player, area, it->grammar, verb, VerbType::GLOBAL, it->command));
+            //std::cout << "Found global candidate with status of " << static_cast<int>(candidates.back().status) << std::endl;
         }
 
         // Add valid candidates to results
-        while (candidates.size() > 0 && candidates.top().status == ParseStatus::VALID) {
-            results.push_back(candidates.top());
-            candidates.pop();
-        }
+        takeCandidates(candidates, results, ParseStatus::VALID);
 
         // Do no further processing if valid global verb found
         if (!results.empty())
@@ -226,7 +232,7 @@ std::vector<ParseResult> TextParser::parse(
         result.type = VerbType::INVALID;
         result.command = engine::CommandEnum::INVALID;
         result.unparsed = Tokenizer::joinOriginal(tokens, Range(0, tokens.size()));
-        if (verb.findMatch(tokens, range, WordManager::hasVerb)) {
+        if (verb.findMatch(tokens, range, WordManager::findLongestVerb)) {
             // Found unavailable verb, set UNAVAILABLE_VERB
             result.status = ParseStatus::UNAVAILABLE_VERB;
         }
@@ -234,18 +240,167 @@ std::vector<ParseResult> TextParser::parse(
             // No unavailable verb, set INVALID_VERB
             result.status = ParseStatus::INVALID_VERB;
         }
-        candidates.push(result);
+        candidates.push_back(std::move(result));
     }
 
     // Add best candidates to results
-    ParseStatus topStatus = candidates.top().status;
-    //std::cout << "Top status of " << static_cast<int>(candidates.top().status) << std::endl;
-    while (candidates.size() > 0 && candidates.top().status == topStatus) {
-        results.push_back(candidates.top());
-        candidates.pop();
+    ParseStatus topStatus = std::max_element(candidates.begin(), candidates.end(), ComparePriority())->status;
+    //std::cout << "Top status of " << static_cast<int>(topStatus) << std::endl;
+    takeCandidates(candidates, results, topStatus);
+
+    return results;
+}
+
+/*!
+  \brief Gets the largest edit distance to accept when suggesting a word.
+
+  Short words are within one or two edits of too many other words to make
+  a useful suggestion, so they get a smaller limit.
+
+  \param[in] word  Specifies the misspelled word.
+
+  \return Returns the largest edit distance, or 0 if no suggestion should be made.
+*/
+size_t getMaxDistance(const std::string &word) {
+    if (word.size() < 3)
+        return 0;
+    return word.size() <= 4 ? 1 : 2;
+}
+
+/*!
+  \brief Finds the words in a list that are within the specified edit distance.
+
+  The lists of local aliases are small and change whenever an object moves,
+  so they are compared directly instead of being indexed. Words whose length
+  differs by more than \a maxDistance are skipped without calculating the distance.
+
+  \param[in]  words       Specifies the words to search.
+  \param[in]  word        Specifies the misspelled word.
+  \param[in]  maxDistance Specifies the largest edit distance to include.
+  \param[out] matches     Receives the similar words and their distances.
+*/
+void findSimilarWords(const std::vector<std::string> &words, const std::string &word, size_t maxDistance, std::vector<WordMatch> &matches) {
+    for (auto it = words.begin(); it != words.end(); ++it) {
+        size_t difference = it->size() > word.size() ? it->size() - word.size() : word.size() - it->size();
+        if (difference > maxDistance)
+            continue;
+
+        size_t distance = EditDistance::getDistance(word, *it);
+        if (distance <= maxDistance) {
+            WordMatch match = { *it, distance };
+            matches.push_back(match);
+        }
+    }
+}
+
+/*!
+  \brief Replaces \a best with the closest word in \a matches, if it is closer.
+
+  Exact matches are skipped, because the word is already known to be invalid
+  in that position. Ties are broken alphabetically so the suggestion does not
+  depend on the order of the word lists.
+
+  \param[in]     matches  Specifies the matches to check.
+  \param[in,out] best     Specifies the closest match so far. An empty word means no match.
+*/
+void keepClosest(const std::vector<WordMatch> &matches, WordMatch &best) {
+    WordMatch closest = { std::string(), 0 };
+    for (auto it = matches.begin(); it != matches.end(); ++it) {
+        if (it->distance == 0)
+            continue;
+        if (closest.word.empty() || it->distance < closest.distance
+            || (it->distance == closest.distance && it->word < closest.word)) {
+            closest = *it;
+        }
+    }
+
+    if (!closest.word.empty() && (best.word.empty() || closest.distance < best.distance)) {
+        best = closest;
+    }
+}
+
+std::vector<ParseResult> TextParser::parse(
+    const std::string input, 
+    const LexicalData &player,
+    const LexicalData &area,
+    bool isAdmin,
+    bool editMode
+    ) {
+
+    // STEP 1: Tokenize input string into a token list that this thread reuses
+    static thread_local std::vector<Token> tokens;
+    Tokenizer::tokenizeInput(input, tokens);
+
+    return parseTokens(tokens, player, area, isAdmin, editMode);
+}
+
+std::vector<ParseResult> TextParser::parse(
+    const std::string input, 
+    const LexicalData &player,
+    const LexicalData &area,
+    bool isAdmin,
+    bool editMode,
+    ParseCache &cache
+    ) {
+
+    static thread_local std::vector<Token> tokens;
+    Tokenizer::tokenizeInput(input, tokens);
+
+    // Read the versions before parsing, so a change made during the parse
+    // leaves the stored entry stale instead of the new one.
+    ParseCache::Key key(std::string(), player, area, isAdmin, editMode);
+    Tokenizer::joinNormalized(tokens, Range(0, tokens.size()), false, key.input);
+
+    std::vector<ParseResult> results;
+    if (!cache.find(key, results)) {
+        // Only a parse that looked up the in-use alias tables depends on them
+        unsigned long lookups = WordManager::getLocalLookups();
+        results = parseTokens(tokens, player, area, isAdmin, editMode);
+        key.usesLocalWords = (WordManager::getLocalLookups() != lookups);
+        cache.insert(key, results);
     }
 
     return results;
 }
 
+std::string TextParser::getSuggestion(
+    const ParseResult &result,
+    const LexicalData &player,
+    const LexicalData &area,
+    bool isAdmin
+    ) {
+
+    std::vector<Token> tokens = Tokenizer::tokenizeInput(result.unparsed);
+    std::vector<WordMatch> matches;
+    WordMatch best = { std::string(), 0 };
+
+    if (result.status == ParseStatus::INVALID_VERB) {
+        // Verb aliases can have more than one word, so try each leading group of words.
+        // A shorter group is kept unless a longer one is strictly closer.
+        for (size_t end = 1; end <= tokens.size() && end <= MAX_SUGGESTION_WORDS; ++end) {
+            std::string word = Tokenizer::joinNormalized(tokens, Range(0, end), false);
+            size_t maxDistance = getMaxDistance(word);
+            if (maxDistance == 0)
+                continue;
+
+            matches.clear();
+            WordManager::findSimilarVerbs(word, maxDistance, isAdmin, matches);
+            findSimilarWords(player.getVerbs(), word, maxDistance, matches);
+            findSimilarWords(area.getVerbs(), word, maxDistance, matches);
+            keepClosest(matches, best);
+        }
+    }
+    else if (result.status == ParseStatus::INVALID_DIRECT || result.status == ParseStatus::INVALID_INDIRECT) {
+        std::string word = Tokenizer::joinNormalized(tokens, Range(0, tokens.size()), false);
+        size_t maxDistance = getMaxDistance(word);
+        if (maxDistance > 0) {
+            findSimilarWords(player.getNouns(), word, maxDistance, matches);
+            findSimilarWords(area.getNouns(), word, maxDistance, matches);
+            keepClosest(matches, best);
+        }
+    }
+
+    return best.word;
+}
+
 }}
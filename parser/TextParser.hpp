@@ -2,7 +2,7 @@
   \file     TextParser.hpp
   \author   David Rigert
   \created  02/02/2017
-  \modified 02/20/2017
+  \modified 10/19/2026
   \course   CS467, Winter 2017
  
   \details  This file contains the declarations for the TextParser class and
@@ -15,6 +15,7 @@
 #define LEGACYMUD_PARSER_TEXTPARSER_HPP
 
 #include "WordManager.hpp"
+#include "ParseCache.hpp"
 #include "ParseResult.hpp"
 #include "ParseStatus.hpp"
 
@@ -34,6 +35,12 @@ class LexicalData;
 */
 class TextParser {
 public:
+    /*!
+      \brief The largest number of leading words compared against verb aliases
+             by getSuggestion().
+    */
+    static const size_t MAX_SUGGESTION_WORDS = 3;
+
     /*!
       \brief Converts text input from players into potential commands to be run.
 
@@ -78,6 +85,64 @@ public:
         bool isAdmin = false,
         bool editMode = false
                          );
+
+    /*!
+      \brief Converts text input from players into potential commands, using a cache.
+
+      This function is the same as the other parse() overload, but it first
+      looks for the input in \a cache. If nothing in scope has changed since
+      the same input was last parsed, the cached results are returned without
+      parsing the input again. Otherwise, the input is parsed and the results
+      are stored in \a cache.
+
+      \param[in]  input     Specifies the input text to parse.
+      \param[in]  player    Specifies the lexical data of the Player that
+                            entered the input string.
+      \param[in]  area      Specifies the lexical data of the Area that the
+                            Player is currently in.
+      \param[in]  isAdmin   Specifies whether the player has admin permissions.
+      \param[in]  editMode  Specifies whether the player is in edit mode.
+      \param[in]  cache     Specifies the parse cache of the Player.
+
+      \return Returns a vector of the most complete ParseResult objects.
+    */
+    static std::vector<ParseResult> parse(
+        const std::string input, 
+        const LexicalData &player,
+        const LexicalData &area,
+        bool isAdmin,
+        bool editMode,
+        ParseCache &cache
+                         );
+
+    /*!
+      \brief Gets a known word that is similar to the invalid word in a ParseResult.
+
+      This function is used to ask the player "did you mean" after a typo.
+      If \a result has a status of ParseStatus::INVALID_VERB, the leading words
+      of the input are compared with the verb aliases that the player can use.
+      If it has a status of ParseStatus::INVALID_DIRECT or 
+      ParseStatus::INVALID_INDIRECT, the unparsed text is compared with the
+      noun aliases on the player and in the area.
+
+      The global verbs are searched with a BK-tree, and every comparison uses
+      the bit-parallel EditDistance calculation.
+
+      \param[in]  result    Specifies the invalid result returned by parse().
+      \param[in]  player    Specifies the lexical data of the Player.
+      \param[in]  area      Specifies the lexical data of the Area that the
+                            Player is currently in.
+      \param[in]  isAdmin   Specifies whether the player has admin permissions.
+
+      \return Returns the closest alias, or an empty string if there is no
+              alias close enough to suggest.
+    */
+    static std::string getSuggestion(
+        const ParseResult &result,
+        const LexicalData &player,
+        const LexicalData &area,
+        bool isAdmin
+                         );
 };
 
 }}
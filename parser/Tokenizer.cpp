@@ -1,78 +1,119 @@
 /*!
   \file     Tokenizer.cpp
-  \author   David Rigert
+  \author   David Rigert
   \created  02/12/2017
-  \modified 02/14/2017
-  \course   CS467, Winter 2017
- 
-  \details  This file contains the implementation of the Tokenizer class.
+  \modified 10/19/2026
+  \course   CS467, Winter 2017
+ 
+  \details  This file contains the implementation of the Tokenizer class.
 */
 #include "Tokenizer.hpp"
 
 #include "WordManager.hpp"
 
-#include <algorithm>
-#include <string.h>
-#include <sstream>
-#include <iostream>
+#include <cctype>
+
+namespace {
+
+// Helper function for checking whether a range is valid for the token list.
+bool isValidRange(const std::vector<legacymud::parser::Token> &tokens, legacymud::parser::Range range) {
+    return range.start < range.end          // start is before end
+        && range.start < tokens.size()      // start is within vector size
+        && range.end <= tokens.size();      // end is within vector size
+}
+
+}
 
 namespace legacymud { namespace parser { 
 
 std::vector<Token> Tokenizer::tokenizeInput(std::string input) {
-    std::istringstream iss(input);
     std::vector<Token> tokens;
-    std::string token;
-    while (iss >> token) {
-        Token t;
-        t.original = token;
-        t.normalized.resize(t.original.size());
-        std::transform(t.original.begin(), t.original.end(), t.normalized.begin(), ::tolower);
-        tokens.push_back(t);
-    }
+    tokenizeInput(input, tokens);
 
     return tokens;
 }
 
+void Tokenizer::tokenizeInput(const std::string &input, std::vector<Token> &tokens) {
+    size_t count = 0;
+    size_t pos = 0;
+    const size_t length = input.size();
+
+    while (pos < length) {
+        // Skip whitespace before the next word
+        while (pos < length && std::isspace(static_cast<unsigned char>(input[pos]))) {
+            ++pos;
+        }
+        if (pos == length)
+            break;
+
+        // Find the end of the word
+        size_t start = pos;
+        while (pos < length && !std::isspace(static_cast<unsigned char>(input[pos]))) {
+            ++pos;
+        }
+
+        // Overwrite a token left from the last call if there is one
+        if (count == tokens.size()) {
+            tokens.emplace_back();
+        }
+        Token &t = tokens[count++];
+        t.original.assign(input, start, pos - start);
+        t.normalized.assign(t.original);
+        for (size_t i = 0; i < t.normalized.size(); ++i) {
+            t.normalized[i] = static_cast<char>(std::tolower(static_cast<unsigned char>(t.normalized[i])));
+        }
+        // Look up the word once here so matching can compare symbols
+        t.symbol = SymbolTable::find(t.normalized);
+    }
+
+    tokens.resize(count);
+}
+
 std::string Tokenizer::joinNormalized(const std::vector<Token> &tokens, Range range, bool skipIgnoreWords) {
+    std::string result;
+    joinNormalized(tokens, range, skipIgnoreWords, result);
+
+    return result;
+}
+
+void Tokenizer::joinNormalized(const std::vector<Token> &tokens, Range range, bool skipIgnoreWords, std::string &out) {
+    out.clear();
     // Immediately return if invalid arguments
-    if (range.start < 0       // start is negative
-        || range.start >= range.end // start is at or after end
-        || range.start >= tokens.size() // start is larger than vector size
-        || range.end > tokens.size())   // end is larger than vector size
-        return std::string();
+    if (!isValidRange(tokens, range))
+        return;
     
-    std::ostringstream oss;
     // Append space-delimited tokens depending on skipIgnoreWords setting
     for (size_t i = range.start; i < range.end; ++i) {
-        if (!(skipIgnoreWords && WordManager::isIgnoreWord(tokens[i].normalized))) {
-            if (!oss.str().empty()) {
-                oss << " ";
+        if (!(skipIgnoreWords && WordManager::isIgnoreSymbol(tokens[i].symbol))) {
+            if (!out.empty()) {
+                out += ' ';
             }
-            oss << tokens[i].normalized;
+            out += tokens[i].normalized;
         }
     }
-
-    return oss.str();
 }
 
 std::string Tokenizer::joinOriginal(const std::vector<Token> &tokens, Range range) {
+    std::string result;
+    joinOriginal(tokens, range, result);
+
+    return result;
+}
+
+void Tokenizer::joinOriginal(const std::vector<Token> &tokens, Range range, std::string &out) {
+    out.clear();
     // Immediately return if invalid arguments
-    if (range.start < 0       // start is negative
-        || range.start >= range.end // start is at or after end
-        || range.start >= tokens.size() // start is larger than vector size
-        || range.end > tokens.size())   // end is larger than vector size
-        return std::string();
+    if (!isValidRange(tokens, range))
+        return;
     
-    std::ostringstream oss;
-    size_t i = range.start;
     // Append first token
-    oss << tokens[i].original;
+    size_t i = range.start;
+    out += tokens[i].original;
     // Append remaining tokens separated by space
     for (++i; i < range.end; ++i) {
-        oss << " " << tokens[i].original;
+        out += ' ';
+        out += tokens[i].original;
     }
-
-    return oss.str();
 }
 
 
@@ -2,7 +2,7 @@
   \file     Tokenizer.hpp
   \author   David Rigert
   \created  02/12/2017
-  \modified 02/12/2017
+  \modified 10/19/2026
   \course   CS467, Winter 2017
  
   \details  This file contains the declaration for the Tokenizer class.
@@ -13,6 +13,8 @@
 #ifndef LEGACYMUD_PARSER_TOKENIZER_HPP
 #define LEGACYMUD_PARSER_TOKENIZER_HPP
 
+#include "SymbolTable.hpp"
+
 #include <string>
 #include <vector>
 
@@ -40,10 +42,15 @@ struct Range {
 
   This struct contains the original and normalized text of a particular token
   in a token list. The normalized version is always lowercase.
+  Words of up to 15 characters fit in the inline storage of std::string,
+  so tokens of a typical command do not allocate.
+  The symbol is the interned ID of the normalized text, or NO_SYMBOL if the
+  word is not used by any alias or ignore word.
 */
 struct Token {
     std::string original;
     std::string normalized;
+    Symbol symbol;
 };
 
 /*!
@@ -65,6 +72,19 @@ public:
     */
     static std::vector<Token> tokenizeInput(std::string input);
 
+    /*!
+      \brief Converts the specified \a input into a token list, reusing \a tokens.
+
+      This function scans \a input in place and overwrites the tokens already
+      in \a tokens before appending new ones, so a vector that is reused for
+      every command keeps its capacity and the capacity of its strings.
+
+      \param[in]  input   Specifies the input to convert.
+      \param[out] tokens  Set to the Token objects in the order of appearance
+                          in \a input.
+    */
+    static void tokenizeInput(const std::string &input, std::vector<Token> &tokens);
+
     /*!
       \brief Converts the specified \a range in \a tokens to a normalized string.
 
@@ -80,6 +100,20 @@ public:
     */
     static std::string joinNormalized(const std::vector<Token> &tokens, Range range, bool skipIgnoreWords);
 
+    /*!
+      \brief Converts the specified \a range in \a tokens to a normalized string.
+
+      This function is the same as the other joinNormalized() overload, but
+      writes the result into \a out so the caller can reuse its buffer.
+
+      \param[in]  tokens           Specifies the list containing the tokens to convert.
+      \param[in]  range            Specifies the range in \a tokens to convert and join.
+      \param[in]  skipIgnoreWords  Specifies whether to omit ignore words from the result.
+      \param[out] out              Set to the joined string, or an empty string if 
+                                   \a range is invalid.
+    */
+    static void joinNormalized(const std::vector<Token> &tokens, Range range, bool skipIgnoreWords, std::string &out);
+
     /*!
       \brief Converts the specified \a range in \a tokens to a string with the original case.
 
@@ -94,6 +128,19 @@ public:
     */
     static std::string joinOriginal(const std::vector<Token> &tokens, Range range);
 
+    /*!
+      \brief Converts the specified \a range in \a tokens to a string with the original case.
+
+      This function is the same as the other joinOriginal() overload, but
+      writes the result into \a out so the caller can reuse its buffer.
+
+      \param[in]  tokens   Specifies the list containing the tokens to convert.
+      \param[in]  range    Specifies the range in \a tokens to convert and join.
+      \param[out] out      Set to the joined string, or an empty string if 
+                           \a range is invalid.
+    */
+    static void joinOriginal(const std::vector<Token> &tokens, Range range, std::string &out);
+
 private:
     // Make this private to prevent this class from being instantiated.
     Tokenizer() {}
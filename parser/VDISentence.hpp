@@ -2,7 +2,7 @@
   \file     VDISentence.hpp
   \author   David Rigert
   \created  02/12/2017
-  \modified 02/15/2017
+  \modified 10/19/2026
   \course   CS467, Winter 2017
  
   \details  This file contains the declarations for the VDISentence class.
@@ -34,32 +34,27 @@ public:
       \param[in] playerLex  Specifies the lexical data for objects in the player inventory.
       \param[in] areaLex    Specifies the lexical data for objects in the current area.
       \param[in] grammar    Specifies the grammar rules for the verb being processed.
+      \param[in] verb       Specifies the PartOfSpeech object used to find the verb alias.
+      \param[in] type       Specifies the type of verb (e.g. edit mode, builder, global, local, etc.)
+      \param[in] command    Specifies the command that the verb maps to.
     */
-    virtual ParseResult getResult(const std::vector<Token> &tokens,
-                                  const LexicalData &playerLex,
+    virtual ParseResult getResult(const std::vector<Token> &tokens, 
+                                  const LexicalData &playerLex, 
                                   const LexicalData &areaLex,
-                                  const Grammar &grammar);
+                                  const Grammar &grammar,
+                                  const PartOfSpeech &verb,
+                                  VerbType type,
+                                  engine::CommandEnum command) const;
 
 protected:
     /*!
       \brief Default constructor.
 
-      The default constructor initializes the VDISentence to an unparsed state.
       This constructor cannot be called directly. 
-      Use the Sentence::makeSentence() function to get an instance of 
+      Use the Sentence::getSentence() function to get the shared instance of 
       the appropriate derived class.
     */
-    VDISentence(PartOfSpeech verb, VerbType type, engine::CommandEnum command);
-
-private:
-    engine::CommandEnum _command;
-    VerbType _type;
-    PartOfSpeech _verb;
-    PartOfSpeech _direct;
-    std::vector<engine::InteractiveNoun*> _directObjects;
-    PartOfSpeech _indirect;
-    std::vector<engine::InteractiveNoun*> _indirectObjects;
-    ParseStatus _status;
+    VDISentence() { }
 };
 
 } }
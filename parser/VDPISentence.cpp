@@ -2,7 +2,7 @@
   \file     VDPISentence.cpp
   \author   David Rigert
   \created  02/12/2017
-  \modified 02/19/2017
+  \modified 10/19/2026
   \course   CS467, Winter 2017
  
   \details  This file contains the implementation of the VDPISentence class.
@@ -16,25 +16,26 @@
 
 namespace legacymud { namespace parser {
 
-VDPISentence::VDPISentence(PartOfSpeech verb, VerbType type, engine::CommandEnum command) {
-    _command = command;
-    _verb = verb;
-    _type = type;
-    _status = ParseStatus::UNPARSED;
-}
-
 // Gets a ParseResult object based on the parsed input string.
-ParseResult VDPISentence::getResult(const std::vector<Token> &tokens, const LexicalData &playerLex, const LexicalData &areaLex, const Grammar &grammar) {
-    Range range = Range(_verb.getRange().end, tokens.size());
+ParseResult VDPISentence::getResult(const std::vector<Token> &tokens, const LexicalData &playerLex, const LexicalData &areaLex, const Grammar &grammar, const PartOfSpeech &verb, VerbType type, engine::CommandEnum command) const {
+    // Parts of speech found while parsing this input
+    PartOfSpeech direct;
+    std::vector<engine::InteractiveNoun*> directObjects;
+    PartOfSpeech preposition;
+    PrepositionType prepType = PrepositionType::NONE;
+    PartOfSpeech indirect;
+    std::vector<engine::InteractiveNoun*> indirectObjects;
+
+    Range range = Range(verb.getRange().end, tokens.size());
 
     // Prepare container for result
     ParseResult result;
-    result.type = _type;
-    result.command = _command;
+    result.type = type;
+    result.command = command;
     result.status = ParseStatus::UNPARSED;
 
     // Find match based on VerbType.
-    switch (_type) {
+    switch (type) {
     case VerbType::INVALID:
         result.status = ParseStatus::INVALID_VERB;
         break;
@@ -53,37 +54,37 @@ ParseResult VDPISentence::getResult(const std::vector<Token> &tokens, const Lexi
         else {
             // Find the longest matching noun
             // Find direct object on player
-            if (_direct.findMatch(tokens, range, &LexicalData::forwardHasNoun, &playerLex)) {
-                auto player = playerLex.getObjectsByNoun(_direct.getAlias());
-                _directObjects.insert(_directObjects.end(), player.begin(), player.end());
-                result.directAlias = _direct.getAlias();
+            if (direct.findMatch(tokens, range, &LexicalData::forwardFindLongestNoun, &playerLex)) {
+                auto player = playerLex.getObjectsByNoun(direct.getAlias());
+                directObjects.insert(directObjects.end(), player.begin(), player.end());
+                result.directAlias = direct.getAlias();
             }
             // Find direct object in area
-            if (_direct.findMatch(tokens, range, &LexicalData::forwardHasNoun, &areaLex)) {
-                auto area = areaLex.getObjectsByNoun(_direct.getAlias());
-                _directObjects.insert(_directObjects.end(), area.begin(), area.end());
-                result.directAlias = _direct.getAlias();
+            if (direct.findMatch(tokens, range, &LexicalData::forwardFindLongestNoun, &areaLex)) {
+                auto area = areaLex.getObjectsByNoun(direct.getAlias());
+                directObjects.insert(directObjects.end(), area.begin(), area.end());
+                result.directAlias = direct.getAlias();
             }
 
             // Only search through all local objects if VerbType is BUILDER
             // and no objects were found in current area or player
-            if (_directObjects.empty() && _type == VerbType::BUILDER) {
-                if (_direct.findMatch(tokens, range, WordManager::hasNoun)) {
-                    auto allLocal = WordManager::getLocalNouns(_direct.getAlias());
-                    _directObjects.insert(_directObjects.end(), allLocal.begin(), allLocal.end());
-                    result.directAlias = _direct.getAlias();
+            if (directObjects.empty() && type == VerbType::BUILDER) {
+                if (direct.findMatch(tokens, range, WordManager::findLongestNoun)) {
+                    auto allLocal = WordManager::getLocalNouns(direct.getAlias());
+                    directObjects.insert(directObjects.end(), allLocal.begin(), allLocal.end());
+                    result.directAlias = direct.getAlias();
                 }
             }
 
             // See if we found any results
-            if (_directObjects.size() > 0) {
+            if (directObjects.size() > 0) {
                 // Results found--configure indirect noun in result object
-                result.direct = _directObjects;
+                result.direct = directObjects;
             }
             else {
                 // No results found--check all local nouns to see if invalid or unavailable
                 Range unavailRange = range;
-                if (_direct.findMatch(tokens, unavailRange, WordManager::hasNoun)) {
+                if (direct.findMatch(tokens, unavailRange, WordManager::findLongestNoun)) {
                     result.status = ParseStatus::UNAVAILABLE_DIRECT;
                 }
                 else {
@@ -102,14 +103,14 @@ ParseResult VDPISentence::getResult(const std::vector<Token> &tokens, const Lexi
             }
             else if (result.status == ParseStatus::UNPARSED) {
                 // Find the longest matching preposition
-                if (!_preposition.findMatch(tokens, range, &Grammar::forwardHasPreposition, &grammar)) {
+                if (!preposition.findMatch(tokens, range, &Grammar::forwardHasPreposition, &grammar)) {
                     // Preposition not found--invalid
                     result.status = ParseStatus::INVALID_PREPOSITION;
                     result.unparsed = Tokenizer::joinOriginal(tokens, range);
                 }
                 else {
                     // Preposition found--set type
-                    _prepType = grammar.getPrepositionType(_preposition.getAlias());
+                    prepType = grammar.getPrepositionType(preposition.getAlias());
                 }
             }
         }
@@ -124,37 +125,37 @@ ParseResult VDPISentence::getResult(const std::vector<Token> &tokens, const Lexi
             else {
                 // Try to find matching indirect object with remaining tokens
                 // Find indirect object on player
-                if (_indirect.findExactMatch(tokens, range, &LexicalData::forwardHasNoun, &playerLex)) {
-                    auto player = playerLex.getObjectsByNoun(_indirect.getAlias());
-                    _indirectObjects.insert(_indirectObjects.end(), player.begin(), player.end());
-                    result.indirectAlias = _indirect.getAlias();
+                if (indirect.findExactMatch(tokens, range, &LexicalData::forwardHasNoun, &playerLex)) {
+                    auto player = playerLex.getObjectsByNoun(indirect.getAlias());
+                    indirectObjects.insert(indirectObjects.end(), player.begin(), player.end());
+                    result.indirectAlias = indirect.getAlias();
                 }
                 // Find indirect object in area
-                if (_indirect.findExactMatch(tokens, range, &LexicalData::forwardHasNoun, &areaLex)) {
-                    auto area = areaLex.getObjectsByNoun(_indirect.getAlias());
-                    _indirectObjects.insert(_indirectObjects.end(), area.begin(), area.end());
-                    result.indirectAlias = _indirect.getAlias();
+                if (indirect.findExactMatch(tokens, range, &LexicalData::forwardHasNoun, &areaLex)) {
+                    auto area = areaLex.getObjectsByNoun(indirect.getAlias());
+                    indirectObjects.insert(indirectObjects.end(), area.begin(), area.end());
+                    result.indirectAlias = indirect.getAlias();
                 }
 
                 // Only search through all local objects if VerbType is BUILDER
                 // and no objects were found in current area or player
-                if (_indirectObjects.empty() && _type == VerbType::BUILDER) {
-                    if (_indirect.findExactMatch(tokens, range, WordManager::hasNoun)) {
-                        auto allLocal = WordManager::getLocalNouns(_indirect.getAlias());
-                        _indirectObjects.insert(_indirectObjects.end(), allLocal.begin(), allLocal.end());
-                        result.indirectAlias = _indirect.getAlias();
+                if (indirectObjects.empty() && type == VerbType::BUILDER) {
+                    if (indirect.findExactMatch(tokens, range, WordManager::hasNoun)) {
+                        auto allLocal = WordManager::getLocalNouns(indirect.getAlias());
+                        indirectObjects.insert(indirectObjects.end(), allLocal.begin(), allLocal.end());
+                        result.indirectAlias = indirect.getAlias();
                     }
                 }
 
                 // See if we found any results
-                if (_indirectObjects.size() > 0) {
+                if (indirectObjects.size() > 0) {
                     // Results found--configure indirect noun in result object
-                    result.indirect = _indirectObjects;
+                    result.indirect = indirectObjects;
                     result.status = ParseStatus::VALID;
                 }
                 else {
                     // No results found--check all local nouns to see if invalid or unavailable
-                    if (_indirect.findExactMatch(tokens, range, WordManager::hasNoun)) {
+                    if (indirect.findExactMatch(tokens, range, WordManager::hasNoun)) {
                         result.status = ParseStatus::UNAVAILABLE_INDIRECT;
                     }
                     else {
@@ -167,7 +168,7 @@ ParseResult VDPISentence::getResult(const std::vector<Token> &tokens, const Lexi
 
         // Handle preposition
         if (result.status == ParseStatus::VALID) {
-            switch (_prepType) {
+            switch (prepType) {
             case PrepositionType::ON:
                 result.position = engine::ItemPosition::ON;
                 break;
@@ -2,7 +2,7 @@
   \file     VDSentence.cpp
   \author   David Rigert
   \created  02/12/2017
-  \modified 02/21/2017
+  \modified 10/19/2026
   \course   CS467, Winter 2017
  
   \details  This file contains the implementation of the VDSentence class.
@@ -16,25 +16,22 @@
 
 namespace legacymud { namespace parser {
 
-VDSentence::VDSentence(PartOfSpeech verb, VerbType type, engine::CommandEnum command) {
-    _command = command;
-    _verb = verb;
-    _type = type;
-    _status = ParseStatus::UNPARSED;
-}
-
 // Gets a ParseResult object based on the parsed input string.
-ParseResult VDSentence::getResult(const std::vector<Token> &tokens, const LexicalData &playerLex, const LexicalData &areaLex, const Grammar &grammar) {
-    Range range = Range(_verb.getRange().end, tokens.size());
+ParseResult VDSentence::getResult(const std::vector<Token> &tokens, const LexicalData &playerLex, const LexicalData &areaLex, const Grammar &grammar, const PartOfSpeech &verb, VerbType type, engine::CommandEnum command) const {
+    // Parts of speech found while parsing this input
+    PartOfSpeech direct;
+    std::vector<engine::InteractiveNoun*> directObjects;
+
+    Range range = Range(verb.getRange().end, tokens.size());
 
     // Prepare container for result
     ParseResult result;
-    result.type = _type;
-    result.command = _command;
+    result.type = type;
+    result.command = command;
     result.status = ParseStatus::UNPARSED;
 
     // Find match based on VerbType.
-    switch (_type) {
+    switch (type) {
     case VerbType::INVALID:
         result.status = ParseStatus::INVALID_VERB;
         break;
@@ -43,7 +40,7 @@ ParseResult VDSentence::getResult(const std::vector<Token> &tokens, const Lexica
         break;
     case VerbType::LOCAL:
         // Implied GO command requires special code path to use verb as direct object
-        if (_command == engine::CommandEnum::GO && range.start == range.end) {
+        if (command == engine::CommandEnum::GO && range.start == range.end) {
             range.start = 0;
             range.end = tokens.size();
         }
@@ -59,37 +56,37 @@ ParseResult VDSentence::getResult(const std::vector<Token> &tokens, const Lexica
         else {
             // Search for a noun that matches all tokens exactly
             // Find direct object on player
-            if (_direct.findExactMatch(tokens, range, &LexicalData::forwardHasNoun, &playerLex)) {
-                auto player = playerLex.getObjectsByNoun(_direct.getAlias());
-                _directObjects.insert(_directObjects.end(), player.begin(), player.end());
-                result.directAlias = _direct.getAlias();
+            if (direct.findExactMatch(tokens, range, &LexicalData::forwardHasNoun, &playerLex)) {
+                auto player = playerLex.getObjectsByNoun(direct.getAlias());
+                directObjects.insert(directObjects.end(), player.begin(), player.end());
+                result.directAlias = direct.getAlias();
             }
             // Find direct object in area
-            if (_direct.findExactMatch(tokens, range, &LexicalData::forwardHasNoun, &areaLex)) {
-                auto area = areaLex.getObjectsByNoun(_direct.getAlias());
-                _directObjects.insert(_directObjects.end(), area.begin(), area.end());
-                result.directAlias = _direct.getAlias();
+            if (direct.findExactMatch(tokens, range, &LexicalData::forwardHasNoun, &areaLex)) {
+                auto area = areaLex.getObjectsByNoun(direct.getAlias());
+                directObjects.insert(directObjects.end(), area.begin(), area.end());
+                result.directAlias = direct.getAlias();
             }
 
             // Only search through all local objects if VerbType is BUILDER
             // and no objects were found in current area or player
-            if (_directObjects.empty() && _type == VerbType::BUILDER) {
-                if (_direct.findExactMatch(tokens, range, WordManager::hasNoun)) {
-                    auto allLocal = WordManager::getLocalNouns(_direct.getAlias());
-                    _directObjects.insert(_directObjects.end(), allLocal.begin(), allLocal.end());
-                    result.directAlias = _direct.getAlias();
+            if (directObjects.empty() && type == VerbType::BUILDER) {
+                if (direct.findExactMatch(tokens, range, WordManager::hasNoun)) {
+                    auto allLocal = WordManager::getLocalNouns(direct.getAlias());
+                    directObjects.insert(directObjects.end(), allLocal.begin(), allLocal.end());
+                    result.directAlias = direct.getAlias();
                 }
             }
 
             // See if we found any results
-            if (_directObjects.size() > 0) {
+            if (directObjects.size() > 0) {
                 // Results found--configure direct noun in result object
-                result.direct = _directObjects;
+                result.direct = directObjects;
                 result.status = ParseStatus::VALID;
             }
             else {
                 // No results found--check all local nouns to see if invalid or unavailable
-                if (_direct.findMatch(tokens, range, WordManager::hasNoun)) {
+                if (direct.findMatch(tokens, range, WordManager::findLongestNoun)) {
                     result.status = ParseStatus::UNAVAILABLE_DIRECT;
                 }
                 else {
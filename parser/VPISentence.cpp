@@ -2,7 +2,7 @@
   \file     VPISentence.cpp
   \author   David Rigert
   \created  02/12/2017
-  \modified 02/19/2017
+  \modified 10/19/2026
   \course   CS467, Winter 2017
  
   \details  This file contains the implementation of the VPISentence class.
@@ -18,25 +18,24 @@ namespace legacymud { namespace engine {
 
 namespace legacymud { namespace parser {
 
-VPISentence::VPISentence(PartOfSpeech verb, VerbType type, engine::CommandEnum command) {
-    _command = command;
-    _verb = verb;
-    _type = type;
-    _status = ParseStatus::UNPARSED;
-}
-
 // Gets a ParseResult object based on the parsed input string.
-ParseResult VPISentence::getResult(const std::vector<Token> &tokens, const LexicalData &playerLex, const LexicalData &areaLex, const Grammar &grammar) {
-    Range range = Range(_verb.getRange().end, tokens.size());
+ParseResult VPISentence::getResult(const std::vector<Token> &tokens, const LexicalData &playerLex, const LexicalData &areaLex, const Grammar &grammar, const PartOfSpeech &verb, VerbType type, engine::CommandEnum command) const {
+    // Parts of speech found while parsing this input
+    PartOfSpeech preposition;
+    PrepositionType prepType = PrepositionType::NONE;
+    PartOfSpeech indirect;
+    std::vector<engine::InteractiveNoun*> indirectObjects;
+
+    Range range = Range(verb.getRange().end, tokens.size());
 
     // Prepare container for result
     ParseResult result;
-    result.type = _type;
-    result.command = _command;
+    result.type = type;
+    result.command = command;
     result.status = ParseStatus::UNPARSED;
 
     // Find match based on VerbType.
-    switch (_type) {
+    switch (type) {
     case VerbType::INVALID:
         result.status = ParseStatus::INVALID_VERB;
         break;
@@ -54,14 +53,14 @@ ParseResult VPISentence::getResult(const std::vector<Token> &tokens, const Lexic
         }
         else {
             // Find the longest matching preposition
-            if (!_preposition.findMatch(tokens, range, &Grammar::forwardHasPreposition, &grammar)) {
+            if (!preposition.findMatch(tokens, range, &Grammar::forwardHasPreposition, &grammar)) {
                 // Preposition not found--invalid
                 result.status = ParseStatus::INVALID_PREPOSITION;
                 result.unparsed = Tokenizer::joinOriginal(tokens, range);
             }
             else {
                 // Preposition found--set type
-                _prepType = grammar.getPrepositionType(_preposition.getAlias());
+                prepType = grammar.getPrepositionType(preposition.getAlias());
             }
         }
 
@@ -75,37 +74,37 @@ ParseResult VPISentence::getResult(const std::vector<Token> &tokens, const Lexic
             else {
                 // Try to find matching indirect object with remaining tokens
                 // Find indirect object on player
-                if (_indirect.findExactMatch(tokens, range, &LexicalData::forwardHasNoun, &playerLex)) {
-                    auto player = playerLex.getObjectsByNoun(_indirect.getAlias());
-                    _indirectObjects.insert(_indirectObjects.end(), player.begin(), player.end());
-                    result.indirectAlias = _indirect.getAlias();
+                if (indirect.findExactMatch(tokens, range, &LexicalData::forwardHasNoun, &playerLex)) {
+                    auto player = playerLex.getObjectsByNoun(indirect.getAlias());
+                    indirectObjects.insert(indirectObjects.end(), player.begin(), player.end());
+                    result.indirectAlias = indirect.getAlias();
                 }
                 // Find indirect object in area
-                if (_indirect.findExactMatch(tokens, range, &LexicalData::forwardHasNoun, &areaLex)) {
-                    auto area = areaLex.getObjectsByNoun(_indirect.getAlias());
-                    _indirectObjects.insert(_indirectObjects.end(), area.begin(), area.end());
-                    result.indirectAlias = _indirect.getAlias();
+                if (indirect.findExactMatch(tokens, range, &LexicalData::forwardHasNoun, &areaLex)) {
+                    auto area = areaLex.getObjectsByNoun(indirect.getAlias());
+                    indirectObjects.insert(indirectObjects.end(), area.begin(), area.end());
+                    result.indirectAlias = indirect.getAlias();
                 }
 
                 // Only search through all local objects if VerbType is BUILDER
                 // and no objects were found in current area or player
-                if (_indirectObjects.empty() && _type == VerbType::BUILDER) {
-                    if (_indirect.findExactMatch(tokens, range, WordManager::hasNoun)) {
-                        auto allLocal = WordManager::getLocalNouns(_indirect.getAlias());
-                        _indirectObjects.insert(_indirectObjects.end(), allLocal.begin(), allLocal.end());
-                        result.indirectAlias = _indirect.getAlias();
+                if (indirectObjects.empty() && type == VerbType::BUILDER) {
+                    if (indirect.findExactMatch(tokens, range, WordManager::hasNoun)) {
+                        auto allLocal = WordManager::getLocalNouns(indirect.getAlias());
+                        indirectObjects.insert(indirectObjects.end(), allLocal.begin(), allLocal.end());
+                        result.indirectAlias = indirect.getAlias();
                     }
                 }
 
                 // See if we found any results
-                if (_indirectObjects.size() > 0) {
+                if (indirectObjects.size() > 0) {
                     // Results found--configure indirect noun in result object
-                    result.indirect = _indirectObjects;
+                    result.indirect = indirectObjects;
                     result.status = ParseStatus::VALID;
                 }
                 else {
                     // No results found--check all local nouns to see if invalid or unavailable
-                    if (_indirect.findExactMatch(tokens, range, WordManager::hasNoun)) {
+                    if (indirect.findExactMatch(tokens, range, WordManager::hasNoun)) {
                         result.status = ParseStatus::UNAVAILABLE_INDIRECT;
                     }
                     else {
@@ -118,7 +117,7 @@ ParseResult VPISentence::getResult(const std::vector<Token> &tokens, const Lexic
 
         // Handle preposition
         if (result.status == ParseStatus::VALID) {
-            switch (_prepType) {
+            switch (prepType) {
             case PrepositionType::ON:
                 result.position = engine::ItemPosition::ON;
                 break;
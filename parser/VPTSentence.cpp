@@ -2,7 +2,7 @@
   \file     VPTSentence.cpp
   \author   David Rigert
   \created  02/12/2017
-  \modified 02/19/2017
+  \modified 10/19/2026
   \course   CS467, Winter 2017
  
   \details  This file contains the implementation of the VPTSentence class.
@@ -14,25 +14,23 @@
 
 namespace legacymud { namespace parser {
 
-VPTSentence::VPTSentence(PartOfSpeech verb, VerbType type, engine::CommandEnum command) {
-    _command = command;
-    _verb = verb;
-    _type = type;
-    _status = ParseStatus::UNPARSED;
-}
-
 // Gets a ParseResult object based on the parsed input string.
-ParseResult VPTSentence::getResult(const std::vector<Token> &tokens, const LexicalData &playerLex, const LexicalData &areaLex, const Grammar &grammar) {
-    Range range = Range(_verb.getRange().end, tokens.size());
+ParseResult VPTSentence::getResult(const std::vector<Token> &tokens, const LexicalData &playerLex, const LexicalData &areaLex, const Grammar &grammar, const PartOfSpeech &verb, VerbType type, engine::CommandEnum command) const {
+    // Parts of speech found while parsing this input
+    PartOfSpeech preposition;
+    PrepositionType prepType = PrepositionType::NONE;
+    PartOfSpeech indirect;
+
+    Range range = Range(verb.getRange().end, tokens.size());
 
     // Prepare container for result
     ParseResult result;
-    result.type = _type;
-    result.command = _command;
+    result.type = type;
+    result.command = command;
     result.status = ParseStatus::UNPARSED;
 
     // Find match based on VerbType.
-    switch (_type) {
+    switch (type) {
     case VerbType::INVALID:
         result.status = ParseStatus::INVALID_VERB;
         break;
@@ -50,7 +48,7 @@ ParseResult VPTSentence::getResult(const std::vector<Token> &tokens, const Lexic
         }
         else {
             // Try to find preposition match based on grammar
-            if (!_preposition.findMatch(tokens, range, &Grammar::forwardHasPreposition, &grammar)) {
+            if (!preposition.findMatch(tokens, range, &Grammar::forwardHasPreposition, &grammar)) {
                 // Preposition not found--invalid
                 result.status = ParseStatus::INVALID_PREPOSITION;
                 // Add remaining text to unparsed
@@ -58,7 +56,7 @@ ParseResult VPTSentence::getResult(const std::vector<Token> &tokens, const Lexic
             }
             else {
                 // Preposition found--set type
-                _prepType = grammar.getPrepositionType(_preposition.getAlias());
+                prepType = grammar.getPrepositionType(preposition.getAlias());
                 // Start from next token until end of token list
                 range = Range(range.end, tokens.size());
                 // Check for leftover tokens
@@ -72,7 +70,7 @@ ParseResult VPTSentence::getResult(const std::vector<Token> &tokens, const Lexic
                     result.status = ParseStatus::VALID;
 
                     // Handle preposition
-                    switch (_prepType) {
+                    switch (prepType) {
                     case PrepositionType::ON:
                         result.position = engine::ItemPosition::ON;
                         break;
@@ -2,7 +2,7 @@
   \file     VTISentence.cpp
   \author   David Rigert
   \created  02/12/2017
-  \modified 02/19/2017
+  \modified 10/19/2026
   \course   CS467, Winter 2017
  
   \details  This file contains the implementation of the VTISentence class.
@@ -14,26 +14,24 @@
 
 namespace legacymud { namespace parser {
 
-VTISentence::VTISentence(PartOfSpeech verb, VerbType type, engine::CommandEnum command) {
-    _command = command;
-    _verb = verb;
-    _type = type;
-    _status = ParseStatus::UNPARSED;
-}
-
 // Gets a ParseResult object based on the parsed input string.
-ParseResult VTISentence::getResult(const std::vector<Token> &tokens, const LexicalData &playerLex, const LexicalData &areaLex, const Grammar &grammar) {
-    Range range = Range(_verb.getRange().end, tokens.size());
+ParseResult VTISentence::getResult(const std::vector<Token> &tokens, const LexicalData &playerLex, const LexicalData &areaLex, const Grammar &grammar, const PartOfSpeech &verb, VerbType type, engine::CommandEnum command) const {
+    // Parts of speech found while parsing this input
+    PartOfSpeech direct;
+    PartOfSpeech indirect;
+    std::vector<engine::InteractiveNoun*> indirectObjects;
+
+    Range range = Range(verb.getRange().end, tokens.size());
 
     // Prepare container for result
     ParseResult result;
-    result.type = _type;
-    result.command = _command;
+    result.type = type;
+    result.command = command;
     result.status = ParseStatus::UNPARSED;
     result.position = engine::ItemPosition::NONE;
 
     // Find match based on VerbType.
-    switch (_type) {
+    switch (type) {
     case VerbType::INVALID:
         result.status = ParseStatus::INVALID_VERB;
         break;
@@ -53,28 +51,28 @@ ParseResult VTISentence::getResult(const std::vector<Token> &tokens, const Lexic
         bool found = false;
         for (; range.start < range.end && !found; ++range.start) {
             // Find indirect object on player
-            if (_indirect.findExactMatch(tokens, range, &LexicalData::forwardHasNoun, &playerLex)) {
+            if (indirect.findExactMatch(tokens, range, &LexicalData::forwardHasNoun, &playerLex)) {
                 found = true;
-                auto player = playerLex.getObjectsByNoun(_indirect.getAlias());
-                _indirectObjects.insert(_indirectObjects.end(), player.begin(), player.end());
-                result.indirectAlias = _indirect.getAlias();
+                auto player = playerLex.getObjectsByNoun(indirect.getAlias());
+                indirectObjects.insert(indirectObjects.end(), player.begin(), player.end());
+                result.indirectAlias = indirect.getAlias();
             }
             // Find indirect object in area
-            if (_indirect.findExactMatch(tokens, range, &LexicalData::forwardHasNoun, &areaLex)) {
+            if (indirect.findExactMatch(tokens, range, &LexicalData::forwardHasNoun, &areaLex)) {
                 found = true;
-                auto area = areaLex.getObjectsByNoun(_indirect.getAlias());
-                _indirectObjects.insert(_indirectObjects.end(), area.begin(), area.end());
-                result.indirectAlias = _indirect.getAlias();
+                auto area = areaLex.getObjectsByNoun(indirect.getAlias());
+                indirectObjects.insert(indirectObjects.end(), area.begin(), area.end());
+                result.indirectAlias = indirect.getAlias();
             }
 
             // Only search through all local objects if VerbType is BUILDER
             // and no objects were found in current area or player
-            if (_indirectObjects.empty() && _type == VerbType::BUILDER) {
-                if (_indirect.findExactMatch(tokens, range, WordManager::hasNoun)) {
+            if (indirectObjects.empty() && type == VerbType::BUILDER) {
+                if (indirect.findExactMatch(tokens, range, WordManager::hasNoun)) {
                     found = true;
-                    auto allLocal = WordManager::getLocalNouns(_indirect.getAlias());
-                    _indirectObjects.insert(_indirectObjects.end(), allLocal.begin(), allLocal.end());
-                    result.indirectAlias = _indirect.getAlias();
+                    auto allLocal = WordManager::getLocalNouns(indirect.getAlias());
+                    indirectObjects.insert(indirectObjects.end(), allLocal.begin(), allLocal.end());
+                    result.indirectAlias = indirect.getAlias();
                 }
             }
 
@@ -86,9 +84,9 @@ ParseResult VTISentence::getResult(const std::vector<Token> &tokens, const Lexic
         // Check if we found any indirect objects
         if (!found) {
             // No results found--check all local nouns to see if invalid or unavailable
-            range = Range(_verb.getRange().end, tokens.size());
+            range = Range(verb.getRange().end, tokens.size());
             for (; range.start < range.end && !found; ++range.start) {
-                if (_indirect.findExactMatch(tokens, range, WordManager::hasNoun)) {
+                if (indirect.findExactMatch(tokens, range, WordManager::hasNoun)) {
                     found = true;
                     result.status = ParseStatus::UNAVAILABLE_INDIRECT;
                 }
@@ -100,7 +98,7 @@ ParseResult VTISentence::getResult(const std::vector<Token> &tokens, const Lexic
 
         // Set all remaining tokens to the direct alias
         if (result.status == ParseStatus::UNPARSED) {
-            range = Range(_verb.getRange().end, indirectRange.start);
+            range = Range(verb.getRange().end, indirectRange.start);
             if (range.start >= range.end) {
                 // No tokens left for direct object--invalid
                 result.status = ParseStatus::INVALID_DIRECT;
@@ -114,10 +112,10 @@ ParseResult VTISentence::getResult(const std::vector<Token> &tokens, const Lexic
         // If we make it here with a status of UNPARSED, then everything was valid
         if (result.status == ParseStatus::UNPARSED) {
             result.status = ParseStatus::VALID;
-            result.indirect = _indirectObjects;
+            result.indirect = indirectObjects;
         }
         else {
-            range = Range(_verb.getRange().end, tokens.size());
+            range = Range(verb.getRange().end, tokens.size());
             result.unparsed = Tokenizer::joinOriginal(tokens, range);
             result.indirectAlias = std::string();
         }
@@ -2,7 +2,7 @@
   \file     VTPISentence.cpp
   \author   David Rigert
   \created  02/12/2017
-  \modified 02/19/2017
+  \modified 10/19/2026
   \course   CS467, Winter 2017
  
   \details  This file contains the implementation of the VTPISentence class.
@@ -16,25 +16,25 @@
 
 namespace legacymud { namespace parser {
 
-VTPISentence::VTPISentence(PartOfSpeech verb, VerbType type, engine::CommandEnum command) {
-    _command = command;
-    _verb = verb;
-    _type = type;
-    _status = ParseStatus::UNPARSED;
-}
-
 // Gets a ParseResult object based on the parsed input string.
-ParseResult VTPISentence::getResult(const std::vector<Token> &tokens, const LexicalData &playerLex, const LexicalData &areaLex, const Grammar &grammar) {
-    Range range = Range(_verb.getRange().end, tokens.size());
+ParseResult VTPISentence::getResult(const std::vector<Token> &tokens, const LexicalData &playerLex, const LexicalData &areaLex, const Grammar &grammar, const PartOfSpeech &verb, VerbType type, engine::CommandEnum command) const {
+    // Parts of speech found while parsing this input
+    PartOfSpeech direct;
+    PartOfSpeech preposition;
+    PrepositionType prepType = PrepositionType::NONE;
+    PartOfSpeech indirect;
+    std::vector<engine::InteractiveNoun*> indirectObjects;
+
+    Range range = Range(verb.getRange().end, tokens.size());
 
     // Prepare container for result
     ParseResult result;
-    result.type = _type;
-    result.command = _command;
+    result.type = type;
+    result.command = command;
     result.status = ParseStatus::UNPARSED;
 
     // Find match based on VerbType.
-    switch (_type) {
+    switch (type) {
     case VerbType::INVALID:
         result.status = ParseStatus::INVALID_VERB;
         break;
@@ -54,28 +54,28 @@ ParseResult VTPISentence::getResult(const std::vector<Token> &tokens, const Lexi
         bool found = false;
         for (; range.start < range.end && !found; ++range.start) {
             // Find indirect object on player
-            if (_indirect.findExactMatch(tokens, range, &LexicalData::forwardHasNoun, &playerLex)) {
+            if (indirect.findExactMatch(tokens, range, &LexicalData::forwardHasNoun, &playerLex)) {
                 found = true;
-                auto player = playerLex.getObjectsByNoun(_indirect.getAlias());
-                _indirectObjects.insert(_indirectObjects.end(), player.begin(), player.end());
-                result.indirectAlias = _indirect.getAlias();
+                auto player = playerLex.getObjectsByNoun(indirect.getAlias());
+                indirectObjects.insert(indirectObjects.end(), player.begin(), player.end());
+                result.indirectAlias = indirect.getAlias();
             }
             // Find indirect object in area
-            if (_indirect.findExactMatch(tokens, range, &LexicalData::forwardHasNoun, &areaLex)) {
+            if (indirect.findExactMatch(tokens, range, &LexicalData::forwardHasNoun, &areaLex)) {
                 found = true;
-                auto area = areaLex.getObjectsByNoun(_indirect.getAlias());
-                _indirectObjects.insert(_indirectObjects.end(), area.begin(), area.end());
-                result.indirectAlias = _indirect.getAlias();
+                auto area = areaLex.getObjectsByNoun(indirect.getAlias());
+                indirectObjects.insert(indirectObjects.end(), area.begin(), area.end());
+                result.indirectAlias = indirect.getAlias();
             }
 
             // Only search through all local objects if VerbType is BUILDER
             // and no objects were found in current area or player
-            if (_indirectObjects.empty() && _type == VerbType::BUILDER) {
-                if (_indirect.findExactMatch(tokens, range, WordManager::hasNoun)) {
+            if (indirectObjects.empty() && type == VerbType::BUILDER) {
+                if (indirect.findExactMatch(tokens, range, WordManager::hasNoun)) {
                     found = true;
-                    auto allLocal = WordManager::getLocalNouns(_indirect.getAlias());
-                    _indirectObjects.insert(_indirectObjects.end(), allLocal.begin(), allLocal.end());
-                    result.indirectAlias = _indirect.getAlias();
+                    auto allLocal = WordManager::getLocalNouns(indirect.getAlias());
+                    indirectObjects.insert(indirectObjects.end(), allLocal.begin(), allLocal.end());
+                    result.indirectAlias = indirect.getAlias();
                 }
             }
 
@@ -87,9 +87,9 @@ ParseResult VTPISentence::getResult(const std::vector<Token> &tokens, const Lexi
         // Check if we found any indirect objects
         if (!found) {
             // No results found--check all local nouns to see if invalid or unavailable
-            range = Range(_verb.getRange().end, tokens.size());
+            range = Range(verb.getRange().end, tokens.size());
             for (; range.start < range.end && !found; ++range.start) {
-                if (_indirect.findExactMatch(tokens, range, WordManager::hasNoun)) {
+                if (indirect.findExactMatch(tokens, range, WordManager::hasNoun)) {
                     found = true;
                     result.status = ParseStatus::UNAVAILABLE_INDIRECT;
                 }
@@ -101,7 +101,7 @@ ParseResult VTPISentence::getResult(const std::vector<Token> &tokens, const Lexi
 
         if (result.status == ParseStatus::UNPARSED) {
             // Set possible preposition range
-            range = Range(_verb.getRange().end, indirectRange.start);
+            range = Range(verb.getRange().end, indirectRange.start);
             // Look for a preposition match
             if (range.start >= range.end) {
                 // Preposition missing--invalid
@@ -110,7 +110,7 @@ ParseResult VTPISentence::getResult(const std::vector<Token> &tokens, const Lexi
             else {
                 // Find the longest matching preposition
                 for (found = false; range.start < range.end && !found; ++range.start) {
-                    if (_preposition.findExactMatch(tokens, range, &Grammar::forwardHasPreposition, &grammar)) {
+                    if (preposition.findExactMatch(tokens, range, &Grammar::forwardHasPreposition, &grammar)) {
                         // Preposition found
                         found = true;
                     }
@@ -124,7 +124,7 @@ ParseResult VTPISentence::getResult(const std::vector<Token> &tokens, const Lexi
 
         if (result.status == ParseStatus::UNPARSED) {
             // Set all remaining tokens to the direct alias
-            range = Range(_verb.getRange().end, _preposition.getRange().start);
+            range = Range(verb.getRange().end, preposition.getRange().start);
             if (range.start >= range.end) {
                 // No tokens left for direct object--invalid
                 result.status = ParseStatus::INVALID_DIRECT;
@@ -138,17 +138,17 @@ ParseResult VTPISentence::getResult(const std::vector<Token> &tokens, const Lexi
         // If we make it here with a status of UNPARSED, then everything was valid
         if (result.status == ParseStatus::UNPARSED) {
             result.status = ParseStatus::VALID;
-            result.indirect = _indirectObjects;
-            _prepType = grammar.getPrepositionType(_preposition.getAlias());
+            result.indirect = indirectObjects;
+            prepType = grammar.getPrepositionType(preposition.getAlias());
         }
         else {
             // Something was not parsed--throw it all into unparsed
-            result.unparsed = Tokenizer::joinOriginal(tokens, Range(_verb.getRange().end, tokens.size()));
+            result.unparsed = Tokenizer::joinOriginal(tokens, Range(verb.getRange().end, tokens.size()));
         }
         
         // Handle preposition
         if (result.status == ParseStatus::VALID) {
-            switch (_prepType) {
+            switch (prepType) {
             case PrepositionType::ON:
                 result.position = engine::ItemPosition::ON;
                 break;
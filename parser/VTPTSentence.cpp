@@ -2,7 +2,7 @@
   \file     VTPTSentence.cpp
   \author   David Rigert
   \created  02/12/2017
-  \modified 02/19/2017
+  \modified 10/19/2026
   \course   CS467, Winter 2017
  
   \details  This file contains the implementation of the VTPTSentence class.
@@ -16,25 +16,24 @@
 
 namespace legacymud { namespace parser {
 
-VTPTSentence::VTPTSentence(PartOfSpeech verb, VerbType type, engine::CommandEnum command) {
-    _command = command;
-    _verb = verb;
-    _type = type;
-    _status = ParseStatus::UNPARSED;
-}
-
 // Gets a ParseResult object based on the parsed input string.
-ParseResult VTPTSentence::getResult(const std::vector<Token> &tokens, const LexicalData &playerLex, const LexicalData &areaLex, const Grammar &grammar) {
-    Range range = Range(_verb.getRange().end, tokens.size());
+ParseResult VTPTSentence::getResult(const std::vector<Token> &tokens, const LexicalData &playerLex, const LexicalData &areaLex, const Grammar &grammar, const PartOfSpeech &verb, VerbType type, engine::CommandEnum command) const {
+    // Parts of speech found while parsing this input
+    PartOfSpeech direct;
+    PartOfSpeech preposition;
+    PrepositionType prepType = PrepositionType::NONE;
+    PartOfSpeech indirect;
+
+    Range range = Range(verb.getRange().end, tokens.size());
 
     // Prepare container for result
     ParseResult result;
-    result.type = _type;
-    result.command = _command;
+    result.type = type;
+    result.command = command;
     result.status = ParseStatus::UNPARSED;
 
     // Find match based on VerbType.
-    switch (_type) {
+    switch (type) {
     case VerbType::INVALID:
         result.status = ParseStatus::INVALID_VERB;
         break;
@@ -60,7 +59,7 @@ ParseResult VTPTSentence::getResult(const std::vector<Token> &tokens, const Lexi
                 for (end = range.end, start = end - spread; (start >= range.start) && !found; --end, --start) {
                     prepRange.start = start;
                     prepRange.end = end;
-                    if (_preposition.findExactMatch(tokens, prepRange, &Grammar::forwardHasPreposition, &grammar)) {
+                    if (preposition.findExactMatch(tokens, prepRange, &Grammar::forwardHasPreposition, &grammar)) {
                         // Preposition found
                         found = true;
                     }
@@ -73,7 +72,7 @@ ParseResult VTPTSentence::getResult(const std::vector<Token> &tokens, const Lexi
             }
             else {
                 // Set the preposition type
-                _prepType = grammar.getPrepositionType(_preposition.getAlias());
+                prepType = grammar.getPrepositionType(preposition.getAlias());
             }
 
             if (result.status == ParseStatus::UNPARSED) {
@@ -101,7 +100,7 @@ ParseResult VTPTSentence::getResult(const std::vector<Token> &tokens, const Lexi
 
             if (result.status == ParseStatus::VALID) {
                 // Handle preposition
-                switch (_prepType) {
+                switch (prepType) {
                 case PrepositionType::ON:
                     result.position = engine::ItemPosition::ON;
                     break;
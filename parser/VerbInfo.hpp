@@ -8,6 +8,8 @@
   \details  This file contains the declaration of the VerbInfo struct.
             The VerbInfo struct is used by the parser to keep track of information
             about a particular definition of a global verb.
+            The VerbDefinition struct is a constant description of a built-in
+            verb that can be stored in a static table.
 */
 #ifndef LEGACYMUD_PARSER_VERBINFO_HPP
 #define LEGACYMUD_PARSER_VERBINFO_HPP
@@ -20,6 +22,30 @@
 
 namespace legacymud { namespace parser {
 
+/*!
+  \brief Specifies a preposition supported by a VerbDefinition.
+*/
+struct PrepositionDefinition {
+    const char *text;             //!< Stores the preposition text, or nullptr to end the list.
+    PrepositionType type;         //!< Stores the meaning of the preposition.
+};
+
+/*!
+  \brief Specifies the constant definition of a built-in verb alias.
+
+  This struct only contains literal types, so tables of built-in verbs can be
+  declared \c constexpr and need no code to run at startup.
+*/
+struct VerbDefinition {
+    const char *alias;            //!< Stores the verb alias.
+    const char *description;      //!< Stores the description of the verb shown in help.
+    engine::CommandEnum command;  //!< Stores the command mapped to the verb.
+    Grammar::Support direct;      //!< Stores whether the verb supports a direct object.
+    bool preposition;             //!< Stores whether the verb supports a preposition.
+    Grammar::Support indirect;    //!< Stores whether the verb supports an indirect object.
+    const PrepositionDefinition *prepositions; //!< Stores a list of prepositions ending with a null \a text, or nullptr if there are none.
+};
+
 /*! 
   \brief Specifies the struct used to store verb information.
 */
@@ -32,6 +58,15 @@ struct VerbInfo {
       grammar = Grammar(Grammar::Support::NO, false, Grammar::Support::NO);
       command = engine::CommandEnum::INVALID;
     }
+
+    explicit VerbInfo(const VerbDefinition &definition)
+        : grammar(definition.direct, definition.preposition, definition.indirect),
+          command(definition.command),
+          description(definition.description) {
+      for (const PrepositionDefinition *prep = definition.prepositions; prep != nullptr && prep->text != nullptr; ++prep) {
+          grammar.addPreposition(prep->text, prep->type);
+      }
+    }
 };
 
 }}
@@ -0,0 +1,109 @@
+/*!
+  \file     VerbTable.cpp
+  \author   agent
+  \created  10/19/2026
+  \modified 10/19/2026
+
+  \details  This file contains the implementation of the VerbTable class.
+*/
+
+#include "VerbTable.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cctype>
+
+namespace legacymud { namespace parser {
+
+void VerbTable::add(std::string alias, const VerbInfo &info) {
+    insert(std::move(alias), info);
+    rebuild();
+}
+
+void VerbTable::add(const VerbDefinition *definitions, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        insert(definitions[i].alias, VerbInfo(definitions[i]));
+    }
+    rebuild();
+}
+
+bool VerbTable::has(Symbol symbol) const {
+    if (symbol == NO_SYMBOL || _slots.empty())
+        return false;
+
+    return _slots[symbol % _slots.size()].symbol == symbol;
+}
+
+VerbSpan VerbTable::find(Symbol symbol, std::shared_ptr<const void> owner) const {
+    if (!has(symbol))
+        return VerbSpan();
+
+    const Slot &slot = _slots[symbol % _slots.size()];
+    return VerbSpan(std::move(owner), &_verbs[slot.first], slot.count);
+}
+
+size_t VerbTable::findLongest(const std::vector<Token> &tokens, const Range &range, bool &skipIgnoreWords) const {
+    return _trie.findLongest(tokens, range, skipIgnoreWords);
+}
+
+void VerbTable::findSimilar(const std::string &word, size_t maxDistance, std::vector<WordMatch> &matches) const {
+    _similar.find(word, maxDistance, matches);
+}
+
+void VerbTable::insert(std::string alias, const VerbInfo &info) {
+    // Precondition: verify non-empty string
+    assert(!alias.empty());
+
+    // Convert string to lowercase
+    std::transform(alias.begin(), alias.end(), alias.begin(), ::tolower);
+    Symbol symbol = SymbolTable::intern(alias);
+
+    // Keep all definitions of an alias together, in the order they were added
+    auto last = std::find(_symbols.rbegin(), _symbols.rend(), symbol);
+    if (last == _symbols.rend()) {
+        _trie.insert(alias);
+        _similar.insert(alias);
+        _symbols.push_back(symbol);
+        _verbs.push_back(info);
+    }
+    else {
+        size_t index = _symbols.rend() - last;
+        _symbols.insert(_symbols.begin() + index, symbol);
+        _verbs.insert(_verbs.begin() + index, info);
+    }
+}
+
+void VerbTable::rebuild() {
+    std::vector<Slot> groups;
+    Symbol maxSymbol = NO_SYMBOL;
+    for (size_t i = 0; i < _symbols.size(); ++i) {
+        if (groups.empty() || groups.back().symbol != _symbols[i]) {
+            Slot slot = { _symbols[i], i, 0 };
+            groups.push_back(slot);
+            maxSymbol = std::max(maxSymbol, _symbols[i]);
+        }
+        ++groups.back().count;
+    }
+
+    // Find the smallest table size without collisions. Symbols are unique,
+    // so a table with one slot per possible symbol always works.
+    Slot empty = { NO_SYMBOL, 0, 0 };
+    _slots.clear();
+    for (size_t size = groups.size(); size <= static_cast<size_t>(maxSymbol) + 1 && !groups.empty(); ++size) {
+        _slots.assign(size, empty);
+        bool collision = false;
+        for (auto it = groups.begin(); it != groups.end() && !collision; ++it) {
+            Slot &slot = _slots[it->symbol % size];
+            if (slot.symbol != NO_SYMBOL) {
+                collision = true;
+            }
+            else {
+                slot = *it;
+            }
+        }
+        if (!collision)
+            return;
+    }
+}
+
+} }
@@ -0,0 +1,165 @@
+/*!
+  \file     VerbTable.hpp
+  \author   agent
+  \created  10/19/2026
+  \modified 10/19/2026
+
+  \details  This file contains the declarations for the VerbTable and
+            VerbSpan classes.
+            The VerbTable class stores the definitions of edit mode, world
+            builder, or global verbs. The VerbSpan class is a read-only view
+            of the definitions of one verb alias.
+*/
+#ifndef LEGACYMUD_PARSER_VERBTABLE_HPP
+#define LEGACYMUD_PARSER_VERBTABLE_HPP
+
+#include "BKTree.hpp"
+#include "SymbolTable.hpp"
+#include "VerbInfo.hpp"
+#include "WordTrie.hpp"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace legacymud { namespace parser {
+
+/*!
+  \brief Represents a read-only view of the VerbInfo objects of a verb alias.
+
+  A VerbSpan points directly into the storage of a VerbTable, so getting the
+  definitions of a verb does not copy any Grammar objects. The span keeps the
+  table that owns the storage alive, so it stays valid even if a newer
+  table replaces it.
+*/
+class VerbSpan {
+public:
+    typedef const VerbInfo *const_iterator;
+
+    /*!
+      \brief Default constructor. Creates an empty span.
+    */
+    VerbSpan() : _first(nullptr), _count(0) {}
+
+    /*!
+      \brief Creates a span of \a count VerbInfo objects starting at \a first.
+
+      \param[in]  owner   Specifies the object that owns the VerbInfo objects.
+      \param[in]  first   Specifies the first VerbInfo in the span.
+      \param[in]  count   Specifies the number of VerbInfo objects in the span.
+    */
+    VerbSpan(std::shared_ptr<const void> owner, const VerbInfo *first, size_t count)
+        : _owner(std::move(owner)), _first(first), _count(count) {}
+
+    const_iterator begin() const { return _first; }
+    const_iterator end() const { return _first + _count; }
+    size_t size() const { return _count; }
+    bool empty() const { return _count == 0; }
+    const VerbInfo &operator[](size_t index) const { return _first[index]; }
+
+private:
+    std::shared_ptr<const void> _owner;
+    const VerbInfo *_first;
+    size_t _count;
+};
+
+/*!
+  \brief Stores the definitions of a set of verbs, keyed by alias symbol.
+
+  All definitions of an alias are stored next to each other in the order
+  they were added. Aliases are found with a perfect hash: the slot of an
+  alias is its symbol modulo the table size, and the table size is chosen
+  when the table changes so that no two aliases share a slot. A lookup is
+  one division and one comparison.
+
+  This class does not do any locking. WordManager only changes copies of a
+  table that are not yet visible to other threads.
+*/
+class VerbTable {
+public:
+    /*!
+      \brief Adds a definition of a verb alias to the table.
+
+      \param[in]  alias   Specifies the verb alias. It is converted to lowercase.
+      \param[in]  info    Specifies the definition of the verb.
+
+      \pre \a alias is a valid, non-empty string.
+    */
+    void add(std::string alias, const VerbInfo &info);
+
+    /*!
+      \brief Adds a list of verb definitions to the table.
+
+      The hash is rebuilt once after all definitions are added.
+
+      \param[in]  definitions Specifies the first definition to add.
+      \param[in]  count       Specifies the number of definitions to add.
+    */
+    void add(const VerbDefinition *definitions, size_t count);
+
+    /*!
+      \brief Gets whether the table has an alias with the specified symbol.
+
+      \param[in]  symbol  Specifies the symbol of the alias.
+
+      \return Returns whether the alias is in the table.
+    */
+    bool has(Symbol symbol) const;
+
+    /*!
+      \brief Gets the definitions of the alias with the specified symbol.
+
+      \param[in]  symbol  Specifies the symbol of the alias.
+      \param[in]  owner   Specifies the object that owns this table. The
+                          returned span keeps it alive.
+
+      \return Returns a span of the definitions, or an empty span if the
+              alias is not in the table.
+    */
+    VerbSpan find(Symbol symbol, std::shared_ptr<const void> owner) const;
+
+    /*!
+      \brief Finds the longest alias at the start of a token range.
+
+      \param[in]  tokens          Specifies the tokenized input text.
+      \param[in]  range           Specifies the range of tokens to check.
+      \param[out] skipIgnoreWords Set to whether the alias only matched after
+                                  omitting ignore words.
+
+      \return Returns the end of the longest matching range, or
+              \a range.start if there is no match.
+    */
+    size_t findLongest(const std::vector<Token> &tokens, const Range &range, bool &skipIgnoreWords) const;
+
+    /*!
+      \brief Finds the aliases that are similar to a misspelled word.
+
+      \param[in]  word        Specifies the lowercase word to compare against.
+      \param[in]  maxDistance Specifies the largest edit distance to include.
+      \param[out] matches     Receives the similar aliases and their distances.
+    */
+    void findSimilar(const std::string &word, size_t maxDistance, std::vector<WordMatch> &matches) const;
+
+private:
+    struct Slot {
+        Symbol symbol;
+        size_t first;
+        size_t count;
+    };
+
+    // Adds a definition without rebuilding the hash.
+    void insert(std::string alias, const VerbInfo &info);
+
+    // Rebuilds the slot table after definitions are added.
+    void rebuild();
+
+    std::vector<Symbol> _symbols;
+    std::vector<VerbInfo> _verbs;
+    std::vector<Slot> _slots;
+    WordTrie _trie;
+    BKTree _similar;
+};
+
+} }
+#endif
@@ -2,7 +2,7 @@
   \file     WordManager.cpp
   \author   David Rigert
   \created  01/29/2017
-  \modified 02/18/2017
+  \modified 10/19/2026
   \course   CS467, Winter 2017
  
   \details This file contains the implementation code for the WordManager class.
@@ -13,7 +13,9 @@
 #include <InteractiveNoun.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
+#include <memory>
 #include <mutex>
 
 #include <cassert>
@@ -21,55 +23,38 @@
 
 namespace {
 
-// Mutex for global verbs
-std::mutex globalVerbLock;
+// Serializes writers of the verb tables. Readers do not take this lock.
+std::mutex verbTablesWriteLock;
 
-// Mutex for builder verbs
-std::mutex builderVerbLock;
+// Version number of the verb tables and ignore words
+std::atomic<unsigned long> verbVersion(0);
 
-// Mutex for edit mode verbs
-std::mutex editModeVerbLock;
+// Version number of the in-use noun and verb alias lookup tables
+std::atomic<unsigned long> localVersion(0);
 
-// Mutex for local nouns
-std::mutex localNounsLock;
-
-// Mutex for local verbs
-std::mutex localVerbsLock;
-
-// Mutex for ignore words
-std::mutex ignoreWordLock;
-
-
-// Helper function for adding an alias and VerbInfo pair to a GlobalVerbMap.
-void addToMap(legacymud::parser::GlobalVerbMap &verbMap, std::string alias, legacymud::parser::VerbInfo info) {
-    // Convert string to lowercase
-    std::transform(alias.begin(), alias.end(), alias.begin(), ::tolower);
-
-    // Add the alias-VerbInfo pair to the lookup table.
-    verbMap.emplace(alias, info);
-}
+// Number of lookups in the in-use tables made by each thread
+thread_local unsigned long localLookups = 0;
 
 }
 
 namespace legacymud { namespace parser {
 
 // Static initialization
-GlobalVerbMap WordManager::_editModeVerbs;
-GlobalVerbMap WordManager::_globalVerbs;
-GlobalVerbMap WordManager::_builderVerbs;
-WordMap WordManager::_localVerbs;
-WordMap WordManager::_localNouns;
-std::set<std::string> WordManager::_ignoreWords;
+std::shared_ptr<const WordManager::VerbTables> WordManager::_verbTables = std::make_shared<WordManager::VerbTables>();
+ShardedWordMap WordManager::_localVerbs;
+ShardedWordMap WordManager::_localNouns;
 
 // Adds an entry to the list of global verbs.
 void WordManager::addGlobalVerb(std::string alias, VerbInfo info) {
     // Precondition: verify non-empty string
     assert(!alias.empty());
 
-    // Block any other threads from accessing _globalVerbs until operation is complete.
-    std::lock_guard<std::mutex> guard(globalVerbLock);
-
-    addToMap(_globalVerbs, alias, info);
+    // Block other writers until the new snapshot is published.
+    std::lock_guard<std::mutex> guard(verbTablesWriteLock);
+    std::shared_ptr<VerbTables> tables = std::make_shared<VerbTables>(*loadVerbTables());
+    tables->globalVerbs.add(alias, info);
+    storeVerbTables(tables);
+    ++verbVersion;
 }
 
 // Adds an entry to the list of world builder verbs.
@@ -77,10 +62,12 @@ void WordManager::addBuilderVerb(std::string alias, VerbInfo info) {
     // Precondition: verify non-empty string
     assert(!alias.empty());
 
-    // Block any other threads from accessing _builderVerbs until operation is complete.
-    std::lock_guard<std::mutex> guard(builderVerbLock);
-
-    addToMap(_builderVerbs, alias, info);
+    // Block other writers until the new snapshot is published.
+    std::lock_guard<std::mutex> guard(verbTablesWriteLock);
+    std::shared_ptr<VerbTables> tables = std::make_shared<VerbTables>(*loadVerbTables());
+    tables->builderVerbs.add(alias, info);
+    storeVerbTables(tables);
+    ++verbVersion;
 }
 
 // Adds an entry to the list of edit mode verbs.
@@ -88,10 +75,27 @@ void WordManager::addEditModeVerb(std::string alias, VerbInfo info) {
     // Precondition: verify non-empty string
     assert(!alias.empty());
 
-    // Block any other threads from accessing _editModeVerbs until operation is complete.
-    std::lock_guard<std::mutex> guard(editModeVerbLock);
+    // Block other writers until the new snapshot is published.
+    std::lock_guard<std::mutex> guard(verbTablesWriteLock);
+    std::shared_ptr<VerbTables> tables = std::make_shared<VerbTables>(*loadVerbTables());
+    tables->editModeVerbs.add(alias, info);
+    storeVerbTables(tables);
+    ++verbVersion;
+}
+
+// Adds a table of definitions to the list of edit mode verbs.
+void WordManager::addEditModeVerbs(const VerbDefinition *definitions, size_t count) {
+    addVerbs(&VerbTables::editModeVerbs, definitions, count);
+}
+
+// Adds a table of definitions to the list of global verbs.
+void WordManager::addGlobalVerbs(const VerbDefinition *definitions, size_t count) {
+    addVerbs(&VerbTables::globalVerbs, definitions, count);
+}
 
-    addToMap(_editModeVerbs, alias, info);
+// Adds a table of definitions to the list of world builder verbs.
+void WordManager::addBuilderVerbs(const VerbDefinition *definitions, size_t count) {
+    addVerbs(&VerbTables::builderVerbs, definitions, count);
 }
 
 // Adds an entry to the in-use noun alias lookup table.
@@ -101,13 +105,11 @@ void WordManager::addNoun(std::string alias, engine::InteractiveNoun *pObj) {
     // Precondition: verify non-null pointer
     assert(pObj != nullptr);
 
-    // Block any other threads from accessing _localNouns until operation is complete.
-    std::lock_guard<std::mutex> guard(localNounsLock);
-
-    // Add pair to WordMap
+    // Add pair to WordMap. Only the shard of the alias is locked.
     if (!_localNouns.addWord(alias, pObj)) {
         std::cerr << "Attempted to add duplicate noun alias '" << alias << "' to object ID " << pObj->getID() << std::endl;
     }
+    ++localVersion;
 }
 
 // Adds an entry to the in-use verb alias lookup table.
@@ -117,13 +119,11 @@ void WordManager::addVerb(std::string alias, engine::InteractiveNoun *pObj) {
     // Precondition: verify non-null pointer
     assert(pObj != nullptr);
 
-    // Block any other threads from accessing _localVerbs until operation is complete.
-    std::lock_guard<std::mutex> guard(localVerbsLock);
-
-    // Add pair to WordMap
+    // Add pair to WordMap. Only the shard of the alias is locked.
     if (!_localVerbs.addWord(alias, pObj)) {
         std::cerr << "Attempted to add duplicate verb alias '" << alias << "' to object ID " << pObj->getID() << std::endl;
     }
+    ++localVersion;
 }
 
 // Adds a word to the ignore list
@@ -134,75 +134,57 @@ void WordManager::addIgnoreWord(std::string word) {
     // Convert string to lowercase
     std::transform(word.begin(), word.end(), word.begin(), ::tolower);
 
-    // Block any other threads from accessing _ignoreWords until operation is complete.
-    std::lock_guard<std::mutex> guard(ignoreWordLock);
-
-    _ignoreWords.insert(word);
+    // Block other writers until the new snapshot is published.
+    std::lock_guard<std::mutex> guard(verbTablesWriteLock);
+    std::shared_ptr<VerbTables> tables = std::make_shared<VerbTables>(*loadVerbTables());
+    tables->ignoreWords.insert(SymbolTable::intern(word));
+    storeVerbTables(tables);
+    ++verbVersion;
 }
 
 // Gets the VerbInfos of the specified edit mode verb.
-std::vector<VerbInfo> WordManager::getEditModeVerbs(std::string alias) {
-    std::lock_guard<std::mutex> guard(editModeVerbLock);
-
-    // Precondition: value must be in map
-    assert(_editModeVerbs.find(alias) != _editModeVerbs.end());
-
-    auto range = _editModeVerbs.equal_range(alias);
-    std::vector<VerbInfo> results;
-    for (auto it = range.first; it != range.second; ++it) {
-        results.push_back(it->second);
-    }
-
-    return results;
+VerbSpan WordManager::getEditModeVerbs(std::string alias) {
+    std::shared_ptr<const VerbTables> tables = loadVerbTables();
+    return getVerbs(tables, tables->editModeVerbs, alias);
 }
 
 // Gets the VerbInfos of the specified global verb.
-std::vector<VerbInfo> WordManager::getGlobalVerbs(std::string alias) {
-    std::lock_guard<std::mutex> guard(globalVerbLock);
-
-    // Precondition: value must be in map
-    assert(_globalVerbs.find(alias) != _globalVerbs.end());
-
-    auto range = _globalVerbs.equal_range(alias);
-    std::vector<VerbInfo> results;
-    for (auto it = range.first; it != range.second; ++it) {
-        results.push_back(it->second);
-    }
-
-    return results;
+VerbSpan WordManager::getGlobalVerbs(std::string alias) {
+    std::shared_ptr<const VerbTables> tables = loadVerbTables();
+    return getVerbs(tables, tables->globalVerbs, alias);
 }
 
 // Gets the VerbInfos of the specified builder verb.
-std::vector<VerbInfo> WordManager::getBuilderVerbs(std::string alias) {
-    std::lock_guard<std::mutex> guard(builderVerbLock);
-
-    // Precondition: value must be in map
-    assert(_builderVerbs.find(alias) != _builderVerbs.end());
-
-    auto range = _builderVerbs.equal_range(alias);
-    std::vector<VerbInfo> results;
-    for (auto it = range.first; it != range.second; ++it) {
-        results.push_back(it->second);
-    }
-
-    return results;
+VerbSpan WordManager::getBuilderVerbs(std::string alias) {
+    std::shared_ptr<const VerbTables> tables = loadVerbTables();
+    return getVerbs(tables, tables->builderVerbs, alias);
 }
 
 // Gets pointers to local InteractiveNoun objects with the specified noun alias
 std::vector<engine::InteractiveNoun *> WordManager::getLocalNouns(std::string alias) {
-    std::lock_guard<std::mutex> guard(localNounsLock);
+    ++localLookups;
     return _localNouns.getObjects(alias);
 }
 
+// Finds the verb aliases within maxDistance edits of the word.
+void WordManager::findSimilarVerbs(const std::string &word, size_t maxDistance, bool isAdmin, std::vector<WordMatch> &matches) {
+    std::shared_ptr<const VerbTables> tables = loadVerbTables();
+    tables->globalVerbs.findSimilar(word, maxDistance, matches);
+    if (isAdmin) {
+        tables->builderVerbs.findSimilar(word, maxDistance, matches);
+        tables->editModeVerbs.findSimilar(word, maxDistance, matches);
+    }
+}
+
 // Gets whether the specified noun is in use.
 bool WordManager::hasNoun(const void *, std::string alias) {
-    std::lock_guard<std::mutex> guard(localNounsLock);
+    ++localLookups;
     return _localNouns.hasWord(alias);
 }
 
 // Gets whether the specified verb is in use.
 bool WordManager::hasVerb(const void *, std::string alias) {
-    std::lock_guard<std::mutex> guard(localVerbsLock);
+    ++localLookups;
     return _localVerbs.hasWord(alias);
 }
 
@@ -210,27 +192,27 @@ bool WordManager::hasVerb(const void *, std::string alias) {
 bool WordManager::hasEditModeVerb(const void *, std::string alias) {
     // Convert string to lowercase
     std::transform(alias.begin(), alias.end(), alias.begin(), ::tolower);
+    Symbol symbol = SymbolTable::find(alias);
 
-    std::lock_guard<std::mutex> guard(editModeVerbLock);
-    return _editModeVerbs.find(alias) != _editModeVerbs.end();
+    return loadVerbTables()->editModeVerbs.has(symbol);
 }
 
 // Gets whether the specified global verb has been added.
 bool WordManager::hasGlobalVerb(const void *, std::string alias) {
     // Convert string to lowercase
     std::transform(alias.begin(), alias.end(), alias.begin(), ::tolower);
+    Symbol symbol = SymbolTable::find(alias);
 
-    std::lock_guard<std::mutex> guard(globalVerbLock);
-    return _globalVerbs.find(alias) != _globalVerbs.end();
+    return loadVerbTables()->globalVerbs.has(symbol);
 }
 
 // Gets whether the specified builder verb has been added.
 bool WordManager::hasBuilderVerb(const void *, std::string alias) {
     // Convert string to lowercase
     std::transform(alias.begin(), alias.end(), alias.begin(), ::tolower);
+    Symbol symbol = SymbolTable::find(alias);
 
-    std::lock_guard<std::mutex> guard(builderVerbLock);
-    return _builderVerbs.find(alias) != _builderVerbs.end();
+    return loadVerbTables()->builderVerbs.has(symbol);
 }
 
 // Gets whether the specified ignore word has been added.
@@ -238,8 +220,43 @@ bool WordManager::isIgnoreWord(const void *, std::string word) {
     // Convert string to lowercase
     std::transform(word.begin(), word.end(), word.begin(), ::tolower);
 
-    std::lock_guard<std::mutex> guard(ignoreWordLock);
-    return _ignoreWords.find(word) != _ignoreWords.end();
+    return isIgnoreSymbol(SymbolTable::find(word));
+}
+
+// Gets whether the word with the specified symbol is an ignore word.
+bool WordManager::isIgnoreSymbol(Symbol symbol) {
+    if (symbol == NO_SYMBOL)
+        return false;
+
+    std::shared_ptr<const VerbTables> tables = loadVerbTables();
+    return tables->ignoreWords.find(symbol) != tables->ignoreWords.end();
+}
+
+// Finds the longest edit mode verb at the start of the token range.
+size_t WordManager::findLongestEditModeVerb(const void *, const std::vector<Token> &tokens, const Range &range, bool &skipIgnoreWords) {
+    return loadVerbTables()->editModeVerbs.findLongest(tokens, range, skipIgnoreWords);
+}
+
+// Finds the longest builder verb at the start of the token range.
+size_t WordManager::findLongestBuilderVerb(const void *, const std::vector<Token> &tokens, const Range &range, bool &skipIgnoreWords) {
+    return loadVerbTables()->builderVerbs.findLongest(tokens, range, skipIgnoreWords);
+}
+
+// Finds the longest global verb at the start of the token range.
+size_t WordManager::findLongestGlobalVerb(const void *, const std::vector<Token> &tokens, const Range &range, bool &skipIgnoreWords) {
+    return loadVerbTables()->globalVerbs.findLongest(tokens, range, skipIgnoreWords);
+}
+
+// Finds the longest in-use noun at the start of the token range.
+size_t WordManager::findLongestNoun(const void *, const std::vector<Token> &tokens, const Range &range, bool &skipIgnoreWords) {
+    ++localLookups;
+    return _localNouns.findLongest(tokens, range, skipIgnoreWords);
+}
+
+// Finds the longest in-use verb at the start of the token range.
+size_t WordManager::findLongestVerb(const void *, const std::vector<Token> &tokens, const Range &range, bool &skipIgnoreWords) {
+    ++localLookups;
+    return _localVerbs.findLongest(tokens, range, skipIgnoreWords);
 }
 
 // Removes a noun alias-InteractiveNoun pair from the noun alias lookup table.
@@ -247,12 +264,10 @@ void WordManager::removeNoun(std::string alias, engine::InteractiveNoun *pObj) {
     // Precondition: alias is non-empty string
     assert(!alias.empty());
 
-    // Block any other threads from accessing _nounAliases until operation is complete.
-    std::lock_guard<std::mutex> guard(localNounsLock);
-
     if (!_localNouns.removeWord(alias, pObj)) {
         std::cerr << "Attempted to remove unknown noun alias '" << alias << "' from object ID " << pObj->getID() << std::endl;        
     }
+    ++localVersion;
 }
 
 // Removes a verb alias-InteractiveNoun pair from the verb alias lookup table.
@@ -260,31 +275,114 @@ void WordManager::removeVerb(std::string alias, engine::InteractiveNoun *pObj) {
     // Precondition: alias is non-empty string
     assert(!alias.empty());
 
-    // Block any other threads from accessing _verbAliases until operation is complete.
-    std::lock_guard<std::mutex> guard(localVerbsLock);
-
     if (!_localVerbs.removeWord(alias, pObj)) {
         std::cerr << "Attempted to remove unknown verb alias '" << alias << "' from object ID " << pObj->getID() << std::endl;
     }
+    ++localVersion;
+}
+
+// Applies a batch of changes to the in-use noun alias lookup table.
+void WordManager::applyNounChanges(const std::vector<WordChange> &changes) {
+    std::vector<const WordChange *> failed;
+    _localNouns.apply(changes, failed);
+    for (auto change : failed) {
+        if (change->isAdd) {
+            std::cerr << "Attempted to add duplicate noun alias '" << change->alias << "' to object ID " << change->pObject->getID() << std::endl;
+        }
+        else {
+            std::cerr << "Attempted to remove unknown noun alias '" << change->alias << "' from object ID " << change->pObject->getID() << std::endl;
+        }
+    }
+    ++localVersion;
+}
+
+// Applies a batch of changes to the in-use verb alias lookup table.
+void WordManager::applyVerbChanges(const std::vector<WordChange> &changes) {
+    std::vector<const WordChange *> failed;
+    _localVerbs.apply(changes, failed);
+    for (auto change : failed) {
+        if (change->isAdd) {
+            std::cerr << "Attempted to add duplicate verb alias '" << change->alias << "' to object ID " << change->pObject->getID() << std::endl;
+        }
+        else {
+            std::cerr << "Attempted to remove unknown verb alias '" << change->alias << "' from object ID " << change->pObject->getID() << std::endl;
+        }
+    }
+    ++localVersion;
+}
+
+// Removes all aliases of an object from the in-use lookup tables.
+void WordManager::removeObject(engine::InteractiveNoun *pObj, const std::vector<std::string> &nounAliases, const std::vector<std::string> &verbAliases) {
+    // Precondition: verify non-null pointer
+    assert(pObj != nullptr);
+
+    std::vector<WordChange> nounChanges;
+    std::vector<WordChange> verbChanges;
+    std::vector<const WordChange *> failed;
+    for (auto &alias : nounAliases) {
+        nounChanges.emplace_back(alias, pObj, false);
+    }
+    for (auto &alias : verbAliases) {
+        verbChanges.emplace_back(alias, pObj, false);
+    }
 
+    // Aliases that were never added for this object are not an error here
+    _localNouns.apply(nounChanges, failed);
+    _localVerbs.apply(verbChanges, failed);
+    ++localVersion;
 }
 
 // Reset all member variables.
 void WordManager::resetAll() {
-    // Block any other threads from accessing private members until operation is complete.
-    std::lock_guard<std::mutex> editModeVerbGuard(editModeVerbLock);
-    std::lock_guard<std::mutex> globalVerbGuard(globalVerbLock);
-    std::lock_guard<std::mutex> builderVerbGuard(builderVerbLock);
-    std::lock_guard<std::mutex> localNounGuard(localNounsLock);
-    std::lock_guard<std::mutex> localVerbGuard(localVerbsLock);
-    std::lock_guard<std::mutex> ignoreWordGuard(ignoreWordLock);
-
-    _editModeVerbs.clear();
-    _globalVerbs.clear();
-    _builderVerbs.clear();
+    // Block other writers until the empty snapshot is published.
+    std::lock_guard<std::mutex> guard(verbTablesWriteLock);
+    storeVerbTables(std::make_shared<VerbTables>());
     _localNouns.clear();
     _localVerbs.clear();
-    _ignoreWords.clear();
+    ++verbVersion;
+    ++localVersion;
+}
+
+unsigned long WordManager::getVerbVersion() {
+    return verbVersion;
+}
+
+unsigned long WordManager::getLocalVersion() {
+    return localVersion;
+}
+
+unsigned long WordManager::getLocalLookups() {
+    return localLookups;
+}
+
+// Readers and writers use the atomic shared_ptr functions, so a reader
+// always gets a complete snapshot that stays alive while it is in use.
+std::shared_ptr<const WordManager::VerbTables> WordManager::loadVerbTables() {
+    return std::atomic_load(&_verbTables);
+}
+
+void WordManager::storeVerbTables(std::shared_ptr<const VerbTables> tables) {
+    std::atomic_store(&_verbTables, tables);
+}
+
+VerbSpan WordManager::getVerbs(const std::shared_ptr<const VerbTables> &tables, const VerbTable &verbTable, std::string alias) {
+    Symbol symbol = SymbolTable::find(alias);
+
+    // Precondition: value must be in table
+    assert(verbTable.has(symbol));
+
+    // The span shares ownership of the snapshot, so it stays valid after
+    // a writer publishes a new one.
+    return verbTable.find(symbol, tables);
+}
+
+void WordManager::addVerbs(VerbTable VerbTables::*verbTable, const VerbDefinition *definitions, size_t count) {
+    // Block other writers until the new snapshot is published.
+    std::lock_guard<std::mutex> guard(verbTablesWriteLock);
+    std::shared_ptr<VerbTables> tables = std::make_shared<VerbTables>(*loadVerbTables());
+    ((*tables).*verbTable).add(definitions, count);
+    storeVerbTables(tables);
+    ++verbVersion;
 }
 
 }}
@@ -2,7 +2,7 @@
   \file     WordManager.hpp
   \author   David Rigert
   \created  02/02/2017
-  \modified 02/18/2017
+  \modified 10/19/2026
   \course   CS467, Winter 2017
  
   \details  This file contains the declarations for the WordManager class.
@@ -13,15 +13,17 @@
 #define LEGACYMUD_PARSER_WORDMANAGER_HPP
 
 #include "Grammar.hpp"
+#include "ShardedWordMap.hpp"
 #include "VerbInfo.hpp"
+#include "VerbTable.hpp"
 #include "WordMap.hpp"
 
 #include <CommandEnum.hpp>
 
 #include <vector>
-#include <map>
-#include <set>
+#include <memory>
 #include <string>
+#include <unordered_set>
 #include <utility>
 
 namespace legacymud { namespace engine {
@@ -30,12 +32,6 @@ namespace legacymud { namespace engine {
 
 namespace legacymud { namespace parser {
 
-/*! 
-  \typedef GlobalVerbMap
-  \brief Specifies the container type used to store global verbs.
-*/
-typedef std::multimap<std::string, VerbInfo> GlobalVerbMap;
-
 /*!
   \brief Stores and manages all verbs and nouns supported by the game world.
 
@@ -43,6 +39,12 @@ typedef std::multimap<std::string, VerbInfo> GlobalVerbMap;
   by objects in the game world. It also stores global verbs that
   are supported anywhere in the game world, and which prepositions
   map to which position.
+
+  The verb tables and ignore words rarely change after startup, so lookups
+  read an immutable snapshot and never block. The in-use noun and verb
+  tables change whenever an object moves, so they are split into shards
+  that are locked separately.
+
   This class should not be instantiated. All member functions are static.
 */
 class WordManager {
@@ -118,6 +120,39 @@ public:
     */
     static void addBuilderVerb(std::string alias, VerbInfo info);
 
+    /*!
+      \brief Adds a table of definitions to the edit mode verb lookup table.
+
+      This function has the same effect as calling addEditModeVerb() for each
+      definition, but the lookup table is only copied and published once.
+
+      \param[in]  definitions Specifies the first definition to add.
+      \param[in]  count       Specifies the number of definitions to add.
+    */
+    static void addEditModeVerbs(const VerbDefinition *definitions, size_t count);
+
+    /*!
+      \brief Adds a table of definitions to the global verb lookup table.
+
+      This function has the same effect as calling addGlobalVerb() for each
+      definition, but the lookup table is only copied and published once.
+
+      \param[in]  definitions Specifies the first definition to add.
+      \param[in]  count       Specifies the number of definitions to add.
+    */
+    static void addGlobalVerbs(const VerbDefinition *definitions, size_t count);
+
+    /*!
+      \brief Adds a table of definitions to the world builder verb lookup table.
+
+      This function has the same effect as calling addBuilderVerb() for each
+      definition, but the lookup table is only copied and published once.
+
+      \param[in]  definitions Specifies the first definition to add.
+      \param[in]  count       Specifies the number of definitions to add.
+    */
+    static void addBuilderVerbs(const VerbDefinition *definitions, size_t count);
+
     /*!
       \brief Adds the specified word to the ignore list.
 
@@ -175,9 +210,10 @@ public:
 
       \param[in] alias  Specifies the verb alias for which to get the VerbInfo.
       
-      \return Returns a list of VerbInfo objects that corresponds to \a alias.
+      \return Returns a span of the VerbInfo objects that correspond to \a alias.
+              The span does not copy the VerbInfo objects.
     */
-    static std::vector<VerbInfo> getEditModeVerbs(std::string alias);
+    static VerbSpan getEditModeVerbs(std::string alias);
 
     /*!
       \brief Gets the VerbInfo object of the specified world builder verb.
@@ -187,9 +223,10 @@ public:
 
       \param[in] alias  Specifies the verb alias for which to get the VerbInfo.
       
-      \return Returns a list of VerbInfo objects that corresponds to \a alias.
+      \return Returns a span of the VerbInfo objects that correspond to \a alias.
+              The span does not copy the VerbInfo objects.
     */
-    static std::vector<VerbInfo> getBuilderVerbs(std::string alias);
+    static VerbSpan getBuilderVerbs(std::string alias);
 
     /*!
       \brief Gets the VerbInfo object of the specified global verb.
@@ -199,9 +236,10 @@ public:
 
       \param[in] alias  Specifies the verb alias for which to get the VerbInfo.
       
-      \return Returns a list of VerbInfo objects that corresponds to \a alias.
+      \return Returns a span of the VerbInfo objects that correspond to \a alias.
+              The span does not copy the VerbInfo objects.
     */
-    static std::vector<VerbInfo> getGlobalVerbs(std::string alias);
+    static VerbSpan getGlobalVerbs(std::string alias);
 
     /*!
       \brief Gets pointers to all local nouns in the game world with the specified alias.
@@ -216,6 +254,21 @@ public:
     */
     static std::vector<engine::InteractiveNoun *> getLocalNouns(std::string alias);
 
+    /*!
+      \brief Finds the verb aliases that are similar to a misspelled word.
+
+      This function searches the global verbs and, if \a isAdmin is true,
+      the world builder and edit mode verbs for aliases within \a maxDistance
+      edits of \a word. It is used to suggest a verb when the player enters
+      a verb that does not exist.
+
+      \param[in]  word        Specifies the lowercase word to compare against.
+      \param[in]  maxDistance Specifies the largest edit distance to include.
+      \param[in]  isAdmin     Specifies whether to include admin-only verbs.
+      \param[out] matches     Receives the similar aliases and their distances.
+    */
+    static void findSimilarVerbs(const std::string &word, size_t maxDistance, bool isAdmin, std::vector<WordMatch> &matches);
+
     /*!
       \brief Gets whether the specified noun alias is in use.
       
@@ -366,6 +419,123 @@ public:
     */
     static bool isIgnoreWord(std::string word) { return isIgnoreWord(0, word); }
 
+    /*!
+      \brief Gets whether the specified word symbol is an ignored word.
+
+      This function is used by the parser to check tokens without comparing
+      or copying strings.
+
+      \param[in] symbol   Specifies the symbol of the word to check.
+
+      \return Returns whether the word with \a symbol should be ignored.
+    */
+    static bool isIgnoreSymbol(Symbol symbol);
+
+    /*!
+      \brief Finds the longest edit mode verb alias at the start of a token range.
+
+      This function gets the end of the longest range of tokens, starting at
+      \a range.start, that matches an edit mode verb alias. It can be passed as the
+      \c findLongest function pointer of the PartOfSpeech::findMatch() function.
+
+      \param[in]  context         This parameter is for compatibility with the
+                                  \c findLongest function pointer of the
+                                  PartOfSpeech::findMatch() function.
+                                  The value entered here is ignored.
+      \param[in]  tokens          Specifies the tokenized input text.
+      \param[in]  range           Specifies the range of tokens to check.
+      \param[out] skipIgnoreWords Set to whether the alias only matched after
+                                  omitting ignore words.
+
+      \return Returns the end of the longest matching range, or
+              \a range.start if there is no match.
+    */
+    static size_t findLongestEditModeVerb(const void *context, const std::vector<Token> &tokens, const Range &range, bool &skipIgnoreWords);
+
+    /*!
+      \brief Finds the longest world builder verb alias at the start of a token range.
+
+      This function gets the end of the longest range of tokens, starting at
+      \a range.start, that matches a world builder verb alias. It can be passed as the
+      \c findLongest function pointer of the PartOfSpeech::findMatch() function.
+
+      \param[in]  context         This parameter is for compatibility with the
+                                  \c findLongest function pointer of the
+                                  PartOfSpeech::findMatch() function.
+                                  The value entered here is ignored.
+      \param[in]  tokens          Specifies the tokenized input text.
+      \param[in]  range           Specifies the range of tokens to check.
+      \param[out] skipIgnoreWords Set to whether the alias only matched after
+                                  omitting ignore words.
+
+      \return Returns the end of the longest matching range, or
+              \a range.start if there is no match.
+    */
+    static size_t findLongestBuilderVerb(const void *context, const std::vector<Token> &tokens, const Range &range, bool &skipIgnoreWords);
+
+    /*!
+      \brief Finds the longest global verb alias at the start of a token range.
+
+      This function gets the end of the longest range of tokens, starting at
+      \a range.start, that matches a global verb alias. It can be passed as the
+      \c findLongest function pointer of the PartOfSpeech::findMatch() function.
+
+      \param[in]  context         This parameter is for compatibility with the
+                                  \c findLongest function pointer of the
+                                  PartOfSpeech::findMatch() function.
+                                  The value entered here is ignored.
+      \param[in]  tokens          Specifies the tokenized input text.
+      \param[in]  range           Specifies the range of tokens to check.
+      \param[out] skipIgnoreWords Set to whether the alias only matched after
+                                  omitting ignore words.
+
+      \return Returns the end of the longest matching range, or
+              \a range.start if there is no match.
+    */
+    static size_t findLongestGlobalVerb(const void *context, const std::vector<Token> &tokens, const Range &range, bool &skipIgnoreWords);
+
+    /*!
+      \brief Finds the longest noun alias at the start of a token range.
+
+      This function gets the end of the longest range of tokens, starting at
+      \a range.start, that matches a noun alias in use by at least one InteractiveNoun. It can be passed as the
+      \c findLongest function pointer of the PartOfSpeech::findMatch() function.
+
+      \param[in]  context         This parameter is for compatibility with the
+                                  \c findLongest function pointer of the
+                                  PartOfSpeech::findMatch() function.
+                                  The value entered here is ignored.
+      \param[in]  tokens          Specifies the tokenized input text.
+      \param[in]  range           Specifies the range of tokens to check.
+      \param[out] skipIgnoreWords Set to whether the alias only matched after
+                                  omitting ignore words.
+
+      \return Returns the end of the longest matching range, or
+              \a range.start if there is no match.
+    */
+    static size_t findLongestNoun(const void *context, const std::vector<Token> &tokens, const Range &range, bool &skipIgnoreWords);
+
+    /*!
+      \brief Finds the longest verb alias at the start of a token range.
+
+      This function gets the end of the longest range of tokens, starting at
+      \a range.start, that matches a verb alias in use by at least one InteractiveNoun. It can be passed as the
+      \c findLongest function pointer of the PartOfSpeech::findMatch() function.
+
+      \param[in]  context         This parameter is for compatibility with the
+                                  \c findLongest function pointer of the
+                                  PartOfSpeech::findMatch() function.
+                                  The value entered here is ignored.
+      \param[in]  tokens          Specifies the tokenized input text.
+      \param[in]  range           Specifies the range of tokens to check.
+      \param[out] skipIgnoreWords Set to whether the alias only matched after
+                                  omitting ignore words.
+
+      \return Returns the end of the longest matching range, or
+              \a range.start if there is no match.
+    */
+    static size_t findLongestVerb(const void *context, const std::vector<Token> &tokens, const Range &range, bool &skipIgnoreWords);
+
     /*!
       \brief Removes the specified noun alias-InteractiveNoun pair from the lookup table.
 
@@ -404,6 +574,76 @@ public:
     */
     static void removeVerb(std::string alias, engine::InteractiveNoun *pObj);
 
+    /*!
+      \brief Applies a list of changes to the in-use noun alias lookup table.
+
+      This function has the same effect as calling addNoun() or removeNoun()
+      for each change, but each shard of the table is locked only once.
+
+      \param[in] changes  Specifies the noun alias changes to apply.
+    */
+    static void applyNounChanges(const std::vector<WordChange> &changes);
+
+    /*!
+      \brief Applies a list of changes to the in-use verb alias lookup table.
+
+      This function has the same effect as calling addVerb() or removeVerb()
+      for each change, but each shard of the table is locked only once.
+
+      \param[in] changes  Specifies the verb alias changes to apply.
+    */
+    static void applyVerbChanges(const std::vector<WordChange> &changes);
+
+    /*!
+      \brief Removes all of the aliases of an InteractiveNoun from the lookup tables.
+
+      Call this function when an InteractiveNoun is removed from the game,
+      before it is freed, so the parser can no longer find it. Aliases that
+      are not in the lookup tables for \a pObj are skipped without an error,
+      because copies of an object keep its aliases without adding them.
+
+      \param[in]  pObj        Specifies a pointer to the InteractiveNoun object.
+      \param[in]  nounAliases Specifies the noun aliases of the object.
+      \param[in]  verbAliases Specifies the verb aliases of the object.
+
+      \post No noun or verb alias in the lookup tables refers to \a pObj.
+    */
+    static void removeObject(engine::InteractiveNoun *pObj, const std::vector<std::string> &nounAliases, const std::vector<std::string> &verbAliases);
+
+    /*!
+      \brief Gets the version number of the verb tables.
+
+      The version number increases whenever an entry is added to the edit mode,
+      world builder or global verb tables or to the ignore words. Callers can
+      use it to determine whether data derived from those tables is still current.
+
+      \return Returns the current version number.
+    */
+    static unsigned long getVerbVersion();
+
+    /*!
+      \brief Gets the version number of the in-use noun and verb alias lookup tables.
+
+      The version number increases whenever an alias is added to or removed
+      from the in-use lookup tables, which happens whenever an object anywhere
+      in the game moves. Only data derived from a lookup in those tables
+      needs to check it. See getLocalLookups().
+
+      \return Returns the current version number.
+    */
+    static unsigned long getLocalVersion();
+
+    /*!
+      \brief Gets the number of lookups the calling thread has made in the
+             in-use noun and verb alias lookup tables.
+
+      Callers can compare the number before and after a parse to find out
+      whether the result depends on the in-use lookup tables.
+
+      \return Returns the number of lookups made by the calling thread.
+    */
+    static unsigned long getLocalLookups();
+
     /*!
       \brief Resets the WordManager class and clears all words
 
@@ -416,23 +656,45 @@ private:
     // Use a private constructor to prevent instantiation.
     WordManager() {}
 
-    // Store the verbs to enable edit mode here.
-    static GlobalVerbMap _editModeVerbs;
-    
-    // Store all world builder verbs here.
-    static GlobalVerbMap _builderVerbs;
+    /*
+      Stores an immutable snapshot of the verb tables and ignore words.
+      Writers copy the current snapshot, change the copy, and publish it
+      atomically, so readers never wait for a writer to finish.
+    */
+    struct VerbTables {
+        // Store the verbs to enable edit mode here.
+        VerbTable editModeVerbs;
+
+        // Store all world builder verbs here.
+        VerbTable builderVerbs;
+
+        // Store all global verbs here.
+        VerbTable globalVerbs;
+
+        // Store ignore words
+        std::unordered_set<Symbol> ignoreWords;
+    };
 
-    // Store all global verbs here.
-    static GlobalVerbMap _globalVerbs;
+    // Gets the current snapshot of the verb tables.
+    static std::shared_ptr<const VerbTables> loadVerbTables();
+
+    // Publishes a new snapshot of the verb tables.
+    static void storeVerbTables(std::shared_ptr<const VerbTables> tables);
+
+    // Gets the VerbInfos of an alias in one of the verb tables of a snapshot.
+    static VerbSpan getVerbs(const std::shared_ptr<const VerbTables> &tables, const VerbTable &verbTable, std::string alias);
+
+    // Publishes a copy of the current snapshot with definitions added to one of its verb tables.
+    static void addVerbs(VerbTable VerbTables::*verbTable, const VerbDefinition *definitions, size_t count);
+
+    // Store the current snapshot of the verb tables here.
+    static std::shared_ptr<const VerbTables> _verbTables;
 
     // Store a map of all nouns in the game world here.
-    static WordMap _localNouns;
+    static ShardedWordMap _localNouns;
 
     // Store a map of all verbs in the game world here.
-    static WordMap _localVerbs;
-
-    // Store ignore words
-    static std::set<std::string> _ignoreWords;
+    static ShardedWordMap _localVerbs;
 
 };
 
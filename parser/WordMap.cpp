@@ -2,7 +2,7 @@
   \file     WordMap.cpp
   \author   David Rigert
   \created  02/11/2017
-  \modified 03/01/2017
+  \modified 10/19/2026
   \course   CS467, Winter 2017
  
   \details  This file contains the implementation of the WordMap class.
@@ -24,16 +24,21 @@ bool WordMap::addWord(std::string alias, engine::InteractiveNoun *pObject) {
     // Convert string to lowercase
     std::transform(alias.begin(), alias.end(), alias.begin(), ::tolower);
 
+    Symbol symbol = SymbolTable::intern(alias);
     bool success = false;
 
-    if (_wordMap.find(alias) != _wordMap.end()) {
-        if (_wordMap[alias].find(pObject) != _wordMap[alias].end()) {
-            _wordMap[alias][pObject]++;
+    if (_wordMap.find(symbol) != _wordMap.end()) {
+        if (_wordMap[symbol].find(pObject) != _wordMap[symbol].end()) {
+            _wordMap[symbol][pObject]++;
             success = true;
         }
     }
     if (!success) {
-        _wordMap[alias][pObject] = 1;
+        // Only the first object with a new alias adds it to the trie
+        if (_wordMap.find(symbol) == _wordMap.end()) {
+            _trie.insert(alias);
+        }
+        _wordMap[symbol][pObject] = 1;
         success = true;
     }
 
@@ -45,17 +50,19 @@ bool WordMap::addWord(std::string alias, engine::InteractiveNoun *pObject) {
 bool WordMap::hasWord(std::string alias) const {
     // Convert string to lowercase
     std::transform(alias.begin(), alias.end(), alias.begin(), ::tolower);
+    Symbol symbol = SymbolTable::find(alias);
 
-    return _wordMap.find(alias) != _wordMap.end();
+    return _wordMap.find(symbol) != _wordMap.end();
 }
 
 // Get all InteractiveNoun objects mapped to the specified alias.
 std::vector<engine::InteractiveNoun *> WordMap::getObjects(std::string alias) const {
     // Convert string to lowercase
     std::transform(alias.begin(), alias.end(), alias.begin(), ::tolower);
+    Symbol symbol = SymbolTable::find(alias);
 
     std::vector<engine::InteractiveNoun *> results;
-    auto it = _wordMap.find(alias);
+    auto it = _wordMap.find(symbol);
     if (it != _wordMap.end()) {
         for (auto it2 = it->second.begin(); it2 != it->second.end(); ++it2) {
             results.push_back(it2->first);
@@ -65,11 +72,16 @@ std::vector<engine::InteractiveNoun *> WordMap::getObjects(std::string alias) co
     return results;
 }
 
-std::map<std::string, std::map<engine::InteractiveNoun *, int>>::iterator WordMap::begin() {
+// Get the end of the longest alias at the start of the token range.
+size_t WordMap::findLongest(const std::vector<Token> &tokens, const Range &range, bool &skipIgnoreWords) const {
+    return _trie.findLongest(tokens, range, skipIgnoreWords);
+}
+
+std::unordered_map<Symbol, std::map<engine::InteractiveNoun *, int>>::iterator WordMap::begin() {
     return _wordMap.begin();
 }
 
-std::map<std::string, std::map<engine::InteractiveNoun *, int>>::iterator WordMap::end() {
+std::unordered_map<Symbol, std::map<engine::InteractiveNoun *, int>>::iterator WordMap::end() {
     return _wordMap.end();
 }
 
@@ -79,23 +91,34 @@ size_t WordMap::getSize() const {
     return _count;
 }
 
+std::vector<std::string> WordMap::getWords() const {
+    std::vector<std::string> words;
+    words.reserve(_wordMap.size());
+    for (auto it = _wordMap.begin(); it != _wordMap.end(); ++it) {
+        words.push_back(SymbolTable::getWord(it->first));
+    }
+    return words;
+}
+
 // Remove the specified alias-InteractiveNoun combo from the map.
 bool WordMap::removeWord(std::string alias, engine::InteractiveNoun *pObject) {
     // Convert string to lowercase
     std::transform(alias.begin(), alias.end(), alias.begin(), ::tolower);
+    Symbol symbol = SymbolTable::find(alias);
 
     bool success = false;
 
-    if (_wordMap.find(alias) != _wordMap.end()) {
-        if (_wordMap[alias].find(pObject) != _wordMap[alias].end()) {
-            _wordMap[alias][pObject]--;
+    if (_wordMap.find(symbol) != _wordMap.end()) {
+        if (_wordMap[symbol].find(pObject) != _wordMap[symbol].end()) {
+            _wordMap[symbol][pObject]--;
             // Remove key-value pair if counter reaches 0
-            if (_wordMap[alias][pObject] < 1) {
-                _wordMap[alias].erase(pObject);
+            if (_wordMap[symbol][pObject] < 1) {
+                _wordMap[symbol].erase(pObject);
             }
             // Remove alias if no objects left
-            if (_wordMap[alias].empty()) {
-                _wordMap.erase(alias);
+            if (_wordMap[symbol].empty()) {
+                _wordMap.erase(symbol);
+                _trie.remove(alias);
             }
             _count--;
             success = true;
@@ -108,6 +131,7 @@ bool WordMap::removeWord(std::string alias, engine::InteractiveNoun *pObject) {
 // Clear all data and reset counter
 void WordMap::clear() {
     _wordMap.clear();
+    _trie.clear();
     _count = 0;
 }
 
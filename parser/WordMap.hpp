@@ -2,7 +2,7 @@
   \file     WordMap.hpp
   \author   David Rigert
   \created  02/11/2017
-  \modified 03/01/2017
+  \modified 10/19/2026
   \course   CS467, Winter 2017
  
   \details  This file contains the declarations for the WordMap class.
@@ -12,8 +12,11 @@
 #ifndef LEGACYMUD_PARSER_WORDMAP_HPP
 #define LEGACYMUD_PARSER_WORDMAP_HPP
 
+#include "WordTrie.hpp"
+
 #include <string>
 #include <map>
+#include <unordered_map>
 #include <vector>
 
 namespace legacymud { namespace engine {
@@ -27,7 +30,8 @@ namespace legacymud { namespace parser {
 
   This class stores verb or noun aliases as a key to find the corresponding
   InteractiveNoun object. It guarantees that every key-value pair is unique.
-  All comparisons are case-insensitive.
+  All comparisons are case-insensitive. Aliases are keyed by their interned
+  symbol in the SymbolTable.
 */
 class WordMap {
 public:
@@ -62,19 +66,35 @@ public:
     */
     bool hasWord(std::string alias) const;
 
+    /*!
+      \brief Finds the longest alias in the map at the start of a token range.
+
+      This function gets the end of the longest range of tokens, starting at
+      \a range.start, whose normalized text is an alias in the map.
+
+      \param[in]  tokens          Specifies the tokenized input text.
+      \param[in]  range           Specifies the range of tokens to check.
+      \param[out] skipIgnoreWords Set to whether the alias only matched after
+                                  omitting ignore words.
+
+      \return Returns the end of the longest matching range, or
+              \a range.start if there is no match.
+    */
+    size_t findLongest(const std::vector<Token> &tokens, const Range &range, bool &skipIgnoreWords) const;
+
     /*!
       \brief Gets an iterator to the beginning of the internal map.
 
       \return Returns an iterator to the beginning of the map.
     */
-    std::map<std::string, std::map<engine::InteractiveNoun *, int>>::iterator begin();
+    std::unordered_map<Symbol, std::map<engine::InteractiveNoun *, int>>::iterator begin();
 
     /*!
       \brief Gets an iterator to the end of the internal map.
 
       \return Returns an iterator to the end of the map.
     */
-    std::map<std::string, std::map<engine::InteractiveNoun *, int>>::iterator end();
+    std::unordered_map<Symbol, std::map<engine::InteractiveNoun *, int>>::iterator end();
 
     /*!
       \brief Gets a vector of all objects mapped to the specified word.
@@ -99,6 +119,13 @@ public:
     */
     size_t getSize() const;
 
+    /*!
+      \brief Gets all words stored in the map.
+
+      \return Returns a vector of the lowercase words in the map, in no particular order.
+    */
+    std::vector<std::string> getWords() const;
+
     /*!
       \brief Removes a word-object pair from the map.
 
@@ -122,7 +149,8 @@ public:
     void clear();
 
 private:
-    std::map<std::string, std::map<engine::InteractiveNoun *, int>> _wordMap;
+    std::unordered_map<Symbol, std::map<engine::InteractiveNoun *, int>> _wordMap;
+    WordTrie _trie;
     size_t _count;
 };
 
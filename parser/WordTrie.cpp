@@ -0,0 +1,177 @@
+/*!
+  \file     WordTrie.cpp
+  \author   agent
+  \created  10/19/2026
+  \modified 10/19/2026
+
+  \details  This file contains the implementation of the WordTrie class.
+*/
+
+#include "WordTrie.hpp"
+
+#include "WordManager.hpp"
+
+namespace {
+
+using legacymud::parser::Symbol;
+using legacymud::parser::SymbolTable;
+
+// Helper function for splitting an alias into the symbols of its space-delimited
+// words. Words are interned if \a intern is true, and looked up otherwise.
+// Consecutive spaces produce empty words, which never match a token.
+std::vector<Symbol> splitAlias(const std::string &alias, bool intern) {
+    std::vector<Symbol> words;
+    size_t start = 0;
+    size_t end = alias.find(' ');
+    while (true) {
+        std::string word = alias.substr(start, end == std::string::npos ? std::string::npos : end - start);
+        words.push_back(intern ? SymbolTable::intern(word) : SymbolTable::find(word));
+        if (end == std::string::npos)
+            break;
+        start = end + 1;
+        end = alias.find(' ', start);
+    }
+
+    return words;
+}
+
+}
+
+namespace legacymud { namespace parser {
+
+WordTrie::WordTrie() {
+    _root = new Node();
+}
+
+WordTrie::WordTrie(const WordTrie &other) {
+    _root = copyNode(other._root);
+}
+
+WordTrie &WordTrie::operator=(const WordTrie &other) {
+    if (this != &other) {
+        Node *root = copyNode(other._root);
+        freeNode(_root);
+        _root = root;
+    }
+    return *this;
+}
+
+WordTrie::~WordTrie() {
+    freeNode(_root);
+}
+
+// Add the words of the alias as a path from the root.
+void WordTrie::insert(const std::string &alias) {
+    if (alias.empty())
+        return;
+
+    std::vector<Symbol> words = splitAlias(alias, true);
+    // An alias with an empty word can never match a token sequence
+    for (size_t i = 0; i < words.size(); ++i) {
+        if (words[i] == NO_SYMBOL)
+            return;
+    }
+
+    Node *node = _root;
+    for (size_t i = 0; i < words.size(); ++i) {
+        Node *&child = node->children[words[i]];
+        if (child == nullptr) {
+            child = new Node();
+        }
+        node = child;
+    }
+    node->count++;
+}
+
+// Remove one reference to the alias and prune any nodes left unused.
+bool WordTrie::remove(const std::string &alias) {
+    if (alias.empty())
+        return false;
+
+    std::vector<Symbol> words = splitAlias(alias, false);
+    std::vector<Node *> path;
+    Node *node = _root;
+    path.push_back(node);
+    for (size_t i = 0; i < words.size(); ++i) {
+        auto it = node->children.find(words[i]);
+        if (it == node->children.end())
+            return false;
+        node = it->second;
+        path.push_back(node);
+    }
+    if (node->count == 0)
+        return false;
+    node->count--;
+
+    // Walk back toward the root, freeing nodes with no aliases below them
+    for (size_t i = words.size(); i > 0; --i) {
+        Node *current = path[i];
+        if (current->count > 0 || !current->children.empty())
+            break;
+        path[i - 1]->children.erase(words[i - 1]);
+        delete current;
+    }
+
+    return true;
+}
+
+// Walk the trie once with two cursors: one that reads every token, and
+// one that steps over ignore words.
+size_t WordTrie::findLongest(const std::vector<Token> &tokens, const Range &range, bool &skipIgnoreWords) const {
+    size_t longest = range.start;
+    skipIgnoreWords = false;
+    if (range.start >= range.end || range.end > tokens.size())
+        return longest;
+
+    const Node *withIgnore = _root;
+    const Node *withoutIgnore = _root;
+    for (size_t i = range.start; i < range.end; ++i) {
+        Symbol word = tokens[i].symbol;
+
+        if (withIgnore != nullptr) {
+            auto it = withIgnore->children.find(word);
+            withIgnore = (it == withIgnore->children.end()) ? nullptr : it->second;
+        }
+        // Ignore words are dropped from the second form, leaving its cursor in place
+        if (withoutIgnore != nullptr && !WordManager::isIgnoreSymbol(word)) {
+            auto it = withoutIgnore->children.find(word);
+            withoutIgnore = (it == withoutIgnore->children.end()) ? nullptr : it->second;
+        }
+        if (withIgnore == nullptr && withoutIgnore == nullptr)
+            break;
+
+        if (withIgnore != nullptr && withIgnore->count > 0) {
+            longest = i + 1;
+            skipIgnoreWords = false;
+        }
+        else if (withoutIgnore != nullptr && withoutIgnore->count > 0) {
+            longest = i + 1;
+            skipIgnoreWords = true;
+        }
+    }
+
+    return longest;
+}
+
+void WordTrie::clear() {
+    freeNode(_root);
+    _root = new Node();
+}
+
+WordTrie::Node *WordTrie::copyNode(const Node *node) {
+    Node *copy = new Node();
+    copy->count = node->count;
+    for (auto it = node->children.begin(); it != node->children.end(); ++it) {
+        copy->children[it->first] = copyNode(it->second);
+    }
+    return copy;
+}
+
+void WordTrie::freeNode(Node *node) {
+    for (auto it = node->children.begin(); it != node->children.end(); ++it) {
+        freeNode(it->second);
+    }
+    delete node;
+}
+
+} }
@@ -0,0 +1,114 @@
+/*!
+  \file     WordTrie.hpp
+  \author   agent
+  \created  10/19/2026
+  \modified 10/19/2026
+
+  \details  This file contains the declarations for the WordTrie class.
+            The WordTrie class is a token-level prefix tree of verb or noun
+            aliases that finds the longest alias at the start of a token
+            sequence in a single pass.
+*/
+#ifndef LEGACYMUD_PARSER_WORDTRIE_HPP
+#define LEGACYMUD_PARSER_WORDTRIE_HPP
+
+#include "Tokenizer.hpp"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace legacymud { namespace parser {
+
+/*!
+  \brief Represents a prefix tree of space-delimited aliases.
+
+  This class stores each alias as a path of word symbols from the root node.
+  The longest alias at the start of a token range is found by walking the
+  tree once from left to right, instead of joining and looking up every
+  shorter prefix of the range. Aliases are reference counted, so an alias
+  that is inserted more than once must be removed the same number of times.
+
+  This class does not do any locking. The owning container is responsible
+  for synchronizing access to it.
+*/
+class WordTrie {
+public:
+    /*!
+      \brief Default constructor. Initializes the trie to an empty state.
+    */
+    WordTrie();
+
+    /*!
+      \brief Copy constructor. Makes a deep copy of \a other.
+    */
+    WordTrie(const WordTrie &other);
+
+    /*!
+      \brief Copy assignment operator. Makes a deep copy of \a other.
+    */
+    WordTrie &operator=(const WordTrie &other);
+
+    /*!
+      \brief Destructor. Frees all nodes in the trie.
+    */
+    ~WordTrie();
+
+    /*!
+      \brief Adds an alias to the trie.
+
+      \param[in] alias  Specifies the lowercase, space-delimited alias to add.
+                        Empty aliases are ignored.
+    */
+    void insert(const std::string &alias);
+
+    /*!
+      \brief Removes one reference to an alias from the trie.
+
+      Nodes that are no longer part of any alias are freed.
+
+      \param[in] alias  Specifies the lowercase, space-delimited alias to remove.
+
+      \return Returns whether the alias was in the trie.
+    */
+    bool remove(const std::string &alias);
+
+    /*!
+      \brief Finds the longest alias at the start of a token range.
+
+      This function matches the normalized text of the tokens in \a range
+      against the trie, both with and without ignore words, and gets the end
+      of the longest range that matches an alias. When both forms match the
+      same range, the form that includes the ignore words is preferred.
+
+      \param[in]  tokens          Specifies the tokenized input text.
+      \param[in]  range           Specifies the range of tokens to check.
+      \param[out] skipIgnoreWords Set to whether the match was found only
+                                  after omitting ignore words.
+
+      \return Returns the end of the longest matching range, or
+              \a range.start if there is no match.
+    */
+    size_t findLongest(const std::vector<Token> &tokens, const Range &range, bool &skipIgnoreWords) const;
+
+    /*!
+      \brief Clears all aliases in the trie.
+    */
+    void clear();
+
+private:
+    struct Node {
+        std::unordered_map<Symbol, Node *> children;
+        unsigned int count;     // number of references to the alias ending here
+
+        Node() : count(0) { }
+    };
+
+    static Node *copyNode(const Node *node);
+    static void freeNode(Node *node);
+
+    Node *_root;
+};
+
+} }
+#endif
@@ -12,6 +12,7 @@
 #include <Account.hpp>
 #include <string>
 #include <iostream>
+#include <fstream>
 #include <stdio.h>
 
 #include <gtest/gtest.h>
@@ -578,4 +579,73 @@ TEST(AccountTest, MultipleAccounts) {
     remove(fileName.c_str());   // delete the account system file        
 }
 
+/* Testing that changes made after a save are kept without saving again. */
+TEST(AccountTest, AppendedChanges) {
+    legacymud::account::Account acc(fileName);
+
+    /* Create two accounts and save them. */
+    EXPECT_TRUE(acc.createAccount("Linda", "validpassword1", false, 1 ) ) 
+        << "Expect true since this is a valid account creation.";
+    EXPECT_TRUE(acc.createAccount("Kris", "validpassword2", false, 2 ) ) 
+        << "Expect true since this is a valid account creation.";        
+    EXPECT_TRUE(acc.saveToDisk() ) 
+        << "Expect true since nothing should prevent data from being written to disk.";        
+
+    /* Change the accounts without saving. */
+    EXPECT_TRUE(acc.changePassword("Linda", "new\tpassword" ) ) 
+        << "Expect true since this is a valid username.";  
+    EXPECT_TRUE(acc.setAdmin("Linda", true ) ) 
+        << "Expect true since this is a valid username."; 
+    EXPECT_TRUE(acc.deleteAccount("Kris") ) 
+        << "Expect true since the username is valid.";       
+    EXPECT_TRUE(acc.createAccount("Sue", "validpassword3", false, 3 ) ) 
+        << "Expect true since this is a valid account creation.";
+
+    /* Load the accounts into a new account system. */
+    legacymud::account::Account acc2(fileName);
+    EXPECT_TRUE(acc2.initialize() ) 
+        << "Expect true since nothing should prevent data from being loaded from disk.";         
+    EXPECT_EQ(2, acc2.getNumberOfAccounts() ) 
+        << "Expect 2 since one account was deleted and one was created.";  
+    EXPECT_TRUE(acc2.verifyAccount("Linda", "new\tpassword") ) 
+        << "Expect true since the password was changed.";  
+    EXPECT_TRUE(acc2.verifyAdmin("Linda") ) 
+        << "Expect true since this user is now an admin.";  
+    EXPECT_FALSE(acc2.verifyAccount("Kris", "validpassword2") ) 
+        << "Expect false since this user was deleted.";  
+    EXPECT_EQ(3, acc2.getUserId("Sue") ) 
+        << "Expect 3 since this is the correct user id.";        
+
+    remove(fileName.c_str());   // delete the account system file        
+}
+
+/* Testing loading an account file in the older four lines per user format. */
+TEST(AccountTest, OlderFileFormat) {
+    std::ofstream outFile(fileName);
+    outFile << "Linda\nvalidpassword1\ntrue\n1\nKris\nvalidpassword2\nfalse\n2\n";
+    outFile.close();
+
+    legacymud::account::Account acc(fileName);
+    EXPECT_TRUE(acc.initialize() ) 
+        << "Expect true since nothing should prevent data from being loaded from disk.";         
+    EXPECT_EQ(2, acc.getNumberOfAccounts() ) 
+        << "Expect 2 since there are two accounts.";  
+    EXPECT_TRUE(acc.verifyAdmin("Linda") ) 
+        << "Expect true this user is an admin."; 
+    EXPECT_EQ(2, acc.getUserId("Kris") ) 
+        << "Expect 2 since this is the correct user id.";        
+
+    /* Saving converts the file to the new format. */
+    EXPECT_TRUE(acc.saveToDisk() ) 
+        << "Expect true since nothing should prevent data from being written to disk.";        
+    EXPECT_TRUE(acc.initialize() ) 
+        << "Expect true since nothing should prevent data from being loaded from disk.";         
+    EXPECT_EQ(2, acc.getNumberOfAccounts() ) 
+        << "Expect 2 since there are two accounts.";  
+    EXPECT_TRUE(acc.verifyAccount("Kris", "validpassword2") ) 
+        << "Expect true since the username and password are valid.";  
+
+    remove(fileName.c_str());   // delete the account system file        
+}
+
 }
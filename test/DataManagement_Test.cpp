@@ -1,7 +1,7 @@
 /*************************************************************************
  * Author:        Keith Adkins
  * Date Created:  2/20/2017
- * Last Modified: 3/7/2017
+ * Last Modified: 3/14/2017
  * Course:        CS467, Winter 2017
  * Filename:      DataManager_Test.cpp
  *
@@ -10,10 +10,12 @@
  ************************************************************************/
   
 #include <DataManager.hpp>
+#include <Journal.hpp>
 #include <GameObjectManager.hpp> 
 #include <iostream>
 #include <fstream>
 #include <stdio.h>
+#include <unistd.h>
 #include <Area.hpp>
 #include <ArmorType.hpp>
 #include <Container.hpp>
@@ -1524,4 +1526,381 @@ TEST(DataManagementTest, LoadGameWithOneContainer) {
 }
 
 
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Journal - changes recorded after a save are replayed when the game is loaded.
+/////////////////////////////////////////////////////////////////////////////////////////////////// 
+TEST(DataManagementTest, LoadGameReplaysJournal) {
+    legacymud::engine::GameObjectManager* gom = new legacymud::engine::GameObjectManager(); 
+    std::string journalFile = legacymud::gamedata::DataManager::getJournalFilename("gamedata3.txt");
+    remove(journalFile.c_str());
+    
+    // Area (name, short desciption, long description, area size) 
+    legacymud::engine::Area* area = new legacymud::engine::Area("name of area", "short description of area", "longer description", 
+                                                                 legacymud::engine::AreaSize::MEDIUM);   
+                                                                   
+    // ItemType (weight, rarity, description, name, cost, slotType)
+    legacymud::engine::ItemType* itemType = new legacymud::engine::ItemType(25, legacymud::engine::ItemRarity::COMMON, 
+                                                                            "a description", "a name", 2545,
+                                                                            legacymud::engine::EquipmentSlot::BELT);
+                                                                            
+    // Item (location, position, name, itemType)
+    legacymud::engine::Item* changedItem = new legacymud::engine::Item(area, legacymud::engine::ItemPosition::GROUND, "old name", itemType);  
+    legacymud::engine::Item* removedItem = new legacymud::engine::Item(area, legacymud::engine::ItemPosition::GROUND, "removed item", itemType);  
+    
+    // put the objects in the GameObjectManager and save
+    EXPECT_TRUE(gom->addObject(area,-1) ); 
+    EXPECT_TRUE(gom->addObject(itemType,-1) );
+    EXPECT_TRUE(gom->addObject(changedItem,-1) );   
+    EXPECT_TRUE(gom->addObject(removedItem,-1) );   
+    EXPECT_TRUE(dm->saveGame("gamedata3.txt", gom, area->getID()) );     
+
+    // journal a changed object, a new object and a removed object
+    legacymud::gamedata::Journal journal;
+    ASSERT_TRUE(journal.open(journalFile) );
+    legacymud::engine::Item* newItem = new legacymud::engine::Item(area, legacymud::engine::ItemPosition::GROUND, "new item", itemType);  
+    EXPECT_TRUE(gom->addObject(newItem,-1) );
+    EXPECT_TRUE(changedItem->setName("new name") );
+    EXPECT_TRUE(journal.recordObject(changedItem) );
+    EXPECT_TRUE(journal.recordObject(newItem) );
+    EXPECT_TRUE(journal.recordRemoval(removedItem) );
+    EXPECT_TRUE(journal.sync() );
+    journal.close();
+    int nextID = legacymud::engine::InteractiveNoun::getStaticID();
+
+    // simulate a record that was only partly written
+    std::ofstream outFile(journalFile, std::ios::app);
+    outFile << "{\"op\":\"remove\",\"next_id\":1,\"id\":";
+    outFile.close();
+
+    // load the game and check that the journal was applied
+    legacymud::engine::GameObjectManager* newGom = new legacymud::engine::GameObjectManager();   
+    legacymud::engine::InteractiveNoun::setStaticID(0);
+    EXPECT_TRUE(dm->loadGame("gamedata3.txt", newGom, startAreaId) );
+    EXPECT_EQ(nextID, legacymud::engine::InteractiveNoun::getStaticID() );
+    ASSERT_TRUE(newGom->getPointer(changedItem->getID()) != nullptr );
+    EXPECT_EQ("new name", newGom->getPointer(changedItem->getID())->getName() );
+    ASSERT_TRUE(newGom->getPointer(newItem->getID()) != nullptr );
+    EXPECT_EQ("new item", newGom->getPointer(newItem->getID())->getName() );
+    EXPECT_TRUE(newGom->getPointer(removedItem->getID()) == nullptr );
+
+    // clean up
+    delete gom;
+    delete newGom;
+    remove("gamedata3.txt");   
+    remove(journalFile.c_str());   
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Journal - compaction keeps only the records after the checkpoint mark.
+/////////////////////////////////////////////////////////////////////////////////////////////////// 
+TEST(DataManagementTest, CompactJournal) {
+    std::string journalFile = legacymud::gamedata::DataManager::getJournalFilename("gamedata4.txt");
+    remove(journalFile.c_str());
+
+    // Area (name, short desciption, long description, area size) 
+    legacymud::engine::Area* area1 = new legacymud::engine::Area("first area", "short description of area", "longer description", 
+                                                                 legacymud::engine::AreaSize::MEDIUM);   
+    legacymud::engine::Area* area2 = new legacymud::engine::Area("second area", "short description of area", "longer description", 
+                                                                 legacymud::engine::AreaSize::MEDIUM);   
+
+    legacymud::gamedata::Journal journal;
+    ASSERT_TRUE(journal.open(journalFile) );
+    EXPECT_TRUE(journal.recordObject(area1) );
+    long mark = journal.checkpoint();
+    EXPECT_GT(mark, 0);
+    EXPECT_TRUE(journal.recordObject(area2) );
+    EXPECT_TRUE(journal.compact(mark) );
+    EXPECT_TRUE(journal.recordRemoval(area1) );
+    journal.close();
+
+    std::vector<std::string> records;
+    EXPECT_TRUE(legacymud::gamedata::Journal::readRecords(journalFile, records) );
+    ASSERT_EQ(2u, records.size() );
+    EXPECT_NE(std::string::npos, records[0].find("second area") );
+    EXPECT_NE(std::string::npos, records[1].find("\"op\":\"remove\"") );
+
+    // clean up
+    delete area1;
+    delete area2;
+    remove(journalFile.c_str());
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Player files - a player saved on its own is merged when the game is loaded.
+/////////////////////////////////////////////////////////////////////////////////////////////////// 
+TEST(DataManagementTest, LoadGameMergesPlayerFile) {
+    legacymud::engine::GameObjectManager* gom = new legacymud::engine::GameObjectManager(); 
+
+    // Area (name, short desciption, long description, area size) 
+    legacymud::engine::Area* area = new legacymud::engine::Area("name of area", "short description of area", "longer description", 
+                                                                 legacymud::engine::AreaSize::MEDIUM);   
+    // SpecialSkill (name, damage, damageType, cost, cooldown)
+    legacymud::engine::SpecialSkill* skill = new legacymud::engine::SpecialSkill("Fireball", 10, legacymud::engine::DamageType::FIRE, 5, 10);
+    // PlayerClass (primaryStat, name, special skill, attackBonus, armorBonus, resistantTo, weakTo, healPoints)
+    legacymud::engine::PlayerClass* playerClass = new legacymud::engine::PlayerClass(1, "Mage", skill, 0, 0, legacymud::engine::DamageType::FIRE, 
+                                                                                     legacymud::engine::DamageType::WATER, 0);
+    // ItemType (weight, rarity, description, name, cost, slotType)
+    legacymud::engine::ItemType* itemType = new legacymud::engine::ItemType(25, legacymud::engine::ItemRarity::COMMON, 
+                                                                            "a description", "a name", 2545,
+                                                                            legacymud::engine::EquipmentSlot::BELT);
+    // Player (size, playerClass, username, fileDescriptor, maxHealth, spawnLocation, maxSpecialPts, name, description, money, location, maxInventoryWeight)
+    legacymud::engine::Player* player = new legacymud::engine::Player(legacymud::engine::CharacterSize::TINY, playerClass, "Username", -1, 20, area, 20, 
+                                                                      "Character name", "Character description", 100, area, 30);
+    // Item (location, position, name, itemType)
+    legacymud::engine::Item* item = new legacymud::engine::Item(player, legacymud::engine::ItemPosition::INVENTORY, "sword", itemType);  
+    player->addToInventory(item);
+
+    // put the objects in the GameObjectManager and save
+    EXPECT_TRUE(gom->addObject(area,-1) ); 
+    EXPECT_TRUE(gom->addObject(skill,-1) ); 
+    EXPECT_TRUE(gom->addObject(playerClass,-1) ); 
+    EXPECT_TRUE(gom->addObject(itemType,-1) );
+    EXPECT_TRUE(gom->addObject(player,-1) );
+    EXPECT_TRUE(gom->addObject(item,-1) );
+    EXPECT_TRUE(dm->saveGame("gamedata5.txt", gom, area->getID()) );     
+
+    // change the player and save just the player
+    EXPECT_TRUE(player->setMoney(250) );
+    EXPECT_TRUE(item->setName("renamed sword") );
+    EXPECT_TRUE(dm->savePlayer("gamedata5.txt", player) );
+    legacymud::gamedata::DataManager::waitForPlayerSaves();
+    std::string playerFile = legacymud::gamedata::DataManager::getPlayerFilename("gamedata5.txt", player->getID());
+    std::ifstream playerIn(playerFile);
+    EXPECT_TRUE(playerIn.is_open() );
+    playerIn.close();
+
+    // load the game and check that the player file was merged
+    legacymud::engine::GameObjectManager* newGom = new legacymud::engine::GameObjectManager();   
+    EXPECT_TRUE(dm->loadGame("gamedata5.txt", newGom, startAreaId) );
+    legacymud::engine::Player* loadedPlayer = static_cast<legacymud::engine::Player*>(newGom->getPointer(player->getID()));
+    ASSERT_TRUE(loadedPlayer != nullptr );
+    EXPECT_EQ(250, loadedPlayer->getMoney() );
+    ASSERT_TRUE(newGom->getPointer(item->getID()) != nullptr );
+    EXPECT_EQ("renamed sword", newGom->getPointer(item->getID())->getName() );
+
+    // a full save covers the player, so its own file is removed
+    EXPECT_TRUE(dm->saveGame("gamedata5.txt", newGom, startAreaId) );
+    playerIn.open(playerFile);
+    EXPECT_FALSE(playerIn.is_open() );
+
+    // clean up
+    delete gom;
+    delete newGom;
+    remove("gamedata5.txt");   
+    rmdir(legacymud::gamedata::DataManager::getPlayerDirectory("gamedata5.txt").c_str());
+}
+
+
+// Test evicting a player to its own file and loading it back into a running game.
+TEST(DataManagementTest, LoadPlayerFromPlayerFile) {
+    legacymud::engine::GameObjectManager* gom = new legacymud::engine::GameObjectManager(); 
+
+    // Area (name, short desciption, long description, area size) 
+    legacymud::engine::Area* area = new legacymud::engine::Area("name of area", "short description of area", "longer description", 
+                                                                 legacymud::engine::AreaSize::MEDIUM);   
+    // SpecialSkill (name, damage, damageType, cost, cooldown)
+    legacymud::engine::SpecialSkill* skill = new legacymud::engine::SpecialSkill("Fireball", 10, legacymud::engine::DamageType::FIRE, 5, 10);
+    // PlayerClass (primaryStat, name, special skill, attackBonus, armorBonus, resistantTo, weakTo, healPoints)
+    legacymud::engine::PlayerClass* playerClass = new legacymud::engine::PlayerClass(1, "Mage", skill, 0, 0, legacymud::engine::DamageType::FIRE, 
+                                                                                     legacymud::engine::DamageType::WATER, 0);
+    // ItemType (weight, rarity, description, name, cost, slotType)
+    legacymud::engine::ItemType* itemType = new legacymud::engine::ItemType(25, legacymud::engine::ItemRarity::COMMON, 
+                                                                            "a description", "a name", 2545,
+                                                                            legacymud::engine::EquipmentSlot::BELT);
+    // Player (size, playerClass, username, fileDescriptor, maxHealth, spawnLocation, maxSpecialPts, name, description, money, location, maxInventoryWeight)
+    legacymud::engine::Player* player = new legacymud::engine::Player(legacymud::engine::CharacterSize::TINY, playerClass, "Evicted", -1, 20, area, 20, 
+                                                                      "Character name", "Character description", 75, area, 30);
+    // Item (location, position, name, itemType)
+    legacymud::engine::Item* item = new legacymud::engine::Item(player, legacymud::engine::ItemPosition::INVENTORY, "dagger", itemType);  
+    player->addToInventory(item);
+    int playerId = player->getID();
+    int itemId = item->getID();
+
+    EXPECT_TRUE(gom->addObject(area,-1) ); 
+    EXPECT_TRUE(gom->addObject(skill,-1) ); 
+    EXPECT_TRUE(gom->addObject(playerClass,-1) ); 
+    EXPECT_TRUE(gom->addObject(itemType,-1) );
+    EXPECT_TRUE(gom->addObject(player,-1) );
+    EXPECT_TRUE(gom->addObject(item,-1) );
+
+    // write the player to its own file and evict it
+    EXPECT_TRUE(dm->savePlayer("gamedata6.txt", player) );
+    legacymud::gamedata::DataManager::waitForPlayerSaves();
+    EXPECT_TRUE(gom->removeObject(item, -1) );
+    EXPECT_TRUE(gom->removeObject(player, -1) );
+    EXPECT_TRUE(gom->getPointer(playerId) == nullptr );
+    EXPECT_TRUE(gom->getPlayerByUsername("Evicted") == nullptr );
+
+    // load the player back from its file
+    legacymud::engine::Player* loadedPlayer = dm->loadPlayer("gamedata6.txt", playerId, gom);
+    ASSERT_TRUE(loadedPlayer != nullptr );
+    EXPECT_EQ(loadedPlayer, gom->getPlayerByUsername("Evicted") );
+    EXPECT_EQ(75, loadedPlayer->getMoney() );
+    EXPECT_EQ(area, loadedPlayer->getLocation() );
+    ASSERT_EQ(1, loadedPlayer->getInventory().size() );
+    EXPECT_EQ(itemId, loadedPlayer->getInventory()[0].second->getID() );
+    EXPECT_EQ("dagger", loadedPlayer->getInventory()[0].second->getName() );
+
+    // a player that is already in the game is not loaded twice
+    EXPECT_TRUE(dm->loadPlayer("gamedata6.txt", playerId, gom) == nullptr );
+
+    // clean up
+    delete gom;
+    remove(legacymud::gamedata::DataManager::getPlayerFilename("gamedata6.txt", playerId).c_str());
+    rmdir(legacymud::gamedata::DataManager::getPlayerDirectory("gamedata6.txt").c_str());
+}
+
+
+// Test that saving a player many times in a row leaves only the newest version on disk.
+TEST(DataManagementTest, RepeatedPlayerSavesKeepNewest) {
+    legacymud::engine::GameObjectManager* gom = new legacymud::engine::GameObjectManager(); 
+
+    // Area (name, short desciption, long description, area size) 
+    legacymud::engine::Area* area = new legacymud::engine::Area("name of area", "short description of area", "longer description", 
+                                                                 legacymud::engine::AreaSize::MEDIUM);   
+    // SpecialSkill (name, damage, damageType, cost, cooldown)
+    legacymud::engine::SpecialSkill* skill = new legacymud::engine::SpecialSkill("Fireball", 10, legacymud::engine::DamageType::FIRE, 5, 10);
+    // PlayerClass (primaryStat, name, special skill, attackBonus, armorBonus, resistantTo, weakTo, healPoints)
+    legacymud::engine::PlayerClass* playerClass = new legacymud::engine::PlayerClass(1, "Mage", skill, 0, 0, legacymud::engine::DamageType::FIRE, 
+                                                                                     legacymud::engine::DamageType::WATER, 0);
+    // Player (size, playerClass, username, fileDescriptor, maxHealth, spawnLocation, maxSpecialPts, name, description, money, location, maxInventoryWeight)
+    legacymud::engine::Player* player = new legacymud::engine::Player(legacymud::engine::CharacterSize::TINY, playerClass, "Saver", -1, 20, area, 20, 
+                                                                      "Character name", "Character description", 0, area, 30);
+    int playerId = player->getID();
+
+    EXPECT_TRUE(gom->addObject(area,-1) ); 
+    EXPECT_TRUE(gom->addObject(skill,-1) ); 
+    EXPECT_TRUE(gom->addObject(playerClass,-1) ); 
+    EXPECT_TRUE(gom->addObject(player,-1) );
+
+    // queue many saves without waiting; a queued save is loaded before it is written
+    for (int money = 1; money <= 200; money++) {
+        EXPECT_TRUE(player->setMoney(money) );
+        EXPECT_TRUE(dm->savePlayer("gamedata8.txt", player) );
+    }
+    EXPECT_TRUE(gom->removeObject(player, -1) );
+    legacymud::engine::Player* loadedPlayer = dm->loadPlayer("gamedata8.txt", playerId, gom);
+    ASSERT_TRUE(loadedPlayer != nullptr );
+    EXPECT_EQ(200, loadedPlayer->getMoney() );
+
+    // once written, the file holds the newest version and no temporary file is left
+    legacymud::gamedata::DataManager::waitForPlayerSaves();
+    std::string playerFile = legacymud::gamedata::DataManager::getPlayerFilename("gamedata8.txt", playerId);
+    std::ifstream tempIn(playerFile + ".tmp");
+    EXPECT_FALSE(tempIn.is_open() );
+    EXPECT_TRUE(gom->removeObject(loadedPlayer, -1) );
+    loadedPlayer = dm->loadPlayer("gamedata8.txt", playerId, gom);
+    ASSERT_TRUE(loadedPlayer != nullptr );
+    EXPECT_EQ(200, loadedPlayer->getMoney() );
+
+    // clean up
+    delete gom;
+    remove(playerFile.c_str());
+    rmdir(legacymud::gamedata::DataManager::getPlayerDirectory("gamedata8.txt").c_str());
+}
+
+
+// Test paging a zone out to its own file and back into a loaded game.
+TEST(DataManagementTest, SaveAndLoadZone) {
+    legacymud::engine::GameObjectManager* gom = new legacymud::engine::GameObjectManager(); 
+
+    // Area (name, short desciption, long description, area size) 
+    legacymud::engine::Area* area1 = new legacymud::engine::Area("zone area", "short description of area", "longer description", 
+                                                                  legacymud::engine::AreaSize::MEDIUM);   
+    legacymud::engine::Area* area2 = new legacymud::engine::Area("start area", "short description of area", "longer description", 
+                                                                  legacymud::engine::AreaSize::MEDIUM);   
+    // SpecialSkill (name, damage, damageType, cost, cooldown)
+    legacymud::engine::SpecialSkill* skill = new legacymud::engine::SpecialSkill("Bite", 10, legacymud::engine::DamageType::PIERCING, 5, 10);
+    // CreatureType (size, difficulty, name, skill, attackBonus, armorBonus, resistantTo, weakTo, healPoints)
+    legacymud::engine::CreatureType* creatureType = new legacymud::engine::CreatureType(legacymud::engine::CharacterSize::SMALL, 
+                                                                                        legacymud::engine::XPTier::NORMAL, "wolf", skill, 1, 2,
+                                                                                        legacymud::engine::DamageType::WATER, 
+                                                                                        legacymud::engine::DamageType::FIRE, 1.5);
+    // ItemType (weight, rarity, description, name, cost, slotType)
+    legacymud::engine::ItemType* itemType = new legacymud::engine::ItemType(1, legacymud::engine::ItemRarity::COMMON, 
+                                                                            "a description", "a name", 5,
+                                                                            legacymud::engine::EquipmentSlot::NONE);
+    // Exit (direction, location, connectArea, isConditional, conditionItem, description, altDescription)
+    legacymud::engine::Exit* exit = new legacymud::engine::Exit(legacymud::engine::ExitDirection::NORTH, area1, area2, false, nullptr,
+                                                                "a path", "a path");
+    area1->addExit(exit);
+    // Feature (name, placement, location, isConditional, conditionItem, description, altDescription)
+    legacymud::engine::Feature* feature = new legacymud::engine::Feature("tree", "in the middle", area1, false, nullptr, 
+                                                                          "a tall tree", "a tall tree");
+    area1->addFeature(feature);
+    // Container (capacity, location, position, name, itemType) holding an Item (location, position, name, itemType)
+    legacymud::engine::Container* container = new legacymud::engine::Container(10, area1, legacymud::engine::ItemPosition::GROUND, "chest", itemType);
+    area1->addItem(container);
+    legacymud::engine::Item* coin = new legacymud::engine::Item(container, legacymud::engine::ItemPosition::IN, "coin", itemType);
+    container->place(coin, legacymud::engine::ItemPosition::IN);
+    // Creature (creatureType, ambulatory, maxHealth, spawnLocation, maxSpecialPts, name, description, money, location, maxInventoryWeight)
+    legacymud::engine::Creature* creature = new legacymud::engine::Creature(creatureType, true, 20, area1, 10, "grey wolf", "a wolf", 0, area1, 10);
+    area1->addCharacter(creature);
+    legacymud::engine::Item* bone = new legacymud::engine::Item(creature, legacymud::engine::ItemPosition::INVENTORY, "bone", itemType);
+    creature->addToInventory(bone);
+
+    std::vector<legacymud::engine::InteractiveNoun*> contents = { exit, feature, creature, container, coin, bone };
+    for (auto object : { static_cast<legacymud::engine::InteractiveNoun*>(area1), static_cast<legacymud::engine::InteractiveNoun*>(area2),
+                         static_cast<legacymud::engine::InteractiveNoun*>(skill), static_cast<legacymud::engine::InteractiveNoun*>(creatureType),
+                         static_cast<legacymud::engine::InteractiveNoun*>(itemType) }) {
+        EXPECT_TRUE(gom->addObject(object,-1) );
+    }
+    for (auto object : contents) {
+        EXPECT_TRUE(gom->addObject(object,-1) );
+    }
+    EXPECT_TRUE(dm->saveGame("gamedata7.txt", gom, area2->getID()) );     
+
+    // page the zone out
+    int zoneId = area1->getID();
+    EXPECT_TRUE(dm->saveZone("gamedata7.txt", zoneId, { area1 }, contents) );
+    auto zones = legacymud::gamedata::DataManager::getSavedZones("gamedata7.txt");
+    ASSERT_EQ(1, zones.size() );
+    ASSERT_EQ(1, zones[zoneId].size() );
+    EXPECT_EQ(zoneId, zones[zoneId][0] );
+
+    // a load leaves the paged out objects out of the game
+    legacymud::engine::GameObjectManager* newGom = new legacymud::engine::GameObjectManager();   
+    EXPECT_TRUE(dm->loadGame("gamedata7.txt", newGom, startAreaId) );
+    legacymud::engine::Area* loadedArea = static_cast<legacymud::engine::Area*>(newGom->getPointer(zoneId));
+    ASSERT_TRUE(loadedArea != nullptr );
+    for (auto object : contents) {
+        EXPECT_TRUE(newGom->getPointer(object->getID()) == nullptr );
+    }
+    EXPECT_EQ(0, loadedArea->getExits().size() );
+    EXPECT_EQ(0, loadedArea->getFeatures().size() );
+    EXPECT_EQ(0, loadedArea->getItems().size() );
+    EXPECT_EQ(0, loadedArea->getCharacters().size() );
+
+    // page the zone back in
+    std::vector<legacymud::engine::InteractiveNoun*> loaded;
+    EXPECT_TRUE(dm->loadZone("gamedata7.txt", zoneId, newGom, loaded) );
+    EXPECT_EQ(contents.size(), loaded.size() );
+    for (auto object : contents) {
+        EXPECT_TRUE(newGom->getPointer(object->getID()) != nullptr );
+    }
+    ASSERT_EQ(1, loadedArea->getExits().size() );
+    EXPECT_EQ(newGom->getPointer(area2->getID()), loadedArea->getExits()[0]->getConnectArea() );
+    EXPECT_EQ(1, loadedArea->getFeatures().size() );
+    ASSERT_EQ(1, loadedArea->getItems().size() );
+    ASSERT_EQ(legacymud::engine::ObjectType::CONTAINER, loadedArea->getItems()[0]->getObjectType() );
+    EXPECT_EQ(1, static_cast<legacymud::engine::Container*>(loadedArea->getItems()[0])->getAllContents().size() );
+    ASSERT_EQ(1, loadedArea->getCharacters().size() );
+    EXPECT_EQ(1, loadedArea->getCharacters()[0]->getInventory().size() );
+
+    // objects that are already loaded are not loaded twice
+    loaded.clear();
+    EXPECT_FALSE(dm->loadZone("gamedata7.txt", zoneId, newGom, loaded) );
+    EXPECT_TRUE(dm->deleteZone("gamedata7.txt", zoneId) );
+    EXPECT_EQ(0, legacymud::gamedata::DataManager::getSavedZones("gamedata7.txt").size() );
+
+    // clean up
+    delete gom;
+    delete newGom;
+    remove("gamedata7.txt");   
+    rmdir(legacymud::gamedata::DataManager::getZoneDirectory("gamedata7.txt").c_str());
+}
+
+
 }
@@ -308,7 +308,7 @@ engine::GameObjectManager *GameLogicShim::getGameObjectManager() {
     return _logic->manager;
 }
 
-std::queue<std::pair<std::string, int>> *GameLogicShim::getMessageQueue() {
+std::queue<engine::ParsedMessage> *GameLogicShim::getMessageQueue() {
     return &_logic->messageQueue;
 }
 }}
\ No newline at end of file
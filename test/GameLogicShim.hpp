@@ -816,7 +816,7 @@ class GameLogicShim {
 
         engine::GameObjectManager *getGameObjectManager();
 
-        std::queue<std::pair<std::string, int>> *getMessageQueue();
+        std::queue<engine::ParsedMessage> *getMessageQueue();
 
     private:
         engine::GameLogic *_logic;
@@ -14,6 +14,7 @@
 #include <ArmorType.hpp>
 
 #include <gtest/gtest.h>
+#include <thread>
 
 namespace {
 
@@ -41,6 +42,25 @@ TEST(CharacterTest, SetNameTest) {
     EXPECT_STREQ("foo bar", npc.getName().c_str());
 }
 
+// Verify that the noun aliases match the name after concurrent renames
+TEST(CharacterTest, ConcurrentSetNameTest) {
+    engine::Area area;
+    engine::NonCombatant npc(nullptr, "name", "description", 10, &area, 100);
+    auto rename = [&npc](std::string name) {
+        for (int i = 0; i < 1000; ++i) {
+            npc.setName(name + std::to_string(i % 10));
+        }
+    };
+    std::thread first(rename, "foo");
+    std::thread second(rename, "bar");
+    first.join();
+    second.join();
+
+    // the ID alias and the current name
+    ASSERT_EQ(2, npc.getNounAliases().size());
+    EXPECT_EQ(npc.getName(), npc.getNounAliases()[1]);
+}
+
 // Verify that the description is correctly changed
 TEST(CharacterTest, SetDescriptionTest) {
     engine::NonCombatant npc;
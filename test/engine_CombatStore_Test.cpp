@@ -0,0 +1,138 @@
+/*!
+  \file     engine_CombatStore_Test.cpp
+  \author   agent
+  \created  10/19/2026
+  \modified 10/19/2026
+ 
+  \details  This file contains the unit tests for the CombatStore class.
+*/
+
+#include <CombatStore.hpp>
+#include <Creature.hpp>
+
+#include <vector>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+namespace engine = legacymud::engine;
+
+// Verify health and special points stay between 0 and the maximum
+TEST(CombatStoreTest, HealthLimitsTest) {
+    int slot = engine::CombatStore::addCombatant(10, 5);
+    EXPECT_EQ(10, engine::CombatStore::getCurrentHealth(slot));
+    EXPECT_EQ(5, engine::CombatStore::getCurrentSpecialPts(slot));
+
+    EXPECT_EQ(0, engine::CombatStore::subtractFromCurrentHealth(slot, 20));
+    EXPECT_EQ(10, engine::CombatStore::addToCurrentHealth(slot, 20));
+    EXPECT_EQ(2, engine::CombatStore::subtractFromCurrSpecialPts(slot, 3));
+    EXPECT_EQ(5, engine::CombatStore::addToCurrentSpecialPts(slot, 10));
+
+    engine::CombatStore::addToMaxHealth(slot, 5);
+    EXPECT_EQ(15, engine::CombatStore::getMaxHealth(slot));
+    EXPECT_EQ(15, engine::CombatStore::addToCurrentHealth(slot, 10));
+    engine::CombatStore::removeCombatant(slot);
+}
+
+// Verify removed slots are reused
+TEST(CombatStoreTest, ReuseSlotTest) {
+    int numCombatants = engine::CombatStore::getNumCombatants();
+    int slot = engine::CombatStore::addCombatant(10, 10);
+    EXPECT_EQ(numCombatants + 1, engine::CombatStore::getNumCombatants());
+    engine::CombatStore::removeCombatant(slot);
+    EXPECT_EQ(numCombatants, engine::CombatStore::getNumCombatants());
+
+    int newSlot = engine::CombatStore::addCombatant(20, 20);
+    EXPECT_EQ(slot, newSlot);
+    EXPECT_EQ(20, engine::CombatStore::getCurrentHealth(newSlot));
+    engine::CombatStore::removeCombatant(newSlot);
+}
+
+// Verify regenerating a list skips dead combatants and waits for the interval
+TEST(CombatStoreTest, RegenSweepTest) {
+    time_t now = 1000;
+    std::vector<int> slots;
+    slots.push_back(engine::CombatStore::addCombatant(10, 10));
+    slots.push_back(engine::CombatStore::addCombatant(10, 10));
+    engine::CombatStore::subtractFromCurrentHealth(slots[0], 5);
+    engine::CombatStore::subtractFromCurrSpecialPts(slots[0], 5);
+    engine::CombatStore::subtractFromCurrentHealth(slots[1], 10);
+
+    EXPECT_EQ(1, engine::CombatStore::regen(slots, now));
+    EXPECT_EQ(6, engine::CombatStore::getCurrentHealth(slots[0]));
+    EXPECT_EQ(6, engine::CombatStore::getCurrentSpecialPts(slots[0]));
+    EXPECT_EQ(0, engine::CombatStore::getCurrentHealth(slots[1]));
+
+    EXPECT_EQ(0, engine::CombatStore::regen(slots, now + engine::CombatStore::REGEN_INTERVAL - 1));
+    EXPECT_EQ(1, engine::CombatStore::regen(slots, now + engine::CombatStore::REGEN_INTERVAL));
+    EXPECT_EQ(7, engine::CombatStore::getCurrentHealth(slots[0]));
+
+    for (auto slot : slots) {
+        engine::CombatStore::removeCombatant(slot);
+    }
+}
+
+// Verify regenerating a list can include combatants with no health
+TEST(CombatStoreTest, RegenSweepIncludingDeadTest) {
+    time_t now = 1000;
+    std::vector<int> slots;
+    slots.push_back(engine::CombatStore::addCombatant(10, 10));
+    engine::CombatStore::subtractFromCurrentHealth(slots[0], 10);
+
+    EXPECT_EQ(0, engine::CombatStore::regen(slots, now));
+    EXPECT_EQ(1, engine::CombatStore::regen(slots, now, false));
+    EXPECT_EQ(1, engine::CombatStore::getCurrentHealth(slots[0]));
+
+    engine::CombatStore::removeCombatant(slots[0]);
+}
+
+// Verify slots in more than one segment keep their own state
+TEST(CombatStoreTest, ManySegmentsTest) {
+    std::vector<int> slots;
+    for (int i = 0; i < engine::CombatStore::SEGMENT_SIZE + 1; ++i) {
+        slots.push_back(engine::CombatStore::addCombatant(i + 1, 1));
+    }
+    for (int i = 0; i < engine::CombatStore::SEGMENT_SIZE + 1; ++i) {
+        EXPECT_EQ(i + 1, engine::CombatStore::getMaxHealth(slots[i]));
+    }
+
+    for (auto slot : slots) {
+        engine::CombatStore::removeCombatant(slot);
+    }
+}
+
+// Verify concurrent damage to one combatant is not lost
+TEST(CombatStoreTest, ConcurrentDamageTest) {
+    int slot = engine::CombatStore::addCombatant(20000, 0);
+    auto attack = [slot]() {
+        for (int i = 0; i < 5000; ++i) {
+            engine::CombatStore::subtractFromCurrentHealth(slot, 1);
+        }
+    };
+    std::thread first(attack);
+    std::thread second(attack);
+    first.join();
+    second.join();
+    EXPECT_EQ(10000, engine::CombatStore::getCurrentHealth(slot));
+    engine::CombatStore::removeCombatant(slot);
+}
+
+// Verify combatants keep their state in their own slot
+TEST(CombatStoreTest, CombatantSlotTest) {
+    engine::Creature creature;
+    engine::Creature other;
+    EXPECT_NE(creature.getCombatSlot(), other.getCombatSlot());
+
+    creature.subtractFromCurrentHealth(3);
+    EXPECT_EQ(creature.getMaxHealth() - 3, engine::CombatStore::getCurrentHealth(creature.getCombatSlot()));
+    EXPECT_EQ(other.getMaxHealth(), other.getCurrentHealth());
+
+    EXPECT_TRUE(creature.cooldownIsZero());
+    creature.setCooldown(60);
+    EXPECT_FALSE(creature.cooldownIsZero());
+    EXPECT_TRUE(other.cooldownIsZero());
+}
+
+}
@@ -18,13 +18,21 @@
 #include <SpecialSkill.hpp>
 #include <GameObjectManager.hpp>
 #include <NonCombatant.hpp>
+#include <Creature.hpp>
+#include <Feature.hpp>
+#include <Item.hpp>
+#include <ItemType.hpp>
+#include <DataManager.hpp>
+#include <Journal.hpp>
 
 #include <ParseResult.hpp>
 #include <VerbType.hpp>
+#include <WordManager.hpp>
 
 #include <gtest/gtest.h>
 
 #include <fstream>
+#include <unistd.h>
 
 namespace {
 
@@ -32,6 +40,7 @@ namespace engine = legacymud::engine;
 namespace parser = legacymud::parser;
 namespace test = legacymud::test;
 namespace account = legacymud::account;
+namespace gamedata = legacymud::gamedata;
 
 engine::GameLogic *logic = nullptr;
 test::GameLogicShim *shim = nullptr;
@@ -49,6 +58,7 @@ public:
         // Clean up serialized data
         remove("game.dat");
         remove("game.dat.accounts");
+        remove("game.dat.journal");
     }
 
     virtual void SetUp() {
@@ -67,6 +77,9 @@ public:
         logic = nullptr;
         server = nullptr;
         acct = nullptr;
+
+        // the journal refers to test objects that were never saved to game.dat
+        remove("game.dat.journal");
     }
 
 };
@@ -102,6 +115,142 @@ TEST_F(GameLogicTest, LoadAndHibernatePlayerTest) {
     ASSERT_TRUE(shim->hibernatePlayer(player));
     // Player should now be inactive
     EXPECT_FALSE(player->isActive());
+    // Player should have been saved to its own file
+    gamedata::DataManager::waitForPlayerSaves();
+    std::string playerFile = gamedata::DataManager::getPlayerFilename("game.dat", player->getID());
+    std::ifstream inFile(playerFile);
+    EXPECT_TRUE(inFile.is_open());
+    inFile.close();
+    remove(playerFile.c_str());
+    rmdir(gamedata::DataManager::getPlayerDirectory("game.dat").c_str());
+}
+
+// Verify a hibernated player is journaled after any older records of it
+TEST_F(GameLogicTest, HibernateJournalsPlayerTest) {
+    ASSERT_TRUE(logic->startGame(true, "game.dat", server, acct));
+    engine::Area *area = new engine::Area("Area", "Short description", "Long description", engine::AreaSize::SMALL);
+    engine::SpecialSkill *skill = new engine::SpecialSkill("Fireball", 10, engine::DamageType::FIRE, 5, 10);
+    engine::PlayerClass *playerClass = new engine::PlayerClass(1, "Mage", skill, 0, 0, engine::DamageType::FIRE, engine::DamageType::WATER, 0);
+    engine::Player *player = new engine::Player(engine::CharacterSize::TINY, playerClass, "Journaled", 0, 20, area, 20, "Journaled name", "Character description", 100, area, 30);
+    player->setActive(false);
+    shim->getGameObjectManager()->addObject(area, -1);
+    shim->getGameObjectManager()->addObject(skill, -1);
+    shim->getGameObjectManager()->addObject(playerClass, -1);
+    shim->getGameObjectManager()->addObject(player, -1);
+    ASSERT_TRUE(shim->loadPlayer(player, 0));
+
+    // experience points are only saved with the player
+    player->addToExperiencePts(25);
+    ASSERT_TRUE(shim->hibernatePlayer(player));
+    int playerId = player->getID();
+
+    // closing the game makes the journal durable
+    delete shim;
+    delete logic;
+    shim = nullptr;
+    logic = nullptr;
+
+    std::vector<std::string> records;
+    std::string lastPlayerRecord;
+    ASSERT_TRUE(gamedata::Journal::readRecords(gamedata::DataManager::getJournalFilename("game.dat"), records));
+    for (auto &record : records){
+        if (record.find("\"username\":\"Journaled\"") != std::string::npos){
+            lastPlayerRecord = record;
+        }
+    }
+    EXPECT_NE(std::string::npos, lastPlayerRecord.find("\"experience_points\":25"));
+
+    remove(gamedata::DataManager::getPlayerFilename("game.dat", playerId).c_str());
+    rmdir(gamedata::DataManager::getPlayerDirectory("game.dat").c_str());
+}
+
+// Verify an evicted player leaves nothing behind that points at it
+TEST_F(GameLogicTest, EvictIdlePlayerTest) {
+    ASSERT_TRUE(logic->startGame(true, "game.dat", server, acct));
+    engine::Area *area = new engine::Area("Area", "Short description", "Long description", engine::AreaSize::SMALL);
+    engine::SpecialSkill *skill = new engine::SpecialSkill("Fireball", 10, engine::DamageType::FIRE, 5, 10);
+    engine::PlayerClass *playerClass = new engine::PlayerClass(1, "Mage", skill, 0, 0, engine::DamageType::FIRE, engine::DamageType::WATER, 0);
+    engine::Player *player = new engine::Player(engine::CharacterSize::TINY, playerClass, "Evicted", 0, 20, area, 20, "Evicted name", "Character description", 100, area, 30);
+    engine::ItemType *itemType = new engine::ItemType(1, engine::ItemRarity::COMMON, "Item description", "Evict type", 1, engine::EquipmentSlot::NONE);
+    engine::Item *item = new engine::Item(player, engine::ItemPosition::INVENTORY, "evictwidget", itemType);
+    engine::Creature *creature = new engine::Creature();
+    player->setActive(false);
+    player->addToInventory(item);
+    shim->getGameObjectManager()->addObject(area, -1);
+    shim->getGameObjectManager()->addObject(skill, -1);
+    shim->getGameObjectManager()->addObject(playerClass, -1);
+    shim->getGameObjectManager()->addObject(itemType, -1);
+    shim->getGameObjectManager()->addObject(player, -1);
+    shim->getGameObjectManager()->addObject(item, -1);
+    shim->getGameObjectManager()->addObject(creature, -1);
+    ASSERT_TRUE(shim->loadPlayer(player, 0));
+    ASSERT_TRUE(shim->hibernatePlayer(player));
+    creature->setInCombat(player);
+    ASSERT_EQ(1, parser::WordManager::getLocalNouns("evictwidget").size());
+    ASSERT_EQ(1, parser::WordManager::getLocalNouns("evicted name").size());
+    int playerId = player->getID();
+
+    logic->setPlayerEvictionTimeout(0);
+    EXPECT_EQ(1, logic->evictIdlePlayers());
+    EXPECT_TRUE(creature->getInCombat() == nullptr);
+    EXPECT_TRUE(parser::WordManager::getLocalNouns("evictwidget").empty());
+    EXPECT_TRUE(parser::WordManager::getLocalNouns("evicted name").empty());
+
+    gamedata::DataManager::waitForPlayerSaves();
+    remove(gamedata::DataManager::getPlayerFilename("game.dat", playerId).c_str());
+    rmdir(gamedata::DataManager::getPlayerDirectory("game.dat").c_str());
+    parser::WordManager::resetAll();
+}
+
+// Verify a paged out zone leaves no aliases behind and registers them once when paged in
+TEST_F(GameLogicTest, PageZoneOutAndInTest) {
+    ASSERT_TRUE(logic->startGame(true, "game.dat", server, acct));
+    engine::Area *area = new engine::Area("Area", "Short description", "Long description", engine::AreaSize::SMALL);
+    engine::Area *zoneArea = new engine::Area("Zone area", "Short description", "Long description", engine::AreaSize::SMALL);
+    engine::SpecialSkill *skill = new engine::SpecialSkill("Fireball", 10, engine::DamageType::FIRE, 5, 10);
+    engine::PlayerClass *playerClass = new engine::PlayerClass(1, "Mage", skill, 0, 0, engine::DamageType::FIRE, engine::DamageType::WATER, 0);
+    engine::Player *player = new engine::Player(engine::CharacterSize::TINY, playerClass, "Zoner", 0, 20, area, 20, "Zoner name", "Character description", 100, area, 30);
+    engine::ItemType *itemType = new engine::ItemType(1, engine::ItemRarity::COMMON, "Item description", "Zone type", 1, engine::EquipmentSlot::NONE);
+    engine::Item *item = new engine::Item(zoneArea, engine::ItemPosition::GROUND, "zoneitem", itemType);
+    engine::Feature *feature = new engine::Feature("zonefeature", "on the wall", zoneArea, false, nullptr, "Feature description", "Alt description");
+    zoneArea->addItem(item);
+    zoneArea->addFeature(feature);
+    player->setActive(false);
+    shim->getGameObjectManager()->addObject(area, -1);
+    shim->getGameObjectManager()->addObject(zoneArea, -1);
+    shim->getGameObjectManager()->addObject(skill, -1);
+    shim->getGameObjectManager()->addObject(playerClass, -1);
+    shim->getGameObjectManager()->addObject(itemType, -1);
+    shim->getGameObjectManager()->addObject(player, -1);
+    shim->getGameObjectManager()->addObject(item, -1);
+    shim->getGameObjectManager()->addObject(feature, -1);
+    ASSERT_TRUE(shim->loadPlayer(player, 0));
+    area->addCharacter(player);
+    player->setEditMode(true);
+
+    // the first pass only records when each area was last occupied
+    logic->setZoneEvictionTimeout(0);
+    EXPECT_EQ(0, logic->evictIdleZones());
+    EXPECT_EQ(1, logic->evictIdleZones());
+    EXPECT_TRUE(zoneArea->getItems().empty());
+    EXPECT_TRUE(parser::WordManager::getLocalNouns("zoneitem").empty());
+    EXPECT_TRUE(parser::WordManager::getLocalNouns("zonefeature").empty());
+
+    // entering the area pages its zone back in
+    ASSERT_TRUE(shim->warpCommand(player, zoneArea));
+    EXPECT_EQ(zoneArea, player->getLocation());
+    EXPECT_EQ(1, zoneArea->getItems().size());
+    EXPECT_EQ(1, parser::WordManager::getLocalNouns("zoneitem").size());
+    EXPECT_EQ(1, parser::WordManager::getLocalNouns("zonefeature").size());
+
+    // only the area the player left can be paged out now
+    EXPECT_EQ(1, logic->evictIdleZones());
+    EXPECT_EQ(1, zoneArea->getItems().size());
+    EXPECT_EQ(1, parser::WordManager::getLocalNouns("zoneitem").size());
+
+    remove(gamedata::DataManager::getZoneFilename("game.dat", area->getID()).c_str());
+    rmdir(gamedata::DataManager::getZoneDirectory("game.dat").c_str());
+    parser::WordManager::resetAll();
 }
 
 TEST_F(GameLogicTest, GetPlayerMessageFromHandler) {
@@ -123,7 +272,38 @@ TEST_F(GameLogicTest, GetPlayerMessageFromHandler) {
     EXPECT_TRUE(player->isActive());
     // Send a message via handler
     ASSERT_TRUE(logic->receivedMessageHandler("foo message", 0));
-    EXPECT_STREQ("foo message", shim->getMessageQueue()->front().first.c_str());
+    EXPECT_STREQ("foo message", shim->getMessageQueue()->front().message.c_str());
+    // Message should have been parsed by the receiving thread
+    EXPECT_TRUE(shim->getMessageQueue()->front().parsed);
+    ASSERT_EQ(1, shim->getMessageQueue()->front().results.size());
+    EXPECT_EQ(parser::ParseStatus::INVALID_VERB, shim->getMessageQueue()->front().results[0].status);
+}
+
+TEST_F(GameLogicTest, QueueMoreMessagesThanGuardSlots) {
+    // Start game and load minimum objects
+    ASSERT_TRUE(logic->startGame(true, "game.dat", server, acct));
+    engine::Area *area = new engine::Area("Area", "Short description", "Long description", engine::AreaSize::SMALL);
+    engine::SpecialSkill *skill = new engine::SpecialSkill("Fireball", 10, engine::DamageType::FIRE, 5, 10);
+    engine::PlayerClass *playerClass = new engine::PlayerClass(1, "Mage", skill, 0, 0, engine::DamageType::FIRE, engine::DamageType::WATER, 0);
+    engine::Player *player = new engine::Player(engine::CharacterSize::TINY, playerClass, "Username", 0, 20, area, 20, "Character name", "Character description", 100, area, 30);
+    player->setActive(false);
+    shim->getGameObjectManager()->addObject(area, -1);
+    shim->getGameObjectManager()->addObject(skill, -1);
+    shim->getGameObjectManager()->addObject(playerClass, -1);
+    shim->getGameObjectManager()->addObject(player, -1);
+    ASSERT_TRUE(shim->loadPlayer(player, 0));
+
+    // Queued messages must not use up the guard slots
+    int numMessages = engine::EpochManager::GUARDS_PER_BLOCK + 1;
+    for (int i = 0; i < numMessages; ++i) {
+        ASSERT_TRUE(logic->receivedMessageHandler("foo message", 0));
+    }
+    EXPECT_EQ(numMessages, shim->getMessageQueue()->size());
+
+    // Updating creatures takes a guard while the messages are still queued
+    EXPECT_TRUE(logic->updateCreatures());
+    logic->processInput(numMessages);
+    EXPECT_TRUE(shim->getMessageQueue()->empty());
 }
 
 TEST_F(GameLogicTest, DieRolls) {
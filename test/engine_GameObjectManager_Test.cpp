@@ -14,12 +14,21 @@
 #include <Player.hpp>
 #include <PlayerClass.hpp>
 #include <Item.hpp>
+#include <ItemType.hpp>
+#include <CreatureType.hpp>
+#include <NonCombatant.hpp>
+#include <Quest.hpp>
+#include <GlobalVerbs.hpp>
+#include <LexicalData.hpp>
+#include <TextParser.hpp>
+#include <WordManager.hpp>
 
 #include <gtest/gtest.h>
 
 namespace {
 
 namespace engine = legacymud::engine;
+namespace parser = legacymud::parser;
 
 engine::GameObjectManager *gom = nullptr;
 
@@ -114,6 +123,25 @@ TEST_F(GameObjectManagerTest, AddRemoveObjectTest) {
     EXPECT_EQ(nullptr, gom->getPointer(id));
 }
 
+// Verify getting objects by ID inside and outside of the registry range
+TEST_F(GameObjectManagerTest, GetObjectByLargeIdTest) {
+    int largeID = engine::ObjectRegistry::SEGMENT_SIZE * engine::ObjectRegistry::MAX_SEGMENTS;
+    engine::Item *near = new engine::Item(nullptr, engine::ItemPosition::NONE, "near", nullptr, engine::ObjectRegistry::SEGMENT_SIZE * 3 + 5);
+    engine::Item *far = new engine::Item(nullptr, engine::ItemPosition::NONE, "far", nullptr, largeID);
+    gom->addObject(near, -1);
+    gom->addObject(far, -1);
+
+    EXPECT_EQ(near, gom->getPointer(near->getID()));
+    EXPECT_EQ(far, gom->getPointer(largeID));
+    EXPECT_EQ(nullptr, gom->getPointer(near->getID() + 1));
+    EXPECT_EQ(nullptr, gom->getPointer(-1));
+
+    gom->removeObject(near, -1);
+    gom->removeObject(far, -1);
+    EXPECT_EQ(nullptr, gom->getPointer(engine::ObjectRegistry::SEGMENT_SIZE * 3 + 5));
+    EXPECT_EQ(nullptr, gom->getPointer(largeID));
+}
+
 // Verify getting the file descriptors of players
 TEST_F(GameObjectManagerTest, GetPlayerByFdTest) {
     engine::Player *obj1 = new engine::Player();
@@ -146,5 +174,250 @@ TEST_F(GameObjectManagerTest, HibernateActivePlayerTest) {
     EXPECT_EQ(obj, gom->getPlayerByUsername("username"));   
 }
 
+// Verify only hibernated Players count as idle
+TEST_F(GameObjectManagerTest, GetIdlePlayersTest) {
+    engine::Area area;
+    engine::PlayerClass playerClass;
+    engine::Player *obj1 = new engine::Player(engine::CharacterSize::SMALL, &playerClass, "username1", 0, "Fred", "description", &area);
+    engine::Player *obj2 = new engine::Player(engine::CharacterSize::SMALL, &playerClass, "username2", 0, "Ted", "description", &area);
+    gom->addObject(obj1, 1);
+    gom->addObject(obj2, 2);
+    EXPECT_EQ(0, gom->getIdlePlayers(0).size());
+    EXPECT_TRUE(gom->hibernatePlayer(1));
+    auto objs = gom->getIdlePlayers(0);
+    ASSERT_EQ(1, objs.size());
+    EXPECT_EQ(obj1, objs[0]);
+    EXPECT_EQ(0, gom->getIdlePlayers(60).size());
+}
+
+// Verify the views are shared until the objects they contain change
+TEST_F(GameObjectManagerTest, ViewsRebuiltOnChangeTest) {
+    engine::Area area;
+    engine::PlayerClass playerClass;
+    engine::Player *player = new engine::Player(engine::CharacterSize::SMALL, &playerClass, "username", 0, "Fred", "description", &area);
+    engine::Creature *creature = new engine::Creature();
+    gom->addObject(player, 1);
+    gom->addObject(creature, -1);
+
+    auto players = gom->getPlayersView();
+    auto creatures = gom->getCreaturesView();
+    auto objects = gom->getAllObjectsView();
+    ASSERT_EQ(1, players->size());
+    EXPECT_EQ(player, players->at(0));
+    ASSERT_EQ(1, creatures->size());
+    EXPECT_EQ(creature, creatures->at(0));
+    EXPECT_EQ(2, objects->size());
+
+    // Nothing changed, so the same views are returned
+    EXPECT_EQ(players, gom->getPlayersView());
+    EXPECT_EQ(creatures, gom->getCreaturesView());
+    EXPECT_EQ(objects, gom->getAllObjectsView());
+
+    // Old views are unchanged after the objects change
+    EXPECT_TRUE(gom->hibernatePlayer(1));
+    EXPECT_TRUE(gom->removeObject(creature, -1));
+    EXPECT_EQ(1, players->size());
+    EXPECT_EQ(1, creatures->size());
+    EXPECT_EQ(0, gom->getPlayersView()->size());
+    EXPECT_EQ(0, gom->getCreaturesView()->size());
+    EXPECT_EQ(1, gom->getAllObjectsView()->size());
+
+    EXPECT_TRUE(gom->loadPlayer("username", 2));
+    gom->addObject(new engine::Creature(), -1);
+    EXPECT_EQ(1, gom->getPlayersView()->size());
+    EXPECT_EQ(1, gom->getCreaturesView()->size());
+    EXPECT_EQ(2, gom->getAllObjectsView()->size());
+}
+
+// Verify a handle stops resolving when its object is removed or replaced
+TEST_F(GameObjectManagerTest, GetObjectByHandleTest) {
+    int id = engine::ObjectRegistry::SEGMENT_SIZE * 2 + 7;
+    engine::Creature *first = new engine::Creature(nullptr, false, 10, nullptr, 0, 1, 1, 1, "first", "description", 0, nullptr, 0, id);
+    gom->addObject(first, -1);
+    engine::ObjectHandle handle = gom->getHandle(first);
+    EXPECT_EQ(id, handle.ID);
+    EXPECT_EQ(first, gom->getPointer(handle));
+
+    // the object is not deleted while a guard from before the removal is active
+    engine::EpochManager::Guard guard = gom->protectObjects();
+    EXPECT_TRUE(gom->removeObject(first, -1));
+    EXPECT_EQ(nullptr, gom->getPointer(handle));
+    EXPECT_EQ(0, gom->reclaimObjects());
+    EXPECT_STREQ("first", first->getName().c_str());
+
+    // a new object with the same ID gets a new generation
+    engine::Creature *second = new engine::Creature(nullptr, false, 10, nullptr, 0, 1, 1, 1, "second", "description", 0, nullptr, 0, id);
+    gom->addObject(second, -1);
+    EXPECT_EQ(second, gom->getPointer(id));
+    EXPECT_EQ(nullptr, gom->getPointer(handle));
+    EXPECT_EQ(second, gom->getPointer(gom->getHandle(second)));
+
+    guard.release();
+    EXPECT_EQ(1, gom->reclaimObjects());
+    EXPECT_EQ(0, gom->reclaimObjects());
+}
+
+// Verify removed objects are only reclaimed after older guards are released
+TEST_F(GameObjectManagerTest, ReclaimAfterGuardsReleasedTest) {
+    engine::Creature *obj1 = new engine::Creature();
+    engine::Creature *obj2 = new engine::Creature();
+    gom->addObject(obj1, -1);
+    gom->addObject(obj2, -1);
+
+    engine::EpochManager::Guard oldGuard = gom->protectObjects();
+    gom->removeObject(obj1, -1);
+    engine::EpochManager::Guard newGuard = gom->protectObjects();
+    gom->removeObject(obj2, -1);
+    EXPECT_EQ(0, gom->reclaimObjects());
+
+    // the guard created after the first removal cannot see the first object
+    engine::EpochManager::Guard movedGuard(std::move(oldGuard));
+    EXPECT_FALSE(oldGuard.isActive());
+    movedGuard.release();
+    EXPECT_EQ(1, gom->reclaimObjects());
+    newGuard.release();
+    EXPECT_EQ(1, gom->reclaimObjects());
+
+    // objects that are never reclaimed are deleted with the manager
+    engine::Creature *obj3 = new engine::Creature();
+    gom->addObject(obj3, -1);
+    EXPECT_TRUE(gom->removeObject(obj3, -1));
+}
+
+// Verify objects in the list-backed collections are removed and reclaimed
+TEST_F(GameObjectManagerTest, RemoveAndReclaimItemTest) {
+    engine::Area *area = new engine::Area();
+    engine::Item *item = new engine::Item();
+    gom->addObject(area, -1);
+    gom->addObject(item, -1);
+
+    EXPECT_TRUE(gom->removeObject(item, -1));
+    EXPECT_TRUE(gom->removeObject(area, -1));
+    EXPECT_EQ(0, gom->getGameItems().size());
+    EXPECT_EQ(0, gom->getGameAreas().size());
+    EXPECT_EQ(2, gom->reclaimObjects());
+}
+
+// Verify the parser cannot find an object after it is removed and freed
+TEST_F(GameObjectManagerTest, RemovedObjectNotParsedTest) {
+    legacymud::setBuilderVerbs();
+    engine::Item *item = new engine::Item(nullptr, engine::ItemPosition::NONE, "widget", nullptr);
+    gom->addObject(item, -1);
+    ASSERT_EQ(1, parser::WordManager::getLocalNouns("widget").size());
+
+    EXPECT_TRUE(gom->removeObject(item, -1));
+    EXPECT_EQ(1, gom->reclaimObjects());
+    EXPECT_TRUE(parser::WordManager::getLocalNouns("widget").empty());
+
+    // builder commands search every object in the game for their nouns
+    parser::LexicalData playerLex;
+    parser::LexicalData areaLex;
+    auto results = parser::TextParser::parse("delete widget", playerLex, areaLex, true);
+    ASSERT_EQ(1, results.size());
+    EXPECT_EQ(parser::ParseStatus::INVALID_DIRECT, results[0].status);
+    EXPECT_TRUE(results[0].direct.empty());
+
+    parser::WordManager::resetAll();
+}
+
+// Verify more guards than fit in one block can be active at once
+TEST_F(GameObjectManagerTest, ManyGuardsTest) {
+    engine::Creature *obj = new engine::Creature();
+    gom->addObject(obj, -1);
+
+    std::vector<engine::EpochManager::Guard> guards;
+    for (int i = 0; i < engine::EpochManager::GUARDS_PER_BLOCK + 1; i++){
+        guards.push_back(gom->protectObjects());
+        EXPECT_TRUE(guards.back().isActive());
+    }
+
+    // the guard in the added block still delays reclamation
+    gom->removeObject(obj, -1);
+    for (int i = 0; i < engine::EpochManager::GUARDS_PER_BLOCK; i++){
+        guards[i].release();
+    }
+    EXPECT_EQ(0, gom->reclaimObjects());
+    guards.back().release();
+    EXPECT_EQ(1, gom->reclaimObjects());
 }
 
+// Verify objects are indexed by their attributes when added and removed
+TEST_F(GameObjectManagerTest, IndexesAddRemoveTest) {
+    engine::ItemType swordType;
+    engine::ItemType shieldType;
+    engine::Item *sword = new engine::Item(nullptr, engine::ItemPosition::NONE, "sword", &swordType);
+    engine::Item *shield = new engine::Item(nullptr, engine::ItemPosition::NONE, "shield", &shieldType);
+    engine::Quest *quest = new engine::Quest("quest", "description", 10, sword);
+    gom->addObject(sword, -1);
+    gom->addObject(shield, -1);
+    gom->addObject(quest, -1);
+
+    auto quests = gom->getQuestsByRewardItem(sword);
+    ASSERT_EQ(1, quests.size());
+    EXPECT_EQ(quest, quests[0]);
+    EXPECT_TRUE(gom->getQuestsByRewardItem(shield).empty());
+
+    EXPECT_TRUE(gom->removeObject(quest, -1));
+    EXPECT_TRUE(gom->removeObject(sword, -1));
+    EXPECT_TRUE(gom->getQuestsByRewardItem(sword).empty());
+}
+
+// Verify objects move to new keys when their attributes are edited
+TEST_F(GameObjectManagerTest, IndexesUpdatedAfterEditTest) {
+    engine::Area area;
+    engine::Quest *quest = new engine::Quest("quest", "description", 10, nullptr);
+    engine::NonCombatant *npc = new engine::NonCombatant(nullptr, "Ted", "description", 0, &area, 10);
+    gom->addObject(quest, -1);
+    gom->addObject(npc, -1);
+
+    EXPECT_EQ(1, gom->getNPCsByQuest(nullptr).size());
+
+    // the indexes only change once the manager is told about the edit
+    npc->setQuest(quest);
+    EXPECT_EQ(1, gom->getNPCsByQuest(nullptr).size());
+    gom->updateIndexes(npc);
+    EXPECT_TRUE(gom->getNPCsByQuest(nullptr).empty());
+    EXPECT_EQ(npc, gom->getNPCsByQuest(quest)[0]);
+
+    // objects that are not in the game are not indexed
+    engine::Item item;
+    engine::Quest otherQuest("other quest", "description", 10, &item);
+    gom->updateIndexes(&otherQuest);
+    EXPECT_TRUE(gom->getQuestsByRewardItem(&item).empty());
+}
+
+// Verify the typed views, queries and visitors see the same objects
+TEST_F(GameObjectManagerTest, QueryAndVisitTest) {
+    engine::ItemType itemType;
+    engine::Item *item1 = new engine::Item(nullptr, engine::ItemPosition::NONE, "sword", &itemType);
+    engine::Item *item2 = new engine::Item(nullptr, engine::ItemPosition::NONE, "shield", nullptr);
+    engine::Area *area = new engine::Area();
+    gom->addObject(item1, -1);
+    gom->addObject(item2, -1);
+    gom->addObject(area, -1);
+
+    auto items = gom->getView<engine::Item>();
+    ASSERT_EQ(2, items->size());
+    EXPECT_EQ(items, gom->getView<engine::Item>());
+    EXPECT_EQ(1, gom->getView<engine::Area>()->size());
+
+    auto typed = gom->query<engine::Item>([&itemType](engine::Item *anItem){
+        return anItem->getType() == &itemType;
+    });
+    ASSERT_EQ(1, typed.size());
+    EXPECT_EQ(item1, typed[0]);
+
+    // the visitor stops as soon as it returns false
+    int numVisited = gom->visit<engine::Item>([](engine::Item *anItem){
+        return false;
+    });
+    EXPECT_EQ(1, numVisited);
+
+    // the view is rebuilt after an item is removed, but the old one is unchanged
+    EXPECT_TRUE(gom->removeObject(item2, -1));
+    EXPECT_EQ(2, items->size());
+    EXPECT_EQ(1, gom->getView<engine::Item>()->size());
+    EXPECT_EQ(1, gom->getGameItems().size());
+}
+
+}
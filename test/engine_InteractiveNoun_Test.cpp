@@ -126,6 +126,35 @@ TEST_F(InteractiveNounTest, GetTextAndEffectTest) {
     EXPECT_EQ(engine::EffectType::FALL, effect);
 }
 
+// Verify that a copy shares its actions until either object changes them
+TEST_F(InteractiveNounTest, CopySharesActionsTest) {
+    engine::Action *act = in->addAction(engine::CommandEnum::TALK);
+    act->setFlavorText("Hello.");
+    in->addAction(engine::CommandEnum::LOOK);
+
+    test::InteractiveNounStub *copy = new test::InteractiveNounStub(*static_cast<test::InteractiveNounStub*>(in));
+    EXPECT_NE(in->getID(), copy->getID());
+    EXPECT_EQ(in->getAllActions(), copy->getAllActions());
+
+    // Changing the copy's action gives the copy its own actions
+    engine::Action *copyAct = copy->getEditableAction(engine::CommandEnum::TALK);
+    ASSERT_NE(nullptr, copyAct);
+    EXPECT_NE(act, copyAct);
+    copyAct->setFlavorText("Goodbye.");
+    EXPECT_STREQ("Hello.", in->getAction(engine::CommandEnum::TALK)->getFlavorText().c_str());
+    EXPECT_STREQ("Goodbye.", copy->getAction(engine::CommandEnum::TALK)->getFlavorText().c_str());
+
+    // The original keeps its actions after the copy is destroyed
+    delete copy;
+    copy = new test::InteractiveNounStub(*static_cast<test::InteractiveNounStub*>(in));
+    EXPECT_TRUE(copy->removeAction(engine::CommandEnum::LOOK));
+    EXPECT_FALSE(copy->checkAction(engine::CommandEnum::LOOK));
+    EXPECT_TRUE(in->checkAction(engine::CommandEnum::LOOK));
+    delete copy;
+    EXPECT_EQ(act, in->getAction(engine::CommandEnum::TALK));
+    EXPECT_STREQ("Hello.", act->getFlavorText().c_str());
+}
+
 // Verify thread safety of ID generation
 TEST_F(InteractiveNounTest, ThreadSafeIdTest) {
     // Generate 10000 objects in each thread simultaneously
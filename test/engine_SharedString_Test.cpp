@@ -0,0 +1,92 @@
+/*!
+  \file     engine_SharedString_Test.cpp
+  \author   agent
+  \created  10/19/2026
+  \modified 10/19/2026
+ 
+  \details  This file contains the unit tests for the SharedString class.
+*/
+
+#include <SharedString.hpp>
+#include <Item.hpp>
+
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+namespace engine = legacymud::engine;
+
+// Verify setting, exchanging and copying the value
+TEST(SharedStringTest, SetExchangeCopyTest) {
+    engine::SharedString empty;
+    EXPECT_STREQ("", empty.get().c_str());
+
+    engine::SharedString name("sword");
+    EXPECT_STREQ("sword", name.get().c_str());
+    EXPECT_STREQ("sword", name.exchange("axe").c_str());
+    EXPECT_STREQ("axe", name.get().c_str());
+
+    // copies share the value until one of them is set
+    engine::SharedString copy(name);
+    EXPECT_EQ(name.share(), copy.share());
+    copy.set("bow");
+    EXPECT_STREQ("axe", name.get().c_str());
+    EXPECT_STREQ("bow", copy.get().c_str());
+}
+
+// Verify strings with the same text share one copy until it is released
+TEST(SharedStringTest, InternTest) {
+    std::size_t numInterned = engine::SharedString::getNumInterned();
+    engine::SharedString *first = new engine::SharedString("a rusty sword");
+    engine::SharedString *second = new engine::SharedString(std::string("a rusty ") + "sword");
+    EXPECT_EQ(first->share(), second->share());
+    EXPECT_EQ(numInterned + 1, engine::SharedString::getNumInterned());
+
+    // items copied from the same item share their names
+    engine::Item item(nullptr, engine::ItemPosition::NONE, "a rusty sword", nullptr);
+    engine::Item itemCopy(item);
+    EXPECT_EQ(numInterned + 1, engine::SharedString::getNumInterned());
+    itemCopy.setName("a shiny sword");
+    EXPECT_EQ(numInterned + 2, engine::SharedString::getNumInterned());
+    itemCopy.setName("a rusty sword");
+    EXPECT_EQ(numInterned + 1, engine::SharedString::getNumInterned());
+
+    delete first;
+    delete second;
+    EXPECT_EQ(numInterned + 1, engine::SharedString::getNumInterned());
+}
+
+// Verify a shared value does not change when the string is set again
+TEST(SharedStringTest, ShareKeepsOldValueTest) {
+    engine::SharedString name("old");
+    auto shared = name.share();
+    name.set("new");
+    EXPECT_STREQ("old", shared->c_str());
+    EXPECT_STREQ("new", name.share()->c_str());
+}
+
+// Verify readers see either the old or the new name while it is renamed
+TEST(SharedStringTest, ConcurrentReadWriteTest) {
+    engine::Item item(nullptr, engine::ItemPosition::NONE, "short", nullptr);
+    std::string longName(100, 'x');
+    bool allValid = true;
+
+    std::thread writer([&item, &longName](){
+        for (int i = 0; i < 1000; i++){
+            item.setName((i % 2 == 0) ? longName : "short");
+        }
+    });
+    for (int i = 0; i < 1000; i++){
+        std::string name = item.getName();
+        if ((name != "short") && (name != longName)){
+            allValid = false;
+        }
+    }
+    writer.join();
+    EXPECT_TRUE(allValid);
+}
+
+}
@@ -0,0 +1,93 @@
+/*!
+  \file     engine_SlabAllocator_Test.cpp
+  \author   agent
+  \created  10/19/2026
+  \modified 10/19/2026
+ 
+  \details  This file contains the unit tests for the SlabAllocator class.
+*/
+
+#include <SlabAllocator.hpp>
+#include <Action.hpp>
+#include <Item.hpp>
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+namespace engine = legacymud::engine;
+
+// No game object is this large, so the tests have the size class to themselves
+const size_t TEST_SIZE = engine::SlabAllocator::MAX_BLOCK_SIZE - 100;
+const size_t TEST_STRIDE = engine::SlabAllocator::ALIGNMENT
+    + (TEST_SIZE + engine::SlabAllocator::ALIGNMENT - 1) / engine::SlabAllocator::ALIGNMENT * engine::SlabAllocator::ALIGNMENT;
+
+// Verify objects of the same size are stored next to each other
+TEST(SlabAllocatorTest, AllocateAdjacentTest) {
+    char *first = static_cast<char*>(engine::SlabAllocator::allocate(TEST_SIZE));
+    char *second = static_cast<char*>(engine::SlabAllocator::allocate(TEST_SIZE));
+    EXPECT_EQ(TEST_STRIDE, static_cast<size_t>(second - first));
+
+    // A released block is reused first
+    engine::SlabAllocator::deallocate(first, TEST_SIZE);
+    char *third = static_cast<char*>(engine::SlabAllocator::allocate(TEST_SIZE));
+    EXPECT_EQ(first, third);
+
+    engine::SlabAllocator::deallocate(second, TEST_SIZE);
+    engine::SlabAllocator::deallocate(third, TEST_SIZE);
+    engine::SlabAllocator::trim();
+}
+
+// Verify empty slabs are freed by trim
+TEST(SlabAllocatorTest, TrimEmptySlabsTest) {
+    engine::SlabAllocator::trim();
+    size_t startSlabs = engine::SlabAllocator::getNumSlabs();
+    size_t perSlab = engine::SlabAllocator::SLAB_SIZE / TEST_STRIDE;
+
+    std::vector<void*> blocks;
+    for (size_t i = 0; i < perSlab + 1; ++i) {
+        blocks.push_back(engine::SlabAllocator::allocate(TEST_SIZE));
+    }
+    EXPECT_EQ(startSlabs + 2, engine::SlabAllocator::getNumSlabs());
+
+    // Slabs with live objects are kept
+    engine::SlabAllocator::deallocate(blocks.back(), TEST_SIZE);
+    blocks.pop_back();
+    EXPECT_EQ(1, engine::SlabAllocator::trim());
+    EXPECT_EQ(startSlabs + 1, engine::SlabAllocator::getNumSlabs());
+
+    for (auto block : blocks) {
+        engine::SlabAllocator::deallocate(block, TEST_SIZE);
+    }
+    EXPECT_EQ(1, engine::SlabAllocator::trim());
+    EXPECT_EQ(startSlabs, engine::SlabAllocator::getNumSlabs());
+}
+
+// Verify sizes over the limit use the heap
+TEST(SlabAllocatorTest, LargeAllocationTest) {
+    size_t startSlabs = engine::SlabAllocator::getNumSlabs();
+    void *block = engine::SlabAllocator::allocate(engine::SlabAllocator::MAX_BLOCK_SIZE + 1);
+    ASSERT_NE(nullptr, block);
+    EXPECT_EQ(startSlabs, engine::SlabAllocator::getNumSlabs());
+    engine::SlabAllocator::deallocate(block, engine::SlabAllocator::MAX_BLOCK_SIZE + 1);
+}
+
+// Verify game objects and actions are allocated from slabs
+TEST(SlabAllocatorTest, GameObjectAllocationTest) {
+    // The block released last is the first one reused for the same size
+    void *block = engine::SlabAllocator::allocate(sizeof(engine::Item));
+    engine::SlabAllocator::deallocate(block, sizeof(engine::Item));
+    engine::Item *anItem = new engine::Item();
+    EXPECT_EQ(block, static_cast<void*>(anItem));
+    delete anItem;
+
+    block = engine::SlabAllocator::allocate(sizeof(engine::Action));
+    engine::SlabAllocator::deallocate(block, sizeof(engine::Action));
+    engine::Action *anAction = new engine::Action();
+    EXPECT_EQ(block, static_cast<void*>(anAction));
+    delete anAction;
+}
+
+}
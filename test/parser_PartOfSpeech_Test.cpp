@@ -2,7 +2,7 @@
   \file     parser_PartOfSpeech_Test.cpp
   \author   David Rigert
   \created  02/14/2017
-  \modified 02/20/2017
+  \modified 10/19/2026
   \course   CS467, Winter 2017
  
   \details  This file contains the unit tests for the PartOfSpeech class.
@@ -174,5 +174,79 @@ TEST_F(PartOfSpeechTest, FindLocalVerbDifferentCase) {
     EXPECT_EQ(1, pos.getRange().end);
 }
 
+// Ability to find multi-word global verb with the longest-match lookup
+TEST_F(PartOfSpeechTest, FindLongestGlobalVerbMultiWord) {
+    tokens = parser::Tokenizer::tokenizeInput("Pick Up bar");
+    range = parser::Range(0, tokens.size());
+    parser::PartOfSpeech pos;
+    EXPECT_TRUE(pos.findMatch(tokens, range, parser::WordManager::findLongestGlobalVerb));
+    EXPECT_STREQ("pick up", pos.getAlias().c_str());
+    EXPECT_STREQ("Pick Up", pos.getOriginalAlias().c_str());
+    EXPECT_EQ(0, pos.getRange().start);
+    EXPECT_EQ(2, pos.getRange().end);
+    EXPECT_EQ(2, range.end);
+}
+
+// Longest-match lookup skips ignore words the same way as findWord lookups
+TEST_F(PartOfSpeechTest, FindLongestLocalNounWithIgnoreWord) {
+    tokens = parser::Tokenizer::tokenizeInput("foo the bar baz");
+    range = parser::Range(1, tokens.size());
+    parser::PartOfSpeech pos;
+    EXPECT_TRUE(pos.findMatch(tokens, range, &parser::LexicalData::forwardFindLongestNoun, &areaLex));
+    EXPECT_STREQ("bar", pos.getAlias().c_str());
+    EXPECT_STREQ("the bar", pos.getOriginalAlias().c_str());
+    EXPECT_EQ(1, pos.getRange().start);
+    EXPECT_EQ(3, pos.getRange().end);
+}
+
+// Longest-match lookup prefers the longest alias and leaves the range alone on failure
+TEST_F(PartOfSpeechTest, FindLongestPrefersLongerAlias) {
+    engine::Item qux;
+    areaLex.addNoun("bar baz", &qux);
+    tokens = parser::Tokenizer::tokenizeInput("foo bar baz");
+    range = parser::Range(1, tokens.size());
+    parser::PartOfSpeech pos;
+    EXPECT_TRUE(pos.findMatch(tokens, range, &parser::LexicalData::forwardFindLongestNoun, &areaLex));
+    EXPECT_STREQ("bar baz", pos.getAlias().c_str());
+    EXPECT_EQ(3, pos.getRange().end);
+
+    // Removing the longer alias falls back to the shorter one
+    areaLex.removeNoun("bar baz", &qux);
+    range = parser::Range(1, tokens.size());
+    EXPECT_TRUE(pos.findMatch(tokens, range, &parser::LexicalData::forwardFindLongestNoun, &areaLex));
+    EXPECT_STREQ("bar", pos.getAlias().c_str());
+    EXPECT_EQ(2, pos.getRange().end);
+
+    range = parser::Range(0, tokens.size());
+    EXPECT_FALSE(pos.findMatch(tokens, range, &parser::LexicalData::forwardFindLongestNoun, &areaLex));
+    EXPECT_TRUE(pos.getAlias().empty());
+    EXPECT_EQ(0, range.start);
+    EXPECT_EQ(3, range.end);
 }
 
+// Tokenizing into an existing token list replaces its contents
+TEST_F(PartOfSpeechTest, TokenizeIntoExistingList) {
+    std::vector<parser::Token> list;
+    parser::Tokenizer::tokenizeInput("  Pick\tUP   the  BAR ", list);
+    ASSERT_EQ(4, list.size());
+    EXPECT_STREQ("Pick", list[0].original.c_str());
+    EXPECT_STREQ("pick", list[0].normalized.c_str());
+    EXPECT_STREQ("UP", list[1].original.c_str());
+    EXPECT_STREQ("pick up the bar", parser::Tokenizer::joinNormalized(list, parser::Range(0, 4), false).c_str());
+    EXPECT_STREQ("pick up bar", parser::Tokenizer::joinNormalized(list, parser::Range(0, 4), true).c_str());
+    EXPECT_STREQ("Pick UP the BAR", parser::Tokenizer::joinOriginal(list, parser::Range(0, 4)).c_str());
+
+    parser::Tokenizer::tokenizeInput("foo", list);
+    ASSERT_EQ(1, list.size());
+    EXPECT_STREQ("foo", list[0].normalized.c_str());
+    EXPECT_EQ(parser::SymbolTable::find("foo"), list[0].symbol);
+
+    std::string out = "stale";
+    parser::Tokenizer::joinOriginal(list, parser::Range(0, 2), out);
+    EXPECT_TRUE(out.empty());
+
+    parser::Tokenizer::tokenizeInput(" \t ", list);
+    EXPECT_TRUE(list.empty());
+}
+
+}
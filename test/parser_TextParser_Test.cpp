@@ -2,13 +2,15 @@
   \file     parser_TextParser_Test.cpp
   \author   David Rigert
   \created  01/29/2017
-  \modified 03/02/2017
+  \modified 10/19/2026
   \course   CS467, Winter 2017
  
   \details This file contains the unit tests for the TextParser class.
 */
 
 #include <TextParser.hpp>
+#include <BKTree.hpp>
+#include <EditDistance.hpp>
 #include <LexicalData.hpp>
 #include <GlobalVerbs.hpp>
 #include <Container.hpp>
@@ -24,6 +26,8 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+
 namespace {
 
 namespace parser = legacymud::parser;
@@ -2510,6 +2514,202 @@ TEST_F(TextParserTest, VTSentenceMissingDirectTest) {
     EXPECT_EQ(engine::ItemPosition::NONE, results[0].position);
 }
 
+// Test that a cached parse returns the same results as an uncached parse
+TEST_F(TextParserTest, ParseCacheHitTest) {
+    parser::ParseCache cache;
+    engine::Item candle;
+    areaLex.addNoun("candle", &candle);
+
+    std::vector<parser::ParseResult> expected = parser::TextParser::parse("look at candle", playerLex, areaLex);
+    ASSERT_EQ(1, expected.size());
+
+    // Extra whitespace normalizes to the same cache entry
+    std::vector<std::string> inputs = {
+        "look at candle",
+        "look   at candle",
+        " look at   candle "
+    };
+    for (auto it = inputs.begin(); it != inputs.end(); ++it) {
+        results = parser::TextParser::parse(*it, playerLex, areaLex, false, false, cache);
+        ASSERT_EQ(1, results.size()) << *it;
+        EXPECT_EQ(expected[0].status, results[0].status) << *it;
+        EXPECT_EQ(expected[0].command, results[0].command) << *it;
+        ASSERT_EQ(1, results[0].direct.size()) << *it;
+        EXPECT_EQ(&candle, results[0].direct[0]) << *it;
+    }
+    EXPECT_EQ(1, cache.size());
+}
+
+// Test that changing the lexical data in scope invalidates a cached parse
+TEST_F(TextParserTest, ParseCacheVersionTest) {
+    parser::ParseCache cache;
+    engine::Item candle;
+
+    results = parser::TextParser::parse("take candle", playerLex, areaLex, false, false, cache);
+    ASSERT_FALSE(results.empty());
+    EXPECT_NE(parser::ParseStatus::VALID, results[0].status);
+
+    unsigned long version = areaLex.getVersion();
+    areaLex.addNoun("candle", &candle);
+    EXPECT_NE(version, areaLex.getVersion());
+
+    results = parser::TextParser::parse("take candle", playerLex, areaLex, false, false, cache);
+    ASSERT_EQ(1, results.size());
+    EXPECT_EQ(parser::ParseStatus::VALID, results[0].status);
+    ASSERT_EQ(1, results[0].direct.size());
+    EXPECT_EQ(&candle, results[0].direct[0]);
+
+    // The stale entry for the same input is replaced
+    EXPECT_EQ(1, cache.size());
+
+    // Admin and edit mode results are stored separately
+    results = parser::TextParser::parse("take candle", playerLex, areaLex, true, false, cache);
+    parser::ParseCache::Key key("take candle", playerLex, areaLex, false, false);
+    EXPECT_FALSE(cache.find(key, results));
+}
+
+// Test that a parse that only uses lexical data in scope ignores objects moving elsewhere
+TEST_F(TextParserTest, ParseCacheLocalWordsTest) {
+    parser::ParseCache cache;
+    engine::Item candle;
+    std::vector<parser::ParseResult> found;
+
+    results = parser::TextParser::parse("LOOK", playerLex, areaLex, false, false, cache);
+    ASSERT_EQ(1, results.size());
+    EXPECT_EQ(parser::ParseStatus::VALID, results[0].status);
+    results = parser::TextParser::parse("take candle", playerLex, areaLex, false, false, cache);
+    ASSERT_FALSE(results.empty());
+    EXPECT_EQ(parser::ParseStatus::INVALID_DIRECT, results[0].status);
+
+    // An object elsewhere in the game gets the alias
+    unsigned long verbVersion = parser::WordManager::getVerbVersion();
+    parser::WordManager::addNoun("candle", &candle);
+    EXPECT_EQ(verbVersion, parser::WordManager::getVerbVersion());
+
+    // The input is matched without regard to case
+    parser::ParseCache::Key lookKey("look", playerLex, areaLex, false, false);
+    EXPECT_TRUE(cache.find(lookKey, found));
+
+    // Checking for unavailable nouns used the in-use alias tables
+    parser::ParseCache::Key takeKey("take candle", playerLex, areaLex, false, false);
+    EXPECT_FALSE(cache.find(takeKey, found));
+    results = parser::TextParser::parse("take candle", playerLex, areaLex, false, false, cache);
+    ASSERT_FALSE(results.empty());
+    EXPECT_EQ(parser::ParseStatus::UNAVAILABLE_DIRECT, results[0].status);
+
+    parser::WordManager::removeNoun("candle", &candle);
+}
+
+// Test that the least recently used entry is evicted when the cache is full
+TEST_F(TextParserTest, ParseCacheEvictionTest) {
+    parser::ParseCache cache(2);
+    std::vector<parser::ParseResult> found;
+    parser::ParseCache::Key keyA("look", playerLex, areaLex, false, false);
+    parser::ParseCache::Key keyB("listen", playerLex, areaLex, false, false);
+    parser::ParseCache::Key keyC("help", playerLex, areaLex, false, false);
+
+    cache.insert(keyA, parser::TextParser::parse("look", playerLex, areaLex));
+    cache.insert(keyB, parser::TextParser::parse("listen", playerLex, areaLex));
+    // Using A makes B the least recently used entry
+    EXPECT_TRUE(cache.find(keyA, found));
+    cache.insert(keyC, parser::TextParser::parse("help", playerLex, areaLex));
+
+    EXPECT_EQ(2, cache.size());
+    EXPECT_TRUE(cache.find(keyA, found));
+    ASSERT_EQ(1, found.size());
+    EXPECT_EQ(engine::CommandEnum::LOOK, found[0].command);
+    EXPECT_FALSE(cache.find(keyB, found));
+    EXPECT_TRUE(cache.find(keyC, found));
+}
+
+// Test the edit distance of short and long strings
+TEST_F(TextParserTest, EditDistanceTest) {
+    EXPECT_EQ(0, parser::EditDistance::getDistance("take", "take"));
+    EXPECT_EQ(1, parser::EditDistance::getDistance("tak", "take"));
+    EXPECT_EQ(2, parser::EditDistance::getDistance("tkae", "take"));
+    EXPECT_EQ(3, parser::EditDistance::getDistance("kitten", "sitting"));
+    EXPECT_EQ(4, parser::EditDistance::getDistance("", "look"));
+
+    // Longer than one machine word, so the matrix algorithm is used
+    std::string longText(100, 'a');
+    std::string changed = longText;
+    changed[10] = 'b';
+    changed.erase(50, 1);
+    EXPECT_EQ(2, parser::EditDistance::getDistance(longText, changed));
+
+    // Exactly one machine word
+    std::string word(64, 'x');
+    EXPECT_EQ(1, parser::EditDistance::getDistance(word, word + "y"));
+    EXPECT_EQ(64, parser::EditDistance::getDistance(word, std::string(64, 'z')));
+}
+
+// Test that the BK-tree finds every word within the distance
+TEST_F(TextParserTest, BKTreeFindTest) {
+    parser::BKTree tree;
+    std::vector<std::string> words = { "look", "listen", "lock", "take", "talk", "take off", "book", "look" };
+    for (auto it = words.begin(); it != words.end(); ++it) {
+        tree.insert(*it);
+    }
+    EXPECT_EQ(7, tree.size());
+
+    std::vector<parser::WordMatch> matches;
+    tree.find("lok", 1, matches);
+    std::vector<std::string> found;
+    for (auto it = matches.begin(); it != matches.end(); ++it) {
+        found.push_back(it->word);
+    }
+    std::sort(found.begin(), found.end());
+    std::vector<std::string> expected = { "lock", "look" };
+    EXPECT_EQ(expected, found);
+
+    matches.clear();
+    tree.find("zzzzzz", 2, matches);
+    EXPECT_TRUE(matches.empty());
+}
+
+// Test "did you mean" suggestions for misspelled verbs and nouns
+TEST_F(TextParserTest, SuggestionTest) {
+    engine::Item candle;
+    engine::Item sword;
+    areaLex.addNoun("candle", &candle);
+    playerLex.addNoun("short sword", &sword);
+
+    // Misspelled global verb
+    results = parser::TextParser::parse("lokk at candle", playerLex, areaLex);
+    ASSERT_FALSE(results.empty());
+    ASSERT_EQ(parser::ParseStatus::INVALID_VERB, results[0].status);
+    EXPECT_EQ("look", parser::TextParser::getSuggestion(results[0], playerLex, areaLex, false));
+
+    // Multi-word verb
+    results = parser::TextParser::parse("pick upp candle", playerLex, areaLex);
+    ASSERT_FALSE(results.empty());
+    ASSERT_EQ(parser::ParseStatus::INVALID_VERB, results[0].status);
+    EXPECT_EQ("pick up", parser::TextParser::getSuggestion(results[0], playerLex, areaLex, false));
+
+    // World builder verbs are only suggested to admins
+    results = parser::TextParser::parse("warpp candle", playerLex, areaLex);
+    ASSERT_FALSE(results.empty());
+    ASSERT_EQ(parser::ParseStatus::INVALID_VERB, results[0].status);
+    EXPECT_EQ("", parser::TextParser::getSuggestion(results[0], playerLex, areaLex, false));
+    EXPECT_EQ("warp", parser::TextParser::getSuggestion(results[0], playerLex, areaLex, true));
+
+    // Misspelled nouns in the area and on the player
+    results = parser::TextParser::parse("look at candel", playerLex, areaLex);
+    ASSERT_FALSE(results.empty());
+    ASSERT_EQ(parser::ParseStatus::INVALID_DIRECT, results[0].status);
+    EXPECT_EQ("candle", parser::TextParser::getSuggestion(results[0], playerLex, areaLex, false));
+
+    results = parser::TextParser::parse("drop short swrod", playerLex, areaLex);
+    ASSERT_FALSE(results.empty());
+    ASSERT_EQ(parser::ParseStatus::INVALID_DIRECT, results[0].status);
+    EXPECT_EQ("short sword", parser::TextParser::getSuggestion(results[0], playerLex, areaLex, false));
+
+    // Nothing close enough
+    results = parser::TextParser::parse("look at xylophone", playerLex, areaLex);
+    ASSERT_FALSE(results.empty());
+    EXPECT_EQ("", parser::TextParser::getSuggestion(results[0], playerLex, areaLex, false));
+}
+
 /******************************************
  * Helper Functions
  *****************************************/
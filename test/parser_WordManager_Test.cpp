@@ -2,7 +2,7 @@
   \file     parser_WordManager_Test.cpp
   \author   David Rigert
   \created  01/29/2017
-  \modified 02/11/2017
+  \modified 10/19/2026
   \course   CS467, Winter 2017
  
   \details  This file contains the unit tests for the WordManager class.
@@ -12,6 +12,9 @@
 */
 
 #include <WordManager.hpp>
+#include <LexicalData.hpp>
+#include <SymbolTable.hpp>
+#include <Tokenizer.hpp>
 #include <Item.hpp>
 
 #include <gtest/gtest.h>
@@ -355,5 +358,196 @@ TEST_F(WordManagerTest, CaseInsensitivityTest) {
     EXPECT_TRUE(parser::WordManager::hasVerb("foobar"));
 }
 
+// Verify that tokens carry the symbols of interned words only
+TEST_F(WordManagerTest, TokenSymbolTest) {
+    parser::WordManager::addIgnoreWord("The");
+    parser::WordManager::addNoun("symbol test", in1);
+
+    std::vector<parser::Token> tokens = parser::Tokenizer::tokenizeInput("the Symbol TEST unknownword");
+    ASSERT_EQ(4, tokens.size());
+    EXPECT_EQ(parser::SymbolTable::find("the"), tokens[0].symbol);
+    EXPECT_EQ(parser::SymbolTable::find("symbol"), tokens[1].symbol);
+    EXPECT_EQ(parser::SymbolTable::find("test"), tokens[2].symbol);
+    EXPECT_NE(parser::NO_SYMBOL, tokens[1].symbol);
+    EXPECT_NE(tokens[1].symbol, tokens[2].symbol);
+    EXPECT_EQ(parser::NO_SYMBOL, tokens[3].symbol);
+    EXPECT_STREQ("symbol", parser::SymbolTable::getWord(tokens[1].symbol).c_str());
+
+    EXPECT_TRUE(parser::WordManager::isIgnoreSymbol(tokens[0].symbol));
+    EXPECT_FALSE(parser::WordManager::isIgnoreSymbol(tokens[1].symbol));
+    EXPECT_FALSE(parser::WordManager::isIgnoreSymbol(parser::NO_SYMBOL));
+    EXPECT_TRUE(parser::WordManager::hasNoun("Symbol Test"));
+    EXPECT_STREQ("symbol test", parser::Tokenizer::joinNormalized(tokens, parser::Range(0, 3), true).c_str());
+
+    parser::WordManager::removeNoun("symbol test", in1);
+    EXPECT_FALSE(parser::WordManager::hasNoun("symbol test"));
 }
 
+// Verify longest matches that start in different shards of the in-use nouns
+TEST_F(WordManagerTest, ShardedLongestMatchTest) {
+    parser::WordManager::addIgnoreWord("the");
+    parser::WordManager::addNoun("red ball", in1);
+    parser::WordManager::addNoun("the end", in2);
+    bool skip = true;
+
+    // Match found only after skipping the ignore word
+    std::vector<parser::Token> tokens = parser::Tokenizer::tokenizeInput("the red ball");
+    EXPECT_EQ(3, parser::WordManager::findLongestNoun(nullptr, tokens, parser::Range(0, 3), skip));
+    EXPECT_TRUE(skip);
+
+    // Match that includes the ignore word
+    tokens = parser::Tokenizer::tokenizeInput("the end");
+    EXPECT_EQ(2, parser::WordManager::findLongestNoun(nullptr, tokens, parser::Range(0, 2), skip));
+    EXPECT_FALSE(skip);
+
+    // No match leaves the range start
+    tokens = parser::Tokenizer::tokenizeInput("the blue ball");
+    EXPECT_EQ(0, parser::WordManager::findLongestNoun(nullptr, tokens, parser::Range(0, 3), skip));
+
+    parser::WordManager::removeNoun("red ball", in1);
+    tokens = parser::Tokenizer::tokenizeInput("red ball");
+    EXPECT_EQ(0, parser::WordManager::findLongestNoun(nullptr, tokens, parser::Range(0, 2), skip));
+    EXPECT_TRUE(parser::WordManager::hasNoun("THE END"));
+    parser::WordManager::removeNoun("the end", in2);
+}
+
+// Verify that each change to the verb tables is published to readers
+TEST_F(WordManagerTest, VerbTableSnapshotTest) {
+    parser::VerbInfo vi;
+    unsigned long version = parser::WordManager::getVerbVersion();
+
+    parser::WordManager::addGlobalVerb("snap", vi);
+    EXPECT_NE(version, parser::WordManager::getVerbVersion());
+    EXPECT_TRUE(parser::WordManager::hasGlobalVerb("snap"));
+    EXPECT_FALSE(parser::WordManager::hasBuilderVerb("snap"));
+
+    vi.description = "second";
+    parser::WordManager::addGlobalVerb("snap", vi);
+    parser::VerbSpan verbs = parser::WordManager::getGlobalVerbs("snap");
+    EXPECT_EQ(2, verbs.size());
+
+    parser::WordManager::addIgnoreWord("an");
+    EXPECT_TRUE(parser::WordManager::isIgnoreWord("an"));
+    EXPECT_TRUE(parser::WordManager::hasGlobalVerb("snap"));
+
+    parser::WordManager::resetAll();
+    EXPECT_FALSE(parser::WordManager::hasGlobalVerb("snap"));
+    EXPECT_FALSE(parser::WordManager::isIgnoreWord("an"));
+}
+
+// Verify that the in-use alias tables have their own version number
+TEST_F(WordManagerTest, LocalVersionTest) {
+    engine::Item ball;
+    unsigned long verbVersion = parser::WordManager::getVerbVersion();
+    unsigned long localVersion = parser::WordManager::getLocalVersion();
+    unsigned long lookups = parser::WordManager::getLocalLookups();
+
+    parser::WordManager::addNoun("ball", &ball);
+    EXPECT_EQ(verbVersion, parser::WordManager::getVerbVersion());
+    EXPECT_NE(localVersion, parser::WordManager::getLocalVersion());
+    EXPECT_EQ(lookups, parser::WordManager::getLocalLookups());
+
+    EXPECT_TRUE(parser::WordManager::hasNoun("ball"));
+    EXPECT_NE(lookups, parser::WordManager::getLocalLookups());
+
+    parser::WordManager::removeNoun("ball", &ball);
+}
+
+// Verify that a table of verb definitions is added in one step
+TEST_F(WordManagerTest, VerbDefinitionTableTest) {
+    static constexpr parser::PrepositionDefinition preps[] = {
+        { "on", parser::PrepositionType::ON },
+        { "from", parser::PrepositionType::FROM },
+        { nullptr, parser::PrepositionType::NONE }
+    };
+    static constexpr parser::VerbDefinition verbs[] = {
+        { "grab", "grab", engine::CommandEnum::TAKE, parser::Grammar::YES, false, parser::Grammar::NO, nullptr },
+        { "Fetch Up", "fetch up", engine::CommandEnum::TAKE, parser::Grammar::YES, false, parser::Grammar::NO, nullptr },
+        { "grab", "grab from", engine::CommandEnum::TAKE, parser::Grammar::YES, true, parser::Grammar::YES, preps }
+    };
+    unsigned long version = parser::WordManager::getVerbVersion();
+
+    parser::WordManager::addGlobalVerbs(verbs, 3);
+    EXPECT_NE(version, parser::WordManager::getVerbVersion());
+    EXPECT_TRUE(parser::WordManager::hasGlobalVerb("GRAB"));
+    EXPECT_TRUE(parser::WordManager::hasGlobalVerb("fetch up"));
+    EXPECT_FALSE(parser::WordManager::hasGlobalVerb("fetch"));
+    EXPECT_FALSE(parser::WordManager::hasBuilderVerb("grab"));
+
+    // Definitions of the same alias are kept together, in table order
+    parser::VerbSpan span = parser::WordManager::getGlobalVerbs("grab");
+    ASSERT_EQ(2, span.size());
+    EXPECT_EQ("grab", span[0].description);
+    EXPECT_FALSE(span[0].grammar.takesPreposition());
+    EXPECT_EQ("grab from", span[1].description);
+    EXPECT_EQ(parser::PrepositionType::FROM, span[1].grammar.getPrepositionType("from"));
+    EXPECT_EQ(parser::PrepositionType::ON, span[1].grammar.getPrepositionType("on"));
+    EXPECT_EQ(parser::Grammar::YES, span[1].grammar.takesIndirectObject());
+
+    // The span stays valid after the tables are replaced
+    parser::WordManager::addGlobalVerb("grab", parser::VerbInfo());
+    parser::WordManager::resetAll();
+    EXPECT_EQ(2, span.size());
+    EXPECT_EQ("grab from", span[1].description);
+}
+
+// Verify that every alias is found after many aliases are added
+TEST_F(WordManagerTest, VerbTableHashTest) {
+    parser::VerbTable table;
+    parser::VerbInfo vi;
+    for (int i = 0; i < 200; ++i) {
+        vi.description = "verb" + std::to_string(i);
+        table.add(vi.description, vi);
+    }
+
+    for (int i = 0; i < 200; ++i) {
+        std::string alias = "verb" + std::to_string(i);
+        parser::VerbSpan span = table.find(parser::SymbolTable::find(alias), nullptr);
+        ASSERT_EQ(1, span.size());
+        EXPECT_EQ(alias, span[0].description);
+    }
+    EXPECT_FALSE(table.has(parser::SymbolTable::intern("verb200")));
+    EXPECT_FALSE(table.has(parser::NO_SYMBOL));
+    EXPECT_TRUE(table.find(parser::SymbolTable::intern("verb200"), nullptr).empty());
+}
+
+// Verify that a batch of alias changes reaches the local and global tables
+TEST_F(WordManagerTest, LexicalBatchTest) {
+    parser::LexicalData lex;
+    parser::LexicalBatch batch;
+    batch.addNoun("red ball", in1);
+    batch.addNoun("ball", in1);
+    batch.addVerb("bounce", in1);
+    batch.addNoun("ball", in2);
+    batch.addNoun("temporary", in2);
+    batch.removeNoun("temporary", in2);
+    EXPECT_FALSE(batch.empty());
+
+    unsigned long version = lex.getVersion();
+    lex.apply(batch);
+    EXPECT_NE(version, lex.getVersion());
+    EXPECT_TRUE(lex.hasNoun("red ball"));
+    EXPECT_TRUE(lex.hasVerb("bounce"));
+    EXPECT_EQ(2, lex.getObjectsByNoun("ball").size());
+    EXPECT_FALSE(lex.hasNoun("temporary"));
+    EXPECT_TRUE(parser::WordManager::hasNoun("red ball"));
+    EXPECT_EQ(2, parser::WordManager::getLocalNouns("ball").size());
+    EXPECT_TRUE(parser::WordManager::hasVerb("bounce"));
+    EXPECT_FALSE(parser::WordManager::hasNoun("temporary"));
+
+    parser::LexicalBatch removal;
+    removal.removeNoun("red ball", in1);
+    removal.removeNoun("ball", in1);
+    removal.removeVerb("bounce", in1);
+    lex.apply(removal);
+    EXPECT_FALSE(lex.hasNoun("red ball"));
+    EXPECT_FALSE(lex.hasVerb("bounce"));
+    EXPECT_EQ(1, lex.getObjectsByNoun("ball").size());
+    EXPECT_FALSE(parser::WordManager::hasNoun("red ball"));
+    EXPECT_EQ(1, parser::WordManager::getLocalNouns("ball").size());
+
+    lex.clear();
+    EXPECT_FALSE(parser::WordManager::hasNoun("ball"));
+}
+
+}